@@ -44,6 +44,7 @@ yee_centering = {
         "Pyz": "primal",
         "Pzz": "primal",
         "tags": "dual",
+        "workload": "dual",
     },
     "y": {
         "Bx": "dual",
@@ -79,6 +80,7 @@ yee_centering = {
         "Pyz": "primal",
         "Pzz": "primal",
         "tags": "dual",
+        "workload": "dual",
     },
     "z": {
         "Bx": "dual",
@@ -114,6 +116,7 @@ yee_centering = {
         "Pyz": "primal",
         "Pzz": "primal",
         "tags": "dual",
+        "workload": "dual",
     },
 }
 yee_centering_lower = {
@@ -13,6 +13,10 @@ from .diagnostics import (
     ParticleDiagnostics,
     MetaDiagnostics,
     InfoDiagnostics,
+    PerformanceDiagnostics,
+    TimeAverageDiagnostics,
+    DistributionDiagnostics,
+    TracerDiagnostics,
 )
 from .simulation import (
     Simulation,
@@ -30,6 +34,10 @@ __all__ = [
     "ParticleDiagnostics",
     "MetaDiagnostics",
     "InfoDiagnostics",
+    "PerformanceDiagnostics",
+    "TimeAverageDiagnostics",
+    "DistributionDiagnostics",
+    "TracerDiagnostics",
     "Simulation",
 ]
 
@@ -185,6 +193,7 @@ def populateDict():
     add_int("simulation/refined_particle_nbr", simulation.refined_particle_nbr)
     add_double("simulation/time_step", simulation.time_step)
     add_int("simulation/time_step_nbr", simulation.time_step_nbr)
+    add_int("simulation/memory_report/every", simulation.memory_report_every)
 
     add_string("simulation/AMR/clustering", simulation.clustering)
     add_int("simulation/AMR/max_nbr_levels", simulation.max_nbr_levels)
@@ -230,12 +239,34 @@ def populateDict():
         add_double(
             "simulation/AMR/refinement/tagging/threshold", simulation.tagging_threshold
         )
+        add_string(
+            "simulation/AMR/refinement/tagging/criteria", simulation.tagging_criteria
+        )
+        add_double(
+            "simulation/AMR/refinement/tagging/hysteresis", simulation.tagging_hysteresis
+        )
     else:
         add_string(
             "simulation/AMR/refinement/tagging/method", "none"
         )  # integrator.h might want some looking at
 
     add_string("simulation/algo/ion_updater/pusher/name", simulation.particle_pusher)
+    add_bool(
+        "simulation/algo/ion_updater/pusher/deferred_cellmap", simulation.deferred_cellmap
+    )
+    add_bool(
+        "simulation/algo/ion_updater/pusher/interleaved_em_gather",
+        simulation.interleaved_em_gather,
+    )
+    add_int("simulation/algo/ion_updater/tile_size", simulation.tile_size)
+    add_bool(
+        "simulation/algo/ion_updater/skip_patch_ghost_push",
+        simulation.skip_patch_ghost_push,
+    )
+
+    if simulation.resampling is not None:
+        for key, value in simulation.resampling.items():
+            add_int(f"simulation/algo/resampler/{key}", value)
 
     add_double("simulation/algo/ohm/resistivity", simulation.resistivity)
     add_double("simulation/algo/ohm/hyper_resistivity", simulation.hyper_resistivity)
@@ -260,6 +291,13 @@ def populateDict():
     # cadence based values
     add_size_t(f"{base}/every", lb.every)
     add_bool(f"{base}/on_init", lb.on_init)
+    add_bool(f"{base}/initial_partition", lb.initial_partition)
+
+    # cost based values
+    add_bool(f"{base}/cost", lb.cost)
+    add_size_t(f"{base}/horizon", lb.horizon)
+    add_double(f"{base}/bandwidth", lb.bandwidth)
+    add_bool(f"{base}/log", lb.log)
     # load balancer block end
 
     init_model = simulation.model
@@ -293,6 +331,15 @@ def populateDict():
         add_int(partinit_path + "nbr_part_per_cell", d["nbrParticlesPerCell"])
         add_double(partinit_path + "density_cut_off", d["density_cut_off"])
 
+        tracers = d.get("tracers", {})
+        if tracers.get("fraction", 0) > 0:
+            add_double(partinit_path + "tracers/fraction", tracers["fraction"])
+            if "box" in tracers:
+                pp.add_array_as_vector(
+                    partinit_path + "tracers/box",
+                    np.asarray(tracers["box"], dtype=float).flatten(),
+                )
+
     add_string("simulation/electromag/name", "EM")
     add_string("simulation/electromag/electric/name", "E")
 
@@ -322,6 +369,20 @@ def populateDict():
             name_path + "/" + "compute_timestamps", diag.compute_timestamps
         )
 
+        if diag.type == "distribution":
+            add_string(name_path + "/axes", ",".join(diag.axes))
+            add_vector_int(name_path + "/bins", diag.bins)
+            pp.add_array_as_vector(
+                name_path + "/ranges", np.asarray(diag.ranges, dtype=float).flatten()
+            )
+            pp.add_array_as_vector(
+                name_path + "/boxes", np.asarray(diag.boxes, dtype=float).flatten()
+            )
+            add_size_t(name_path + "/level", diag.level)
+
+        if diag.type == "tracer":
+            add_size_t(name_path + "/level", diag.level)
+
         add_size_t(name_path + "/" + "n_attributes", len(diag.attributes))
         for attr_idx, attr_key in enumerate(diag.attributes):
             add_string(name_path + "/" + f"attribute_{attr_idx}_key", attr_key)
@@ -30,6 +30,12 @@ def diagnostics_checker(func):
             "path",
             "population_name",
             "flush_every",
+            "sample_every",
+            "axes",
+            "bins",
+            "ranges",
+            "boxes",
+            "level",
         ]
         accepted_keywords += mandatory_keywords
 
@@ -434,3 +440,265 @@ class InfoDiagnostics(Diagnostics):
             "write_timestamps": self.write_timestamps,
             "path": self.path,
         }
+
+
+# ------------------------------------------------------------------------------
+
+
+class PerformanceDiagnostics(Diagnostics):
+    """
+    patch_load: per patch attributes, compute_time (seconds spent pushing the patch
+                particles since the previous dump), domain and ghost particle counts
+                in total and per population
+    workload:   per cell domain particle count, what the "nppc" load balancer uses
+    """
+
+    performance_quantities = ["patch_load", "workload"]
+    type = "performance"
+
+    def __init__(self, **kwargs):
+        super(PerformanceDiagnostics, self).__init__(
+            PerformanceDiagnostics.type
+            + str(global_vars.sim.count_diagnostics(PerformanceDiagnostics.type)),
+            **kwargs,
+        )
+
+    def _setSubTypeAttributes(self, **kwargs):
+        if kwargs["quantity"] not in PerformanceDiagnostics.performance_quantities:
+            error_msg = (
+                "Error: '{}' not a valid performance diagnostics : "
+                + ", ".join(PerformanceDiagnostics.performance_quantities)
+            )
+            raise ValueError(error_msg.format(kwargs["quantity"]))
+
+        self.quantity = f"/{kwargs['quantity']}"
+
+    def to_dict(self):
+        return {
+            "name": self.name,
+            "type": PerformanceDiagnostics.type,
+            "quantity": self.quantity,
+            "write_timestamps": self.write_timestamps,
+            "path": self.path,
+        }
+
+
+# ------------------------------------------------------------------------------
+
+
+class TimeAverageDiagnostics(Diagnostics):
+    """
+    writes at each write timestamp the mean of the quantity over the samples taken
+    since the previous write, the current time included. Samples are taken every
+    sample_every time steps from the simulation start time, and at write timestamps.
+    The number of samples of each write is the nbr_samples attribute of its time group.
+
+    E, B:                the electromagnetic fields
+    density, bulkVelocity: of the total ions
+    """
+
+    time_average_quantities = {
+        "E": "EM_E",
+        "B": "EM_B",
+        "density": "density",
+        "bulkVelocity": "bulkVelocity",
+    }
+    type = "time_average"
+
+    def __init__(self, **kwargs):
+        super(TimeAverageDiagnostics, self).__init__(
+            TimeAverageDiagnostics.type
+            + str(global_vars.sim.count_diagnostics(TimeAverageDiagnostics.type)),
+            **kwargs,
+        )
+
+    def _setSubTypeAttributes(self, **kwargs):
+        quantities = TimeAverageDiagnostics.time_average_quantities
+        if kwargs["quantity"] not in quantities:
+            error_msg = "Error: '{}' not a valid time_average diagnostics : " + (
+                ", ".join(quantities)
+            )
+            raise ValueError(error_msg.format(kwargs["quantity"]))
+
+        self.quantity = "/time_average/" + quantities[kwargs["quantity"]]
+
+        self.sample_every = kwargs.get("sample_every", 1)
+        if self.sample_every < 1:
+            raise ValueError(
+                f"Error: {self.__class__.__name__}.sample_every must be at least 1"
+            )
+
+        sim = global_vars.sim
+        nbr_samples = int((sim.final_time - sim.start_time()) / sim.time_step)
+        samples = sim.start_time() + sim.time_step * np.arange(
+            0, nbr_samples + 1, self.sample_every
+        )
+        timestamps = np.sort(np.concatenate((samples, self.write_timestamps)))
+        mask = np.ones(len(timestamps), dtype=bool)
+        mask[1:] = np.diff(timestamps) > 1e-10  # a sample per step at most
+        self.compute_timestamps = timestamps[mask]
+
+    def to_dict(self):
+        return {
+            "name": self.name,
+            "type": TimeAverageDiagnostics.type,
+            "quantity": self.quantity,
+            "write_timestamps": self.write_timestamps,
+            "compute_timestamps": self.compute_timestamps,
+            "path": self.path,
+        }
+
+
+# ------------------------------------------------------------------------------
+
+
+class DistributionDiagnostics(Diagnostics):
+    """
+    writes at each write timestamp the histogram of the velocities of the domain
+    particles of a population, summed over all patches and ranks of one level.
+
+    quantity:  name of the histogram
+    axes:      1 to 3 of vx, vy, vz, or in the local magnetic basis vpar (along B),
+               vperp1, vperp2 and vperp (the norm of vperp1 and vperp2)
+    bins:      number of bins per axis
+    ranges:    (min, max) per axis, velocities out of range are not counted
+    boxes:     optional list of ((lower), (upper)) physical corners, a particle counts
+               in all the boxes containing it. Without boxes, histograms are per cell
+               of the coarsest level
+    level:     the level whose particles are binned, 0 by default
+    """
+
+    velocity_axes = ["vx", "vy", "vz", "vpar", "vperp1", "vperp2", "vperp"]
+    type = "distribution"
+
+    def __init__(self, **kwargs):
+        super(DistributionDiagnostics, self).__init__(
+            DistributionDiagnostics.type
+            + str(global_vars.sim.count_diagnostics(DistributionDiagnostics.type)),
+            **kwargs,
+        )
+
+    def _setSubTypeAttributes(self, **kwargs):
+        if "population_name" not in kwargs:
+            raise ValueError("Error: missing population_name")
+        self.population_name = kwargs["population_name"]
+
+        if not population_in_model(self.population_name):
+            raise ValueError(
+                "Error: population '{}' not in simulation initial model".format(
+                    self.population_name
+                )
+            )
+
+        self.axes = list(kwargs.get("axes", []))
+        self.bins = [int(n) for n in kwargs.get("bins", [])]
+        self.ranges = [tuple(r) for r in kwargs.get("ranges", [])]
+        name = self.__class__.__name__
+
+        if not 1 <= len(self.axes) <= 3:
+            raise ValueError(f"Error: {name} needs 1 to 3 axes")
+        for axis in self.axes:
+            if axis not in DistributionDiagnostics.velocity_axes:
+                raise ValueError(
+                    f"Error: '{axis}' not a valid {name} axis : "
+                    + ", ".join(DistributionDiagnostics.velocity_axes)
+                )
+        if len(self.bins) != len(self.axes) or len(self.ranges) != len(self.axes):
+            raise ValueError(f"Error: {name} needs bins and ranges for each axis")
+        if any(n < 1 for n in self.bins):
+            raise ValueError(f"Error: {name}.bins must be at least 1")
+        if any(len(r) != 2 or r[1] <= r[0] for r in self.ranges):
+            raise ValueError(f"Error: {name}.ranges must be (min, max) with min < max")
+
+        ndim = global_vars.sim.ndim
+        self.boxes = [tuple(map(tuple, box)) for box in kwargs.get("boxes", [])]
+        for lower, upper in self.boxes:
+            if len(lower) != ndim or len(upper) != ndim:
+                raise ValueError(f"Error: {name}.boxes must be {ndim}D corners")
+
+        self.level = kwargs.get("level", 0)
+        if self.level < 0:
+            raise ValueError(f"Error: {name}.level cannot be negative")
+
+        self.quantity = (
+            f"/ions/pop/{self.population_name}/distribution/{kwargs['quantity']}"
+        )
+
+    def to_dict(self):
+        return {
+            "name": self.name,
+            "type": DistributionDiagnostics.type,
+            "quantity": self.quantity,
+            "write_timestamps": self.write_timestamps,
+            "compute_timestamps": self.compute_timestamps,
+            "path": self.path,
+            "population_name": self.population_name,
+            "axes": self.axes,
+            "bins": self.bins,
+            "ranges": self.ranges,
+            "boxes": self.boxes,
+            "level": self.level,
+        }
+
+
+# ------------------------------------------------------------------------------
+
+
+class TracerDiagnostics(Diagnostics):
+    """
+    writes at each write timestamp the id, position, velocity and weight of the
+    domain particles of a population that are tracers, see the "tracers" argument of
+    MaxwellianFluidModel populations, which needs PHARE built with -DwithTracers=ON.
+    Tracers keep their id for the whole run. Ids are unique on level 0 only, particles
+    split from a tracer on refined levels or by the resampler share its id.
+
+    quantity:  "tracers"
+    level:     the level whose tracers are written, 0 by default
+    """
+
+    tracer_quantities = ["tracers"]
+    type = "tracer"
+
+    def __init__(self, **kwargs):
+        super(TracerDiagnostics, self).__init__(
+            TracerDiagnostics.type
+            + str(global_vars.sim.count_diagnostics(TracerDiagnostics.type)),
+            **kwargs,
+        )
+
+    def _setSubTypeAttributes(self, **kwargs):
+        if kwargs["quantity"] not in TracerDiagnostics.tracer_quantities:
+            error_msg = "Error: '{}' not a valid tracer diagnostics : " + ", ".join(
+                TracerDiagnostics.tracer_quantities
+            )
+            raise ValueError(error_msg.format(kwargs["quantity"]))
+
+        if "population_name" not in kwargs:
+            raise ValueError("Error: missing population_name")
+        self.population_name = kwargs["population_name"]
+
+        if not population_in_model(self.population_name):
+            raise ValueError(
+                "Error: population '{}' not in simulation initial model".format(
+                    self.population_name
+                )
+            )
+
+        self.level = kwargs.get("level", 0)
+        if self.level < 0:
+            name = self.__class__.__name__
+            raise ValueError(f"Error: {name}.level cannot be negative")
+
+        self.quantity = f"/ions/pop/{self.population_name}/{kwargs['quantity']}"
+
+    def to_dict(self):
+        return {
+            "name": self.name,
+            "type": TracerDiagnostics.type,
+            "quantity": self.quantity,
+            "write_timestamps": self.write_timestamps,
+            "compute_timestamps": self.compute_timestamps,
+            "path": self.path,
+            "population_name": self.population_name,
+            "level": self.level,
+        }
@@ -19,6 +19,10 @@ class LoadBalancer:
     # whether to rebalance/check imbalance on init
     on_init: bool = field(default_factory=lambda: True)
 
+    # whether to partition the root level from the particles expected per cell
+    #  before loading them, rather than from a uniform load
+    initial_partition: bool = field(default_factory=lambda: False)
+
     # if auto, other values are not used if active
     auto: bool = field(default_factory=lambda: False)
     next_rebalance_backoff_multiplier: int = field(default_factory=lambda: 2)
@@ -28,6 +32,15 @@ class LoadBalancer:
     # if !auto these values are used if active
     every: int = field(default_factory=lambda: None)
 
+    # if cost, rebalance when the time saved over the next horizon steps exceeds
+    #  the time to migrate the particles at bandwidth bytes per second
+    #  both from the root level workload, the only level rebalanced
+    cost: bool = field(default_factory=lambda: False)
+    horizon: int = field(default_factory=lambda: 100)
+    bandwidth: float = field(default_factory=lambda: 1e9)
+    # whether rank 0 prints each cost decision, to tune horizon and bandwidth
+    log: bool = field(default_factory=lambda: True)
+
     # internal, allows not registering object for default init
     _register: bool = field(default_factory=lambda: True)
 
@@ -35,8 +48,14 @@ class LoadBalancer:
         if self.auto and self.every:
             raise RuntimeError("LoadBalancer cannot work with both 'every' and 'auto'")
 
+        if self.cost and (self.auto or self.every):
+            raise RuntimeError("LoadBalancer 'cost' cannot work with 'every' or 'auto'")
+
+        if self.cost and (self.horizon <= 0 or self.bandwidth <= 0):
+            raise RuntimeError("LoadBalancer 'horizon' and 'bandwidth' must be positive")
+
         if self.every is None:
-            self.auto = True
+            self.auto = not self.cost
             self.every = 0  # python3 -> c++ doesn't understand 'None'
 
         allowed_modes = [
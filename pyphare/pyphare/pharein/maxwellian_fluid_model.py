@@ -118,6 +118,7 @@ class MaxwellianFluidModel(object):
         vthz=None,
         init={},
         density_cut_off=1e-16,
+        tracers={},
     ):
         """
         add a particle population to the current model
@@ -136,6 +137,10 @@ class MaxwellianFluidModel(object):
         vbulk       : bulk velocity, tuple of size 3  (default = (0,0,0))
         beta        : beta of the species, float (default = 1)
         anisotropy  : Pperp/Ppara of the species, float (default = 1)
+        tracers     : dict, "fraction" of the particles given a persistent id,
+                      optionally only those loaded in "box", ((lower...), (upper...))
+                      in physical coordinates, see TracerDiagnostics,
+                      needs PHARE built with -DwithTracers=ON
         """
 
         init_keys = ["seed"]
@@ -146,6 +151,15 @@ class MaxwellianFluidModel(object):
             )
         init["seed"] = init["seed"] if "seed" in init else None
 
+        tracers_keys = ["fraction", "box"]
+        wrong_keys = phare_utilities.not_in_keywords_list(tracers_keys, **tracers)
+        if len(wrong_keys) > 0:
+            raise ValueError(
+                "Model Error: invalid tracers arguments - " + " ".join(wrong_keys)
+            )
+        if not 0 <= tracers.get("fraction", 0) <= 1:
+            raise ValueError("Model Error: tracers fraction must be in [0, 1]")
+
         density = self.defaulter(density, 1.0)
 
         vbulkx = self.defaulter(vbulkx, 0.0)
@@ -170,6 +184,7 @@ class MaxwellianFluidModel(object):
                 "nbrParticlesPerCell": nbr_part_per_cell,
                 "init": init,
                 "density_cut_off": density_cut_off,
+                "tracers": tracers,
             }
         }
 
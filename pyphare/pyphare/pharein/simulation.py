@@ -267,11 +267,7 @@ valid_refined_particle_nbr = {
     # dim : {interp : [valid list refined_particle_nbr]}
     1: {1: [2, 3], 2: [2, 3, 4], 3: [2, 3, 4, 5]},
     2: {1: [4, 5, 8, 9], 2: [4, 5, 8, 9, 16], 3: [4, 5, 8, 9, 25]},
-    3: {
-        1: [6, 7, 8, 9, 12, 13, 14, 15, 18, 19, 20, 21, 26, 27],
-        2: [6, 7, 8, 9, 12, 13, 14, 15, 18, 19, 20, 21, 26, 27, 64],
-        3: [6, 7, 8, 9, 12, 13, 14, 15, 18, 19, 20, 21, 26, 27, 125],
-    },
+    # no 3D simulator is registered yet, see supported_dimensions()
 }  # Default refined_particle_nbr per dim/interp is considered index 0 of list
 
 
@@ -534,6 +530,40 @@ def check_restart_options(**kwargs):
     return restart_options
 
 
+def check_resampling(**kwargs):
+    valid_keys = ["every", "max_per_cell", "min_per_cell", "velocity_bins"]
+    resampling = kwargs.get("resampling", None)
+
+    if resampling is not None:
+        for key in resampling.keys():
+            if key not in valid_keys:
+                raise ValueError(
+                    f"invalid resampling option ({key}), valid options are {valid_keys}"
+                )
+
+        resampling = {
+            "every": int(resampling.get("every", 10)),
+            "max_per_cell": int(resampling.get("max_per_cell", 0)),
+            "min_per_cell": int(resampling.get("min_per_cell", 0)),
+            "velocity_bins": int(resampling.get("velocity_bins", 2)),
+        }
+
+        if resampling["every"] < 1:
+            raise ValueError("Error: resampling 'every' must be at least 1")
+        if resampling["velocity_bins"] < 1:
+            raise ValueError("Error: resampling 'velocity_bins' must be at least 1")
+        if resampling["max_per_cell"] == 0 and resampling["min_per_cell"] == 0:
+            raise ValueError(
+                "Error: resampling needs 'max_per_cell' and/or 'min_per_cell'"
+            )
+        if 0 < resampling["max_per_cell"] <= resampling["min_per_cell"]:
+            raise ValueError(
+                "Error: resampling 'max_per_cell' must be above 'min_per_cell'"
+            )
+
+    return resampling
+
+
 def validate_restart_options(sim):
     import pyphare.pharein.restarts as restarts
 
@@ -545,6 +575,19 @@ def check_refinement(**kwargs):
     return kwargs.get("refinement", "boxes")
 
 
+def check_tagging_criteria(**kwargs):
+    criteria = kwargs.get("tagging_criteria", "B")
+    if isinstance(criteria, str):
+        criteria = [criteria]
+    valid = ["B", "density", "current"]
+    for criterion in criteria:
+        if criterion not in valid:
+            raise ValueError(
+                f"Error: tagging criterion {criterion} not in valid criteria {valid}"
+            )
+    return ",".join(criteria)
+
+
 def check_nesting_buffer(ndim, **kwargs):
     nesting_buffer = phare_utilities.np_array_ify(kwargs.get("nesting_buffer", 0), ndim)
 
@@ -631,6 +674,11 @@ def checker(func):
             "cells",
             "dl",
             "particle_pusher",
+            "deferred_cellmap",
+            "interleaved_em_gather",
+            "tile_size",
+            "skip_patch_ghost_push",
+            "resampling",
             "final_time",
             "time_step",
             "time_step_nbr",
@@ -645,6 +693,8 @@ def checker(func):
             "refinement_boxes",
             "refinement",
             "tagging_threshold",
+            "tagging_criteria",
+            "tagging_hysteresis",
             "clustering",
             "smallest_patch_size",
             "largest_patch_size",
@@ -658,6 +708,7 @@ def checker(func):
             "description",
             "dry_run",
             "write_reports",
+            "memory_report_every",
         ]
 
         accepted_keywords += check_optional_keywords(**kwargs)
@@ -687,10 +738,20 @@ def checker(func):
         kwargs["refinement_ratio"] = 2
 
         kwargs["particle_pusher"] = check_pusher(**kwargs)
+        kwargs["deferred_cellmap"] = kwargs.get("deferred_cellmap", False)
+        kwargs["interleaved_em_gather"] = kwargs.get("interleaved_em_gather", False)
+        kwargs["tile_size"] = kwargs.get("tile_size", 0)
+        kwargs["skip_patch_ghost_push"] = kwargs.get("skip_patch_ghost_push", False)
+        kwargs["resampling"] = check_resampling(**kwargs)
         kwargs["layout"] = check_layout(**kwargs)
         kwargs["path"] = check_path(**kwargs)
 
         ndim = compute_dimension(cells)
+        if ndim not in supported_dimensions():
+            raise ValueError(
+                f"Error: {ndim}D simulations are not available, "
+                + f"supported dimensions are {supported_dimensions()}"
+            )
         kwargs["diag_options"] = check_diag_options(**kwargs)
         kwargs["restart_options"] = check_restart_options(**kwargs)
 
@@ -720,6 +781,8 @@ def checker(func):
             assert kwargs["max_nbr_levels"] is not None  # this needs setting otherwise
             kwargs["refinement_boxes"] = None
             kwargs["tagging_threshold"] = kwargs.get("tagging_threshold", 0.1)
+            kwargs["tagging_criteria"] = check_tagging_criteria(**kwargs)
+            kwargs["tagging_hysteresis"] = kwargs.get("tagging_hysteresis", 0.0)
 
         kwargs["resistivity"] = check_resistivity(**kwargs)
 
@@ -733,6 +796,7 @@ def checker(func):
         kwargs["write_reports"] = kwargs.get(  # on by default except for tests
             "write_reports", os.environ.get("PHARE_TESTING", "0") != "1"
         )
+        kwargs["memory_report_every"] = kwargs.get("memory_report_every", 0)
 
         return func(simulation_object, **kwargs)
 
@@ -891,6 +955,15 @@ class Simulation(object):
 
         * **interp_order** (``int``), 1, 2 or 3 (default=1) particle b-spline order
         * **particle_pusher** (``str``), algo to push particles (default = "modifiedBoris")
+        * **deferred_cellmap** (``bool``), if True, particle cell maps are rebuilt once after each push rather than updated for each cell crossing. Faster when many particles cross cells per step (default = False)
+        * **interleaved_em_gather** (``bool``), if True, E and B are copied once per push into a buffer interleaving the 6 components per node, from which they are gathered at particle positions in one pass (default = False)
+        * **tile_size** (``int``), if > 0, ion moments are deposited tile by tile, patches being split in tiles of tile_size cells per direction, and domain particles are sorted by tile (default = 0, no tiling)
+        * **skip_patch_ghost_push** (``bool``), if True, patch ghost particles are not pushed, patches instead give their neighbors the domain particles that left into them (default = False)
+        * **resampling** (``dict``), default=None (no resampling), resamples domain particles of cells further than the particle ghost width from their patch border. The number of particles removed and added over all ranks is printed by rank 0 at each resampling that changes particles
+            * **every** (``int``) number of steps of a level between two resamplings (default=10)
+            * **max_per_cell** (``int``) particles of cells above this count are merged per velocity bin, conserving charge, momentum and energy of each velocity component (default=0, no merging)
+            * **min_per_cell** (``int``) the heaviest particles of cells below this count are split (default=0, no splitting)
+            * **velocity_bins** (``int``) number of velocity bins per component used to merge particles (default=2)
 
 
     **Diagnostics output parameters:**
@@ -907,6 +980,8 @@ class Simulation(object):
         * **max_nbr_levels** (``int``), default=1, max number of levels in the hierarchy. Used if no `refinement_boxes` are set
         * **tag_buffer** (``int``), default=1, value representing the number of cells by which tagged cells are buffered before clustering into boxes. The larger `tag_buffer`, the wider refined regions will be around tagged cells.
         * **clustering** (``str``), {"berger" (default), "tile"}, type of clustering to use for AMR. `tile` results in wider patches, less artifacts and better scalability
+        * **tagging_criteria** (``str`` or ``list``), default="B", criteria used to tag cells for refinement among "B" (magnetic field gradient), "density" (ion density gradient) and "current" (current magnitude)
+        * **tagging_hysteresis** (``float``), default=0, tagged cells stay tagged until their criterion goes below `tagging_threshold * (1 - tagging_hysteresis)`, so that refined regions do not flicker between regrids. Tags are kept on the rank that computed them, cells moved to another rank by load balancing start untagged
 
         **Expert parameters:**
 
@@ -941,6 +1016,7 @@ class Simulation(object):
         * **resistivity** (``float``), resistivity value (default=0.0)
         * **hyper-resistivity** (``float``), hyper-resistivity value (default=0.0)
         * **boundary_types** (``str`` or ``tuple``) type of boundary conditions (default is "periodic" for each direction)
+        * **memory_report_every** (``int``), if > 0, every that many advances the bytes used and reserved per level by particles, cell maps, fields and solver scratch data are appended to .phare/memory/report.txt, min/max/sum over ranks (default=0, no report)
 
     """
 
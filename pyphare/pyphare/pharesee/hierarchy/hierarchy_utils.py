@@ -37,6 +37,7 @@ field_qties = {
     "density": "rho",
     "mass_density": "rho",
     "tags": "tags",
+    "workload": "workload",
 }
 
 
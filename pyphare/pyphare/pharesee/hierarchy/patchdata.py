@@ -4,6 +4,8 @@ from ...core import phare_utilities as phut
 from ...core import box as boxm
 from ...core.box import Box
 
+# per cell quantities written without ghosts
+ghostless_qties = ["tags", "workload"]
 
 class PatchData:
     """
@@ -35,7 +37,7 @@ class FieldData(PatchData):
 
     @property
     def x(self):
-        withGhosts = self.field_name != "tags"
+        withGhosts = self.field_name not in ghostless_qties
         if self._x is None:
             self._x = self.layout.yeeCoordsFor(
                 self.field_name,
@@ -47,7 +49,7 @@ class FieldData(PatchData):
 
     @property
     def y(self):
-        withGhosts = self.field_name != "tags"
+        withGhosts = self.field_name not in ghostless_qties
         if self._y is None:
             self._y = self.layout.yeeCoordsFor(
                 self.field_name,
@@ -59,7 +61,7 @@ class FieldData(PatchData):
 
     @property
     def z(self):
-        withGhosts = self.field_name != "tags"
+        withGhosts = self.field_name not in ghostless_qties
         if self._z is None:
             self._z = self.layout.yeeCoordsFor(
                 self.field_name,
@@ -160,7 +162,7 @@ class FieldData(PatchData):
                 f"centering not specified and cannot be inferred from field name : {field_name}"
             )
 
-        if self.field_name != "tags":
+        if self.field_name not in ghostless_qties:
             for i, centering in enumerate(self.centerings):
                 self.ghosts_nbr[i] = layout.nbrGhosts(layout.interp_order, centering)
 
@@ -29,6 +29,10 @@ quantities_per_file = {
     "ions_bulkVelocity": "Vi",
     "ions_density": "Ni",
     "particle_count": "nppc",
+    "time_average_EM_B": "B_avg",
+    "time_average_EM_E": "E_avg",
+    "time_average_bulkVelocity": "Vi_avg",
+    "time_average_density": "Ni_avg",
 }
 
 
@@ -201,6 +205,64 @@ class Run:
         c = self._get_hierarchy(time, "particle_count.h5", **kwargs)
         return c
 
+    def GetPatchLoad(self, time, **kwargs):
+        """
+        hierarchy whose patch attributes hold the compute time and particle counts
+        of the patch, see PerformanceDiagnostics
+        """
+        return self._get_hierarchy(time, "patch_load.h5", **kwargs)
+
+    def GetWorkload(self, time, merged=False, interp="nearest", **kwargs):
+        hier = self._get_hierarchy(time, "workload.h5", **kwargs)
+        return ScalarField(self._get(hier, time, merged, interp))
+
+    def GetTimeAverage(self, time, quantity, merged=False, interp="nearest", **kwargs):
+        """
+        mean of E, B, density or bulkVelocity over the samples taken since the previous
+        dump, see TimeAverageDiagnostics
+        """
+        datasets = {"E": "EM_E", "B": "EM_B", "density": "density"}
+        dataset = datasets.get(quantity, quantity)
+        hier = self._get_hierarchy(time, f"time_average_{dataset}.h5", **kwargs)
+        if quantity == "density":
+            return ScalarField(self._get(hier, time, merged, interp))
+        return VectorField(self._get(hier, time, merged, interp))
+
+    def GetDistribution(self, time, pop_name, name):
+        """
+        velocity histogram of a population, see DistributionDiagnostics
+        returns the counts, shaped (regions..., bins...), and the bin edges per axis
+        """
+        import h5py
+
+        filename = f"ions_pop_{pop_name}_distribution_{name}.h5"
+        with h5py.File(os.path.join(self.path, filename), "r") as h5:
+            counts = h5[f"t/{time:.10f}/histogram"][:]
+            bins, ranges = h5.attrs["bins"], h5.attrs["ranges"]
+            edges = [
+                np.linspace(ranges[2 * i], ranges[2 * i + 1], n + 1)
+                for i, n in enumerate(bins)
+            ]
+        return counts, edges
+
+    def GetTracers(self, time, pop_name):
+        """
+        tracer particles of a population, see TracerDiagnostics
+        returns a dict of arrays: id, position (physical), v and weight, sorted by id
+
+        ids are unique on the root level only: on refined levels, the particles split
+        from a tracer, and the twins of tracers split by the resampler, share its id,
+        and come out consecutively here, in no particular order among themselves
+        """
+        import h5py
+
+        filename = f"ions_pop_{pop_name}_tracers.h5"
+        with h5py.File(os.path.join(self.path, filename), "r") as h5:
+            group = h5[f"t/{time:.10f}"]
+            tracers = {key: group[key][:] for key in ["id", "position", "v", "weight"]}
+        order = np.argsort(tracers["id"], kind="stable")
+        return {key: data[order] for key, data in tracers.items()}
+
     def GetMass(self, pop_name, **kwargs):
         list_of_qty = ["density", "flux", "domain", "levelGhost", "patchGhost"]
         list_of_mass = []
@@ -63,3 +63,18 @@ def timing_setup(cpplib):
             Path(".phare/timings").mkdir(parents=True, exist_ok=True)
         except FileNotFoundError:
             logger.error(f"Couldn't find timing dir from {os.getcwd() }")
+
+
+def memory_report(simulator):
+    """
+    bytes used and reserved per level and kind of data, reduced over ranks, see
+    Simulator::memoryReport. Collective: all ranks must call it.
+
+        report["levels"][ilvl]["domain_particles"]["reserved"]["max"]
+
+    kinds are domain_particles, patch_ghost_particles, level_ghost_particles,
+    leaving_particles, cellmaps, fields and solver_scratch, each with its "used",
+    "reserved" and "peak_reserved" (high watermark over reports) min/max/sum.
+    report["total"] and report["peak_rss"] are reduced over the totals of ranks.
+    """
+    return simulator.cpp_sim.memory_report()
@@ -47,11 +47,19 @@ if (bench)
 
 
   add_subdirectory(tools/bench/core/data/particles)
+  add_subdirectory(tools/bench/core/data/electrons)
   add_subdirectory(tools/bench/core/numerics/pusher)
+  add_subdirectory(tools/bench/core/numerics/faraday)
+  add_subdirectory(tools/bench/core/numerics/ampere)
+  add_subdirectory(tools/bench/core/numerics/ohm)
+  add_subdirectory(tools/bench/core/utilities/cellmap)
+  add_subdirectory(tools/bench/core/mini_app)
 
   add_subdirectory(tools/bench/amr/data/particles)
+  add_subdirectory(tools/bench/amr/data/field)
   add_subdirectory(tools/bench/core/numerics/ion_updater)
   add_subdirectory(tools/bench/core/numerics/interpolator)
+  add_subdirectory(tools/bench/core/numerics/moments)
 
   add_subdirectory(tools/bench/hi5)
   add_subdirectory(tools/bench/real)
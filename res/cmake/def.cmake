@@ -39,6 +39,10 @@ if(PGO_USE)
   set (PHARE_FLAGS ${PHARE_FLAGS} -fprofile-use )
 endif()
 
+if(withTracers)
+  add_definitions(-DPHARE_WITH_TRACERS=1)
+endif(withTracers)
+
 
 set (PHARE_WERROR_FLAGS ${PHARE_FLAGS} ${PHARE_WERROR_FLAGS})
 set (PHARE_PYTHONPATH "${CMAKE_BINARY_DIR}:${CMAKE_SOURCE_DIR}/pyphare")
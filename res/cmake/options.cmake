@@ -67,6 +67,10 @@ option(withCaliper "Use LLNL Caliper" OFF)
 option(withPhlop "Use phlop" OFF)
 
 
+# -DwithTracers=ON, particles carry a 64 bit id for TracerDiagnostics
+option(withTracers "Particles carry a tracer id" OFF)
+
+
 # -DlowResourceTests=ON
 option(lowResourceTests "Disable heavy tests for CI (2d/3d/etc" OFF)
 
@@ -117,6 +121,7 @@ function(print_phare_options)
   message("build with asan support                     : " ${asan})
   message("build with ccache (if found) in devMode     : " ${withCcache})
   message("build with LLNL Caliper                     : " ${withCaliper})
+  message("build with tracer particle ids              : " ${withTracers})
   message("profile guided optimization generate        : " ${PGO_GEN})
   message("profile guided optimization use             : " ${PGO_USE})
 
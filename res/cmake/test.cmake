@@ -22,6 +22,8 @@ if (test AND ${PHARE_EXEC_LEVEL_MIN} GREATER 0) # 0 = no tests
   add_subdirectory(tests/core/utilities/index)
   add_subdirectory(tests/core/utilities/indexer)
   add_subdirectory(tests/core/utilities/cellmap)
+  add_subdirectory(tests/core/utilities/logger)
+  add_subdirectory(tests/core/utilities/memory)
   #add_subdirectory(tests/core/numerics/boundary_condition)
   add_subdirectory(tests/core/numerics/interpolator)
   add_subdirectory(tests/core/numerics/pusher)
@@ -29,6 +31,8 @@ if (test AND ${PHARE_EXEC_LEVEL_MIN} GREATER 0) # 0 = no tests
   add_subdirectory(tests/core/numerics/faraday)
   add_subdirectory(tests/core/numerics/ohm)
   add_subdirectory(tests/core/numerics/ion_updater)
+  add_subdirectory(tests/core/numerics/resampler)
+  add_subdirectory(tests/core/numerics/distribution)
 
 
   add_subdirectory(tests/initializer)
@@ -47,6 +51,7 @@ if (test AND ${PHARE_EXEC_LEVEL_MIN} GREATER 0) # 0 = no tests
   add_subdirectory(tests/amr/models)
   add_subdirectory(tests/amr/multiphysics_integrator)
   add_subdirectory(tests/amr/tagging)
+  add_subdirectory(tests/amr/load_balancing)
 
   add_subdirectory(tests/diagnostic)
 
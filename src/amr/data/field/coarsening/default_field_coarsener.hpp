@@ -10,6 +10,7 @@
 #include "core/utilities/point/point.hpp"
 
 #include "amr/data/field/coarsening/field_coarsen_index_weight.hpp"
+#include "amr/data/field/coarsening/field_coarsen_stencil.hpp"
 #include "amr/resources_manager/amr_utils.hpp"
 
 #include <SAMRAI/hier/Box.h>
@@ -45,6 +46,9 @@ namespace amr
             : indexesAndWeights_{centering, ratio}
             , sourceBox_{sourceBox}
             , destinationBox_{destinationBox}
+            , centerings_{centering}
+            , isRatio2_{ratio.min() == FieldCoarsenStencil::ratio
+                        and ratio.max() == FieldCoarsenStencil::ratio}
         {
         }
 
@@ -60,6 +64,12 @@ namespace amr
             // For the moment we only take the case of field with the same centering
             TBOX_ASSERT(fineField.physicalQuantity() == coarseField.physicalQuantity());
 
+            if (isRatio2_)
+            {
+                coarsenRatio2_(fineField, coarseField, coarseIndex);
+                return;
+            }
+
             core::Point<int, dimension> fineStartIndex
                 = indexesAndWeights_.computeStartIndexes(coarseIndex);
 
@@ -148,10 +158,62 @@ namespace amr
 
 
     private:
+        /** @brief same as operator() with the ratio 2 stencil, the number of fine nodes and their
+         * weights per direction being known at compile time for each centering
+         */
+        template<typename FieldT>
+        void coarsenRatio2_(FieldT const& fineField, FieldT& coarseField,
+                            core::Point<int, dimension> const& coarseIndex) const
+        {
+            using Stencil = FieldCoarsenStencil;
+
+            core::Point<int, dimension> fineStartIndex;
+            for (std::size_t iDir = 0; iDir < dimension; ++iDir)
+                fineStartIndex[iDir] = Stencil::fineStartIndex(centerings_[iDir], coarseIndex[iDir]);
+
+            auto const f = AMRToLocal(fineStartIndex, sourceBox_);
+            auto const c = AMRToLocal(coarseIndex, destinationBox_);
+
+            // sum over the fine nodes of direction iDir, with fixed size weights
+            auto sum = [&](std::size_t const iDir, auto&& value) {
+                auto weightedSum = [&](auto const& weights) {
+                    double result = 0.;
+                    for (std::size_t iShift = 0; iShift < weights.size(); ++iShift)
+                        result += weights[iShift] * value(f[iDir] + static_cast<int>(iShift));
+                    return result;
+                };
+                return centerings_[iDir] == core::QtyCentering::primal
+                           ? weightedSum(Stencil::primalWeights)
+                           : weightedSum(Stencil::dualWeights);
+            };
+
+            if constexpr (dimension == 1)
+            {
+                coarseField(c[dirX]) = sum(dirX, [&](int ix) { return fineField(ix); });
+            }
+            else if constexpr (dimension == 2)
+            {
+                coarseField(c[dirX], c[dirY]) = sum(dirX, [&](int ix) {
+                    return sum(dirY, [&](int iy) { return fineField(ix, iy); });
+                });
+            }
+            else if constexpr (dimension == 3)
+            {
+                coarseField(c[dirX], c[dirY], c[dirZ]) = sum(dirX, [&](int ix) {
+                    return sum(dirY, [&](int iy) {
+                        return sum(dirZ, [&](int iz) { return fineField(ix, iy, iz); });
+                    });
+                });
+            }
+        }
+
+
         //! precompute the indexes and weights to use to coarsen fine values onto a coarse node
         FieldCoarsenIndexesAndWeights<dimension> indexesAndWeights_;
         SAMRAI::hier::Box const sourceBox_;
         SAMRAI::hier::Box const destinationBox_;
+        std::array<core::QtyCentering, dimension> const centerings_;
+        bool const isRatio2_;
     };
 } // namespace amr
 } // namespace PHARE
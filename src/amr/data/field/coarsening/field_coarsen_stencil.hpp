@@ -0,0 +1,39 @@
+#ifndef PHARE_FIELD_COARSEN_STENCIL_HPP
+#define PHARE_FIELD_COARSEN_STENCIL_HPP
+
+
+#include "core/def.hpp"
+#include "core/data/grid/gridlayoutdefs.hpp"
+
+#include <array>
+#include <cstddef>
+
+
+namespace PHARE::amr
+{
+/** @brief FieldCoarsenStencil gives, for a refinement ratio of 2, the first fine index and the
+ * weights used to get a coarse value at a given coarse index, as the CoarsenWeighter and
+ * FieldCoarsenIndexesAndWeights do for any ratio.
+ *
+ * A primal coarse node is the weighted sum of the 3 fine nodes centered on it, a dual coarse
+ * node is the mean of the 2 fine nodes it contains. Weights are compile time tables.
+ */
+struct FieldCoarsenStencil
+{
+    static constexpr int ratio = 2;
+
+    static constexpr std::array<double, 3> primalWeights{.25, .5, .25};
+    static constexpr std::array<double, 2> dualWeights{.5, .5};
+
+
+    NO_DISCARD static constexpr int fineStartIndex(core::QtyCentering const centering,
+                                                   int const coarseIndex)
+    {
+        return centering == core::QtyCentering::primal ? 2 * coarseIndex - 1 : 2 * coarseIndex;
+    }
+};
+
+} // namespace PHARE::amr
+
+
+#endif
@@ -132,8 +132,7 @@ namespace amr
 
             for (auto& box : boxes)
             {
-                core::GridLayout layout = layoutFromBox(box, layout_);
-                SAMRAI::hier::Box fieldBox(toFieldBox(box, quantity_, layout, false));
+                SAMRAI::hier::Box fieldBox(interiorFieldBox(box, quantity_));
                 destinationBox.push_back(fieldBox);
             }
 
@@ -257,6 +256,26 @@ namespace amr
             return box;
         }
 
+
+
+        /**
+         * @brief interiorFieldBox gives the same box as toFieldBox without ghosts, but does not
+         * need a layout with the number of cells of the box : the interior nodes of a cell box
+         * are its cells, plus the upper node in the primal directions.
+         */
+        static SAMRAI::hier::Box interiorFieldBox(SAMRAI::hier::Box box, PhysicalQuantity qty)
+        {
+            auto const& centering = GridLayoutT::centering(qty);
+
+            for (auto iDim = 0u; iDim < dimension; ++iDim)
+            {
+                if (centering[iDim] == core::QtyCentering::primal)
+                    box.setUpper(iDim, box.upper(iDim) + 1);
+            }
+
+            return box;
+        }
+
         /**
          * @brief The origin of the returned layout should NOT be used
          * this is only to get start and end index for physical and ghost
@@ -0,0 +1,59 @@
+#ifndef PHARE_FIELD_REFINE_STENCIL_HPP
+#define PHARE_FIELD_REFINE_STENCIL_HPP
+
+
+#include "core/def.hpp"
+#include "core/data/grid/gridlayoutdefs.hpp"
+
+#include <array>
+#include <cstddef>
+
+
+namespace PHARE::amr
+{
+/** @brief FieldRefineStencil gives, for a refinement ratio of 2, the coarse index and the
+ * linear weights used to get a fine value at a given fine index, as the LinearWeighter and
+ * FieldRefineIndexesAndWeights do for any ratio.
+ *
+ * The fine value is weights[0] * coarse(start) + weights[1] * coarse(start + 1).
+ * Weights depend only on the centering and the parity of the fine index so they are
+ * compile time tables, and the coarse start index is computed with integer operations.
+ */
+struct FieldRefineStencil
+{
+    static constexpr int ratio = 2;
+
+    using Weights = std::array<double, 2>;
+
+    // weights[parity]
+    static constexpr std::array<Weights, 2> primalWeights{{{1., 0.}, {.5, .5}}};
+    static constexpr std::array<Weights, 2> dualWeights{{{.25, .75}, {.75, .25}}};
+
+
+    NO_DISCARD static constexpr int parity(int const fineIndex) { return fineIndex & 1; }
+
+
+    NO_DISCARD static constexpr Weights const& weights(core::QtyCentering const centering,
+                                                       int const fineIndex)
+    {
+        return centering == core::QtyCentering::primal ? primalWeights[parity(fineIndex)]
+                                                       : dualWeights[parity(fineIndex)];
+    }
+
+
+    // arithmetic shift is a floor division by 2, also for negative indexes
+    // a dual fine node left of the middle of its coarse cell starts from the coarse node on
+    // the left of that cell
+    NO_DISCARD static constexpr int coarseStartIndex(core::QtyCentering const centering,
+                                                     int const fineIndex)
+    {
+        auto const coarseIndex = fineIndex >> 1;
+        return centering == core::QtyCentering::primal ? coarseIndex
+                                                       : coarseIndex - 1 + parity(fineIndex);
+    }
+};
+
+} // namespace PHARE::amr
+
+
+#endif
@@ -8,6 +8,7 @@
 #include "core/data/grid/gridlayoutdefs.hpp"
 #include "core/data/field/field.hpp"
 #include "field_linear_refine.hpp"
+#include "field_refine_stencil.hpp"
 #include "core/utilities/constants.hpp"
 #include "core/utilities/point/point.hpp"
 
@@ -39,6 +40,9 @@ namespace amr
             : indexesAndWeights_{centering, ratio}
             , fineBox_{destinationGhostBox}
             , coarseBox_{sourceGhostBox}
+            , centerings_{centering}
+            , isRatio2_{ratio.min() == FieldRefineStencil::ratio
+                        and ratio.max() == FieldRefineStencil::ratio}
         {
         }
 
@@ -61,6 +65,12 @@ namespace amr
         {
             TBOX_ASSERT(sourceField.physicalQuantity() == destinationField.physicalQuantity());
 
+            if (isRatio2_)
+            {
+                refineRatio2_(sourceField, destinationField, fineIndex);
+                return;
+            }
+
             // First we get the coarseStartIndex for a given fineIndex
             // then we get the index in weights table for a given fineIndex.
             // After that we get the local index of coarseStartIndex and fineIndex.
@@ -162,9 +172,70 @@ namespace amr
         }
 
     private:
+        /** @brief same as operator() with the ratio 2 stencil, whose weights and start index
+         * are known at compile time, so that loops on the 2 coarse values per direction unroll
+         */
+        template<typename FieldT>
+        void refineRatio2_(FieldT const& sourceField, FieldT& destinationField,
+                           core::Point<int, dimension> const& fineIndex) const
+        {
+            using Stencil = FieldRefineStencil;
+
+            core::Point<int, dimension> coarseStartIndex;
+            std::array<Stencil::Weights, dimension> weights;
+            for (std::size_t iDir = 0; iDir < dimension; ++iDir)
+            {
+                coarseStartIndex[iDir]
+                    = Stencil::coarseStartIndex(centerings_[iDir], fineIndex[iDir]);
+                weights[iDir] = Stencil::weights(centerings_[iDir], fineIndex[iDir]);
+            }
+
+            auto const c = AMRToLocal(coarseStartIndex, coarseBox_);
+            auto const f = AMRToLocal(fineIndex, fineBox_);
+
+            if constexpr (dimension == 1)
+            {
+                destinationField(f[dirX]) = weights[dirX][0] * sourceField(c[dirX])
+                                            + weights[dirX][1] * sourceField(c[dirX] + 1);
+            }
+            else if constexpr (dimension == 2)
+            {
+                double fieldValue = 0.;
+                for (int iShiftX = 0; iShiftX < 2; ++iShiftX)
+                    fieldValue += weights[dirX][iShiftX]
+                                  * (weights[dirY][0] * sourceField(c[dirX] + iShiftX, c[dirY])
+                                     + weights[dirY][1]
+                                           * sourceField(c[dirX] + iShiftX, c[dirY] + 1));
+
+                destinationField(f[dirX], f[dirY]) = fieldValue;
+            }
+            else if constexpr (dimension == 3)
+            {
+                double fieldValue = 0.;
+                for (int iShiftX = 0; iShiftX < 2; ++iShiftX)
+                {
+                    double Yinterp = 0.;
+                    for (int iShiftY = 0; iShiftY < 2; ++iShiftY)
+                    {
+                        auto const x = c[dirX] + iShiftX;
+                        auto const y = c[dirY] + iShiftY;
+                        Yinterp += weights[dirY][iShiftY]
+                                   * (weights[dirZ][0] * sourceField(x, y, c[dirZ])
+                                      + weights[dirZ][1] * sourceField(x, y, c[dirZ] + 1));
+                    }
+                    fieldValue += weights[dirX][iShiftX] * Yinterp;
+                }
+
+                destinationField(f[dirX], f[dirY], f[dirZ]) = fieldValue;
+            }
+        }
+
+
         FieldRefineIndexesAndWeights<dimension> const indexesAndWeights_;
         SAMRAI::hier::Box const fineBox_;
         SAMRAI::hier::Box const coarseBox_;
+        std::array<core::QtyCentering, dimension> const centerings_;
+        bool const isRatio2_;
     };
 } // namespace amr
 } // namespace PHARE
@@ -62,18 +62,20 @@ public:
         auto& fieldDest         = fieldDataDest.field;
 
         auto const& layout = fieldDataDest.gridLayout;
-        auto const whereLayout
-            = FieldGeometry<GridLayoutT, PhysicalQuantity>::layoutFromBox(where, layout);
 
+        // 'where' is a cell box, its interior nodes do not depend on the layout
+        // so we do not need to build one for it at each call
         bool const withGhost{true};
-        auto qty                  = fieldDest.physicalQuantity();
-        auto const interpolateBox = FieldGeometry<GridLayoutT, PhysicalQuantity>::toFieldBox(
-            where, qty, whereLayout, !withGhost);
+        auto qty = fieldDest.physicalQuantity();
+        auto const interpolateBox
+            = FieldGeometry<GridLayoutT, PhysicalQuantity>::interiorFieldBox(where, qty);
 
         auto const ghostBox = FieldGeometry<GridLayoutT, PhysicalQuantity>::toFieldBox(
             fieldDataDest.getBox(), qty, layout, withGhost);
 
         auto const finalBox = interpolateBox * ghostBox;
+        if (finalBox.empty())
+            return;
 
         auto srcGhostBox = FieldGeometry<GridLayoutT, PhysicalQuantity>::toFieldBox(
             fieldDataSrcNew.getBox(), qty, fieldDataSrcNew.gridLayout, withGhost);
@@ -81,35 +83,38 @@ public:
         auto const localDestBox = AMRToLocal(finalBox, ghostBox);
         auto const localSrcBox  = AMRToLocal(finalBox, srcGhostBox);
 
+        // the last direction is contiguous in memory, nodes along it are interpolated
+        // in a single loop over plain pointers that the compiler can vectorize
+        auto const lastDir   = dim - 1;
+        auto const rowLength = localDestBox.upper(lastDir) - localDestBox.lower(lastDir) + 1;
+
+        auto interpolateRow
+            = [alpha, rowLength](auto* dest, auto const* srcOld, auto const* srcNew) {
+                  for (auto i = 0; i < rowLength; ++i)
+                      dest[i] = (1. - alpha) * srcOld[i] + alpha * srcNew[i];
+              };
+
         if constexpr (dim == 1)
         {
             auto const iDestStartX = localDestBox.lower(dirX);
-            auto const iDestEndX   = localDestBox.upper(dirX);
+            auto const iSrcStartX  = localSrcBox.lower(dirX);
 
-            auto const iSrcStartX = localSrcBox.lower(dirX);
-
-            for (auto ix = iDestStartX, ixSrc = iSrcStartX; ix <= iDestEndX; ++ix, ++ixSrc)
-            {
-                fieldDest(ix) = (1. - alpha) * fieldSrcOld(ixSrc) + alpha * fieldSrcNew(ixSrc);
-            }
+            interpolateRow(&fieldDest(iDestStartX), &fieldSrcOld(iSrcStartX),
+                           &fieldSrcNew(iSrcStartX));
         }
         else if constexpr (dim == 2)
         {
             auto const iDestStartX = localDestBox.lower(dirX);
             auto const iDestEndX   = localDestBox.upper(dirX);
             auto const iDestStartY = localDestBox.lower(dirY);
-            auto const iDestEndY   = localDestBox.upper(dirY);
 
             auto const iSrcStartX = localSrcBox.lower(dirX);
             auto const iSrcStartY = localSrcBox.lower(dirY);
 
             for (auto ix = iDestStartX, ixSrc = iSrcStartX; ix <= iDestEndX; ++ix, ++ixSrc)
             {
-                for (auto iy = iDestStartY, iySrc = iSrcStartY; iy <= iDestEndY; ++iy, ++iySrc)
-                {
-                    fieldDest(ix, iy) = (1. - alpha) * fieldSrcOld(ixSrc, iySrc)
-                                        + alpha * fieldSrcNew(ixSrc, iySrc);
-                }
+                interpolateRow(&fieldDest(ix, iDestStartY), &fieldSrcOld(ixSrc, iSrcStartY),
+                               &fieldSrcNew(ixSrc, iSrcStartY));
             }
         }
         else if constexpr (dim == 3)
@@ -119,7 +124,6 @@ public:
             auto const iDestStartY = localDestBox.lower(dirY);
             auto const iDestEndY   = localDestBox.upper(dirY);
             auto const iDestStartZ = localDestBox.lower(dirZ);
-            auto const iDestEndZ   = localDestBox.upper(dirZ);
 
             auto const iSrcStartX = localSrcBox.lower(dirX);
             auto const iSrcStartY = localSrcBox.lower(dirY);
@@ -129,11 +133,9 @@ public:
             {
                 for (auto iy = iDestStartY, iySrc = iSrcStartY; iy <= iDestEndY; ++iy, ++iySrc)
                 {
-                    for (auto iz = iDestStartZ, izSrc = iSrcStartZ; iz <= iDestEndZ; ++iz, ++izSrc)
-                    {
-                        fieldDest(ix, iy, iz) = (1. - alpha) * fieldSrcOld(ixSrc, iySrc, izSrc)
-                                                + alpha * fieldSrcNew(ixSrc, iySrc, izSrc);
-                    }
+                    interpolateRow(&fieldDest(ix, iy, iDestStartZ),
+                                   &fieldSrcOld(ixSrc, iySrc, iSrcStartZ),
+                                   &fieldSrcNew(ixSrc, iySrc, iSrcStartZ));
                 }
             }
         }
@@ -3,6 +3,8 @@
 
 #include <iterator>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <numeric>
 #include <stdexcept>
 #include <vector>
@@ -23,6 +25,7 @@
 #include "core/data/ions/ion_population/particle_pack.hpp"
 #include "core/data/particles/particle_array.hpp"
 #include "core/data/particles/particle_packer.hpp"
+#include "amr/data/particles/particles_variable_fill_pattern.hpp"
 #include "amr/resources_manager/amr_utils.hpp"
 #include "amr/utilities/box/amr_box.hpp"
 #include "core/utilities/point/point.hpp"
@@ -97,6 +100,10 @@ namespace amr
      * boundaries that also are level boundaries. These particles are getting here when there is a
      * particle refinement from a coarser level
      *
+     * - leavingParticles: domain particles which left the patch domain during the last push,
+     * when patch ghost particles are not pushed. They are given to the neighbor patch they
+     * entered, see LeavingParticlesOverlap.
+     *
      */
     /**
      * @brief The ParticlesData class
@@ -107,6 +114,7 @@ namespace amr
         using Super = SAMRAI::hier::PatchData;
 
         using Particle_t          = typename ParticleArray::Particle_t;
+        using Ids                 = std::vector<std::uint64_t>;
         static constexpr auto dim = ParticleArray::dimension;
         // add one cell surrounding ghost box to map particles exiting the ghost layer
         static constexpr int ghostSafeMapLayer = 1;
@@ -120,12 +128,14 @@ namespace amr
             , levelGhostParticles{grow(phare_box_from<dim>(getGhostBox()), ghostSafeMapLayer)}
             , levelGhostParticlesOld{grow(phare_box_from<dim>(getGhostBox()), ghostSafeMapLayer)}
             , levelGhostParticlesNew{grow(phare_box_from<dim>(getGhostBox()), ghostSafeMapLayer)}
+            , leavingParticles{grow(phare_box_from<dim>(getGhostBox()), ghostSafeMapLayer)}
             , pack{name,
                    &domainParticles,
                    &patchGhostParticles,
                    &levelGhostParticles,
                    &levelGhostParticlesOld,
-                   &levelGhostParticlesNew}
+                   &levelGhostParticlesNew,
+                   &leavingParticles}
             , interiorLocalBox_{AMRToLocal(box, this->getGhostBox())}
             , name_{name}
         {
@@ -165,7 +175,11 @@ namespace amr
 
                 std::size_t part_idx = 0;
                 core::apply(soa.as_tuple(), [&](auto const& arg) {
-                    restart_db->putVector(name + "_" + packer.keys()[part_idx++], arg);
+                    auto const key = name + "_" + packer.keys()[part_idx++];
+                    if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, Ids>)
+                        restart_db->putVector(key, idsToInts_(arg));
+                    else
+                        restart_db->putVector(key, arg);
                 });
             };
 
@@ -184,9 +198,11 @@ namespace amr
             using Packer = core::ParticlePacker<dim>;
 
             auto getParticles = [&](std::string const name, auto& particles) {
-                std::array<bool, Packer::n_keys> keys_exist = core::generate(
-                    [&](auto const& key) { return restart_db->keyExists(name + "_" + key); },
-                    Packer::keys());
+                // ids are optional, particles restarted without them are not tracers
+                std::vector<bool> keys_exist;
+                for (auto const& key : Packer::keys())
+                    if (key != "id")
+                        keys_exist.push_back(restart_db->keyExists(name + "_" + key));
 
                 bool all  = core::all(keys_exist);
                 bool none = core::none(keys_exist);
@@ -204,7 +220,14 @@ namespace amr
                 {
                     std::size_t part_idx = 0;
                     core::apply(soa.as_tuple(), [&](auto& arg) {
-                        restart_db->getVector(name + "_" + Packer::keys()[part_idx++], arg);
+                        auto const key = name + "_" + Packer::keys()[part_idx++];
+                        if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, Ids>)
+                        {
+                            if (restart_db->keyExists(key))
+                                intsToIds_(restart_db->getIntegerVector(key), arg);
+                        }
+                        else
+                            restart_db->getVector(key, arg);
                     });
                 }
 
@@ -281,9 +304,10 @@ namespace amr
 
             SAMRAI::hier::Transformation const& transformation = pOverlap.getTransformation();
             SAMRAI::hier::BoxContainer const& boxList = pOverlap.getDestinationBoxContainer();
+            auto const& srcParticles = pSource.sourceParticles_(overlap);
             for (auto const& overlapBox : boxList)
             {
-                copy_(overlapBox, pSource, transformation);
+                copy_(overlapBox, srcParticles, transformation);
             }
         }
 
@@ -442,6 +466,8 @@ namespace amr
         ParticleArray levelGhostParticlesOld;
         ParticleArray levelGhostParticlesNew;
 
+        ParticleArray leavingParticles;
+
         core::ParticlesPack<ParticleArray> pack;
 
 
@@ -452,6 +478,24 @@ namespace amr
         SAMRAI::hier::Box interiorLocalBox_;
         std::string name_;
 
+
+        // SAMRAI databases have no 64 bits integers, tracer ids are restarted as pairs of ints
+        static_assert(sizeof(std::uint64_t) == 2 * sizeof(int));
+
+        static std::vector<int> idsToInts_(Ids const& ids)
+        {
+            std::vector<int> ints(2 * ids.size());
+            std::memcpy(ints.data(), ids.data(), ids.size() * sizeof(std::uint64_t));
+            return ints;
+        }
+
+        static void intsToIds_(std::vector<int> const& ints, Ids& ids)
+        {
+            if (ints.size() != 2 * ids.size())
+                throw std::runtime_error("ParticlesData::getFromRestart: invalid particle ids");
+            std::memcpy(ids.data(), ints.data(), ids.size() * sizeof(std::uint64_t));
+        }
+
         void copy_(SAMRAI::hier::Box const& overlapBox, ParticlesData const& sourceData)
         {
             auto myDomainBox         = this->getBox();
@@ -474,6 +518,8 @@ namespace amr
                 srcDomainParticles.export_particles(destBox_p, domainParticles);
             }
 
+            PHARE_LOG_STOP(3, "ParticleData::copy_ DomainToDomain");
+
             PHARE_LOG_START(3, "ParticlesData::copy_ DomainToGhosts");
             // Now copy particles from the source domain that fall into
             // our ghost layer. The ghost layer is the result of removing the domain box
@@ -505,11 +551,10 @@ namespace amr
             PHARE_LOG_STOP(3, "ParticlesData::copy_ DomainToGhosts");
         }
 
-        void copy_(SAMRAI::hier::Box const& overlapBox, ParticlesData const& sourceData,
+        void copy_(SAMRAI::hier::Box const& overlapBox, ParticleArray const& srcDomainParticles,
                    SAMRAI::hier::Transformation const& transformation)
         {
-            auto myDomainBox         = this->getBox();
-            auto& srcDomainParticles = sourceData.domainParticles;
+            auto myDomainBox = this->getBox();
 
             PHARE_LOG_START(3, "ParticleData::copy_ (transform)");
 
@@ -593,6 +638,15 @@ namespace amr
 
 
 
+        //! particles to take from, for a copy or a pack with the given overlap
+        ParticleArray const& sourceParticles_(SAMRAI::hier::BoxOverlap const& overlap) const
+        {
+            if (dynamic_cast<LeavingParticlesOverlap const*>(&overlap))
+                return leavingParticles;
+            return domainParticles;
+        }
+
+
         /**
          * @brief countNumberParticlesIn_ counts the number of particles that lie
          * within the boxes of an overlap. This function count both patchGhost and
@@ -624,7 +678,7 @@ namespace amr
                 SAMRAI::hier::Transformation const& transformation = overlap.getTransformation();
                 transformation.inverseTransform(shiftedOverlapBox);
                 auto shiftedOverlapBox_p = phare_box_from<dim>(shiftedOverlapBox);
-                numberParticles += domainParticles.nbr_particles_in(shiftedOverlapBox_p);
+                numberParticles += sourceParticles_(overlap).nbr_particles_in(shiftedOverlapBox_p);
             }
             return numberParticles;
         }
@@ -643,9 +697,10 @@ namespace amr
             // destination space.  Therefore we need to inverse transform the
             // overlap box into our index space, intersect each of them with
             // our ghost box and put export them with the transformation offset
-            auto overlapBoxes = overlap.getDestinationBoxContainer();
-            auto offset       = transformation.getOffset();
-            std::size_t size  = 0;
+            auto const& particles = sourceParticles_(overlap);
+            auto overlapBoxes     = overlap.getDestinationBoxContainer();
+            auto offset           = transformation.getOffset();
+            std::size_t size      = 0;
             auto offseter     = [&](auto const& particle) {
                 auto shiftedParticle{particle};
                 for (std::size_t idir = 0; idir < dim; ++idir)
@@ -659,7 +714,7 @@ namespace amr
                 auto toTakeFrom{box};
                 transformation.inverseTransform(toTakeFrom);
                 auto toTakeFrom_p = phare_box_from<dim>(toTakeFrom);
-                size += domainParticles.nbr_particles_in(toTakeFrom_p);
+                size += particles.nbr_particles_in(toTakeFrom_p);
             }
             outBuffer.reserve(size);
             for (auto const& box : overlapBoxes)
@@ -667,7 +722,7 @@ namespace amr
                 auto toTakeFrom{box};
                 transformation.inverseTransform(toTakeFrom);
                 auto toTakeFrom_p = phare_box_from<dim>(toTakeFrom);
-                domainParticles.export_particles(toTakeFrom_p, outBuffer, offseter);
+                particles.export_particles(toTakeFrom_p, outBuffer, offseter);
             }
         }
     };
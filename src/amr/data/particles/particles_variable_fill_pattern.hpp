@@ -0,0 +1,121 @@
+#ifndef PHARE_SRC_AMR_DATA_PARTICLES_PARTICLES_VARIABLE_FILL_PATTERN_HPP
+#define PHARE_SRC_AMR_DATA_PARTICLES_PARTICLES_VARIABLE_FILL_PATTERN_HPP
+
+#include "core/def/phare_mpi.hpp"
+
+#include <SAMRAI/hier/Box.h>
+#include <SAMRAI/hier/BoxContainer.h>
+#include <SAMRAI/hier/BoxGeometry.h>
+#include <SAMRAI/hier/BoxOverlap.h>
+#include <SAMRAI/hier/IntVector.h>
+#include <SAMRAI/hier/PatchDataFactory.h>
+#include <SAMRAI/hier/Transformation.h>
+#include <SAMRAI/pdat/CellGeometry.h>
+#include <SAMRAI/pdat/CellOverlap.h>
+#include "SAMRAI/xfer/VariableFillPattern.h"
+
+#include <memory>
+#include <string>
+
+
+namespace PHARE::amr
+{
+/** @brief LeavingParticlesOverlap is the overlap of a source patch ghost box with a destination
+ * patch domain box. ParticlesData given such an overlap take the source particles from the
+ * leavingParticles array instead of the domainParticles array, i.e. from the particles which
+ * left the source patch domain during the last push and entered the destination patch.
+ */
+class LeavingParticlesOverlap : public SAMRAI::pdat::CellOverlap
+{
+public:
+    LeavingParticlesOverlap(SAMRAI::hier::BoxContainer const& boxes,
+                            SAMRAI::hier::Transformation const& transformation)
+        : SAMRAI::pdat::CellOverlap{boxes, transformation}
+    {
+    }
+};
+
+
+
+/** @brief LeavingParticlesFillPattern is used by the schedule giving to each patch the domain
+ * particles of its neighbors which entered it during the last push.
+ *
+ * SAMRAI schedules of the same level only take data from the interior of source patches.
+ * Particles leaving the source patch are in its ghost layer, so the overlap is computed here
+ * against the source ghost box, and restricted to the destination patch domain.
+ */
+class LeavingParticlesFillPattern : public SAMRAI::xfer::VariableFillPattern
+{
+public:
+    LeavingParticlesFillPattern() = default;
+
+    virtual ~LeavingParticlesFillPattern() {}
+
+    std::shared_ptr<SAMRAI::hier::BoxOverlap>
+    calculateOverlap(SAMRAI::hier::BoxGeometry const& dst_geometry,
+                     SAMRAI::hier::BoxGeometry const& src_geometry,
+                     SAMRAI::hier::Box const& dst_patch_box, SAMRAI::hier::Box const& src_mask,
+                     SAMRAI::hier::Box const& fill_box, bool const /*overwrite_interior*/,
+                     SAMRAI::hier::Transformation const& transformation) const
+    {
+        TBOX_ASSERT_OBJDIM_EQUALITY2(dst_patch_box, src_mask);
+
+        auto const& src_cell_geometry
+            = dynamic_cast<SAMRAI::pdat::CellGeometry const&>(src_geometry);
+
+        SAMRAI::hier::Box src_ghost_mask{src_mask};
+        src_ghost_mask.grow(src_cell_geometry.getGhosts());
+
+        auto basic_overlap = dst_geometry.calculateOverlap(src_geometry, src_ghost_mask, fill_box,
+                                                           /*overwrite_interior=*/true,
+                                                           transformation);
+        auto& overlap = dynamic_cast<SAMRAI::pdat::CellOverlap const&>(*basic_overlap);
+
+        auto destinationBoxes = overlap.getDestinationBoxContainer();
+        destinationBoxes.intersectBoxes(dst_patch_box);
+
+        return std::make_shared<LeavingParticlesOverlap>(destinationBoxes,
+                                                         overlap.getTransformation());
+    }
+
+    std::string const& getPatternName() const { return s_name_id; }
+
+private:
+    LeavingParticlesFillPattern(LeavingParticlesFillPattern const&)            = delete;
+    LeavingParticlesFillPattern& operator=(LeavingParticlesFillPattern const&) = delete;
+
+    static const inline std::string s_name_id = "LEAVING_PARTICLES_FILL_PATTERN";
+
+    SAMRAI::hier::IntVector const& getStencilWidth()
+    {
+        TBOX_ERROR("getStencilWidth() should not be\n"
+                   << "called.  This pattern creates overlaps based on\n"
+                   << "the BoxGeometry objects and is not restricted to a\n"
+                   << "specific stencil.\n");
+
+        /*
+         * Dummy return value that will never get reached.
+         */
+        return SAMRAI::hier::IntVector::getZero(SAMRAI::tbox::Dimension(1));
+    }
+
+    std::shared_ptr<SAMRAI::hier::BoxOverlap>
+    computeFillBoxesOverlap(SAMRAI::hier::BoxContainer const& fill_boxes,
+                            SAMRAI::hier::BoxContainer const& node_fill_boxes,
+                            SAMRAI::hier::Box const& patch_box, SAMRAI::hier::Box const& data_box,
+                            SAMRAI::hier::PatchDataFactory const& pdf) const
+    {
+        NULL_USE(node_fill_boxes);
+
+        SAMRAI::hier::Transformation transformation(
+            SAMRAI::hier::IntVector::getZero(patch_box.getDim()));
+
+        SAMRAI::hier::BoxContainer overlap_boxes(fill_boxes);
+        overlap_boxes.intersectBoxes(data_box);
+        return pdf.getBoxGeometry(patch_box)->setUpOverlap(overlap_boxes, transformation);
+    }
+};
+
+} // namespace PHARE::amr
+
+#endif
@@ -17,6 +17,8 @@
 #include <SAMRAI/hier/RefineOperator.h>
 #include <SAMRAI/pdat/CellOverlap.h>
 
+#include <vector>
+#include <algorithm>
 #include <functional>
 
 
@@ -57,6 +59,7 @@ namespace amr
         static constexpr auto dim           = Splitter::dimension;
         static constexpr auto interpOrder   = Splitter::interp_order;
         static constexpr auto nbRefinedPart = Splitter::nbRefinedPart;
+        using Particle_t                    = typename ParticleArray::value_type;
 
         ParticlesRefineOperator()
             : SAMRAI::hier::RefineOperator{"ParticlesDataSplit_" + splitName_(splitType)}
@@ -162,90 +165,70 @@ namespace amr
             auto& destCoarseBoundaryNewParticles = destParticlesData.levelGhostParticlesNew;
 
 
-            // We get the source box that contains ghost region in order to get local index later
-            // same for destinationGhostBox and destinationDomainBox the later will allow to get an
-            // index relative to the interior
+            // the destination array is known at compile time from the split type
+            auto& destParticles = [&]() -> auto& {
+                if constexpr (splitType == ParticlesDataSplitType::coarseBoundary)
+                    return destCoarseBoundaryParticles;
+                else if constexpr (splitType == ParticlesDataSplitType::coarseBoundaryOld)
+                    return destCoarseBoundaryOldParticles;
+                else if constexpr (splitType == ParticlesDataSplitType::coarseBoundaryNew)
+                    return destCoarseBoundaryNewParticles;
+                else
+                    return destDomainParticles;
+            }();
 
             Splitter split;
 
+            // coarse particles to split, on the refined grid, and their children
+            // these are reused for all destination boxes
+            std::vector<Particle_t> candidates;
+            std::vector<Particle_t> refinedParticles;
+
             // The PatchLevelFillPattern had compute boxes that correspond to the expected filling.
             // In case of a coarseBoundary it will most likely give multiple boxes
             // in case of interior, this will be just one box usually
             for (auto const& destinationBox : destBoxes)
             {
                 std::array particlesArrays{&srcInteriorParticles, &srcGhostParticles};
-                auto splitBox = getSplitBox(destinationBox);
-
-                auto isInDest = [&destinationBox](auto const& particle) //
-                { return isInBox(destinationBox, particle); };
-
-
+                auto const splitBox = getSplitBox(destinationBox);
+                auto const destBox  = phare_box_from<dim>(destinationBox);
+                auto const fineBox  = phare_box_from<dim>(splitBox);
+
+                // only coarse particles in cells covering the split box can have their refined
+                // position in it, the cellmap of the source arrays gives them directly
+                auto coarseSplitBox = splitBox;
+                coarseSplitBox.coarsen(
+                    SAMRAI::hier::IntVector{splitBox.getDim(), static_cast<int>(refinementRatio)});
+                auto const coarseBox = phare_box_from<dim>(coarseSplitBox);
+
+                candidates.clear();
                 for (auto const& sourceParticlesArray : particlesArrays)
                 {
-                    for (auto const& particle : *sourceParticlesArray)
-                    {
-                        std::array<typename ParticleArray::value_type, nbRefinedPart>
-                            refinedParticles;
-                        auto particleRefinedPos = toFineGrid<interpOrder>(particle);
-
-                        if (isInBox(splitBox, particleRefinedPos))
-                        {
-                            split(particleRefinedPos, refinedParticles);
-
-
-                            // we need to know in which of interior or levelGhostParticlesXXXX
-                            // arrays we must put particles
-
-                            bool constexpr putParticlesInCoarseBoundary
-                                = splitType == ParticlesDataSplitType::coarseBoundary
-                                  || splitType == ParticlesDataSplitType::coarseBoundaryOld
-                                  || splitType == ParticlesDataSplitType::coarseBoundaryNew;
-
-
-
-                            if constexpr (putParticlesInCoarseBoundary)
-                            {
-                                if constexpr (splitType == ParticlesDataSplitType::coarseBoundary)
-                                {
-                                    /*std::cout << "copying " << refinedParticles.size()
-                                              << " particles into levelGhost\n";*/
-                                    std::copy_if(
-                                        std::begin(refinedParticles), std::end(refinedParticles),
-                                        std::back_inserter(destCoarseBoundaryParticles), isInDest);
-                                }
-                                else if constexpr (splitType
-                                                   == ParticlesDataSplitType::coarseBoundaryOld)
-                                {
-                                    /*std::cout << "copying " << refinedParticles.size()
-                                              << " particles into levelGhostOld\n";*/
-                                    std::copy_if(std::begin(refinedParticles),
-                                                 std::end(refinedParticles),
-                                                 std::back_inserter(destCoarseBoundaryOldParticles),
-                                                 isInDest);
-                                }
-                                else //  splitType is coarseBoundaryNew
-                                {
-                                    /*std::cout << "copying " << refinedParticles.size()
-                                              << " particles into levelGhostNew\n";*/
-                                    std::copy_if(std::begin(refinedParticles),
-                                                 std::end(refinedParticles),
-                                                 std::back_inserter(destCoarseBoundaryNewParticles),
-                                                 isInDest);
-                                }
-                            }
-
-                            else
-                            {
-                                /*std::cout << "copying " << refinedParticles.size()
-                                          << " particles into domain\n";*/
-                                std::copy_if(std::begin(refinedParticles),
-                                             std::end(refinedParticles),
-                                             std::back_inserter(destDomainParticles), isInDest);
-                            }
-                        } // end is candidate for split
-                    }     // end loop on particles
-                }         // end loop on source particle arrays
-            }             // loop on destination box
+                    if (auto const overlap = coarseBox * sourceParticlesArray->box())
+                        sourceParticlesArray->export_particles(
+                            *overlap, candidates,
+                            [](auto const& particle) { return toFineGrid<interpOrder>(particle); });
+                }
+
+                auto const notInSplitBox = [&fineBox](auto const& particle) {
+                    return !core::isIn(core::Point{particle.iCell}, fineBox);
+                };
+                candidates.erase(
+                    std::remove_if(std::begin(candidates), std::end(candidates), notInSplitBox),
+                    std::end(candidates));
+
+                split.splitBatch(candidates, refinedParticles);
+
+                auto const isInDest = [&destBox](auto const& particle) {
+                    return core::isIn(core::Point{particle.iCell}, destBox);
+                };
+                auto const nbrRefinedInDest = static_cast<std::size_t>(std::count_if(
+                    std::begin(refinedParticles), std::end(refinedParticles), isInDest));
+                destParticles.reserve(destParticles.size() + nbrRefinedInDest);
+                for (auto const& particle : refinedParticles)
+                    if (isInDest(particle))
+                        destParticles.push_back(particle);
+            } // loop on destination box
         }
 
 
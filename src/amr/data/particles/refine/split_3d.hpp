@@ -0,0 +1,337 @@
+/*
+Splitting reference material can be found @
+  https://github.com/PHAREHUB/PHARE/wiki/SplitPattern
+*/
+
+#ifndef PHARE_SPLIT_3D_HPP
+#define PHARE_SPLIT_3D_HPP
+
+#include <array>
+#include <cstddef>
+#include "core/utilities/point/point.hpp"
+#include "core/utilities/types.hpp"
+#include "splitter.hpp"
+#include "split_1d.hpp"
+
+namespace PHARE::amr
+{
+using namespace PHARE::core;
+
+/*
+  3D deltas minimize the L2 distance between the coarse particle shape function and the sum of
+  the weighted shape functions of its children, as for 1D and 2D. The 27 particles pattern is
+  the tensor product of the 3 particles 1D pattern of the same interpolation order, it has its
+  delta and its weights are products of the 1D weights, see tensorProductWeights.
+*/
+
+
+/** tensorProductWeights gives the weights of the tensor product of a 3 particles 1D pattern,
+ * the i-th weight being the one of the children with i non zero coordinates, which is the
+ * order of the Black, Pink, Lime and Purple patterns.
+ */
+template<typename Splitter1D>
+constexpr std::array<float, 4> tensorProductWeights()
+{
+    auto const& w = Splitter1D::weight;
+    return {w[0] * w[0] * w[0], w[0] * w[0] * w[1], w[0] * w[1] * w[1], w[1] * w[1] * w[1]};
+}
+
+/**************************************************************************/
+template<>
+struct PurpleDispatcher<DimConst<3>> : SplitPattern<DimConst<3>, RefinedParticlesConst<8>>
+{
+    using Super = SplitPattern<DimConst<3>, RefinedParticlesConst<8>>;
+
+    constexpr PurpleDispatcher(float const weight, float const delta)
+        : Super{weight}
+    {
+        for (std::size_t i = 0; i < 8; i++)
+        {
+            Super::deltas_[i] = {(i & 4) ? +delta : -delta, (i & 2) ? +delta : -delta,
+                                 (i & 1) ? +delta : -delta};
+        }
+    }
+};
+
+
+template<>
+struct PinkDispatcher<DimConst<3>> : SplitPattern<DimConst<3>, RefinedParticlesConst<6>>
+{
+    using Super = SplitPattern<DimConst<3>, RefinedParticlesConst<6>>;
+
+    constexpr PinkDispatcher(float const weight, float const delta)
+        : Super{weight}
+    {
+        Super::deltas_[0] = {0.0f, 0.0f, -delta};
+        Super::deltas_[1] = {0.0f, -delta, 0.0f};
+        Super::deltas_[2] = {-delta, 0.0f, 0.0f};
+        Super::deltas_[3] = {+delta, 0.0f, 0.0f};
+        Super::deltas_[4] = {0.0f, +delta, 0.0f};
+        Super::deltas_[5] = {0.0f, 0.0f, +delta};
+    }
+};
+
+
+template<>
+struct LimeDispatcher<DimConst<3>> : SplitPattern<DimConst<3>, RefinedParticlesConst<12>>
+{
+    using Super = SplitPattern<DimConst<3>, RefinedParticlesConst<12>>;
+
+    constexpr LimeDispatcher(float const weight, float const delta)
+        : Super{weight}
+    {
+        // the 4 edges of each plane x = 0, y = 0 and z = 0
+        for (std::size_t i = 0; i < 4; i++)
+        {
+            float const a = (i & 2) ? +delta : -delta;
+            float const b = (i & 1) ? +delta : -delta;
+
+            Super::deltas_[i]     = {0.0f, a, b};
+            Super::deltas_[4 + i] = {a, 0.0f, b};
+            Super::deltas_[8 + i] = {a, b, 0.0f};
+        }
+    }
+};
+
+
+/**************************************************************************/
+using SplitPattern_3_1_6_Dispatcher = PatternDispatcher<PinkDispatcher<DimConst<3>>>;
+
+template<>
+struct Splitter<DimConst<3>, InterpConst<1>, RefinedParticlesConst<6>>
+    : public ASplitter<DimConst<3>, InterpConst<1>, RefinedParticlesConst<6>>,
+      SplitPattern_3_1_6_Dispatcher
+{
+    constexpr Splitter()
+        : SplitPattern_3_1_6_Dispatcher{{weight[0], delta[0]}}
+    {
+    }
+
+    static constexpr std::array<float, 1> delta  = {0.967890};
+    static constexpr std::array<float, 1> weight = {1. / 6};
+};
+
+
+/**************************************************************************/
+using SplitPattern_3_1_8_Dispatcher = PatternDispatcher<PurpleDispatcher<DimConst<3>>>;
+
+template<>
+struct Splitter<DimConst<3>, InterpConst<1>, RefinedParticlesConst<8>>
+    : public ASplitter<DimConst<3>, InterpConst<1>, RefinedParticlesConst<8>>,
+      SplitPattern_3_1_8_Dispatcher
+{
+    constexpr Splitter()
+        : SplitPattern_3_1_8_Dispatcher{{weight[0], delta[0]}}
+    {
+    }
+
+    static constexpr std::array<float, 1> delta  = {0.584790};
+    static constexpr std::array<float, 1> weight = {0.125};
+};
+
+
+/**************************************************************************/
+using SplitPattern_3_1_12_Dispatcher = PatternDispatcher<LimeDispatcher<DimConst<3>>>;
+
+template<>
+struct Splitter<DimConst<3>, InterpConst<1>, RefinedParticlesConst<12>>
+    : public ASplitter<DimConst<3>, InterpConst<1>, RefinedParticlesConst<12>>,
+      SplitPattern_3_1_12_Dispatcher
+{
+    constexpr Splitter()
+        : SplitPattern_3_1_12_Dispatcher{{weight[0], delta[0]}}
+    {
+    }
+
+    static constexpr std::array<float, 1> delta  = {0.751170};
+    static constexpr std::array<float, 1> weight = {1. / 12};
+};
+
+
+/**************************************************************************/
+using SplitPattern_3_1_27_Dispatcher
+    = PatternDispatcher<BlackDispatcher<DimConst<3>>, PinkDispatcher<DimConst<3>>,
+                        LimeDispatcher<DimConst<3>>, PurpleDispatcher<DimConst<3>>>;
+
+template<>
+struct Splitter<DimConst<3>, InterpConst<1>, RefinedParticlesConst<27>>
+    : public ASplitter<DimConst<3>, InterpConst<1>, RefinedParticlesConst<27>>,
+      SplitPattern_3_1_27_Dispatcher
+{
+    constexpr Splitter()
+        : SplitPattern_3_1_27_Dispatcher{{weight[0]},
+                                         {weight[1], delta[0]},
+                                         {weight[2], delta[0]},
+                                         {weight[3], delta[0]}}
+    {
+    }
+
+    using Splitter1D = Splitter<DimConst<1>, InterpConst<1>, RefinedParticlesConst<3>>;
+
+    static constexpr std::array<float, 1> delta  = Splitter1D::delta;
+    static constexpr std::array<float, 4> weight = tensorProductWeights<Splitter1D>();
+};
+
+
+/**************************************************************************/
+using SplitPattern_3_2_6_Dispatcher = PatternDispatcher<PinkDispatcher<DimConst<3>>>;
+
+template<>
+struct Splitter<DimConst<3>, InterpConst<2>, RefinedParticlesConst<6>>
+    : public ASplitter<DimConst<3>, InterpConst<2>, RefinedParticlesConst<6>>,
+      SplitPattern_3_2_6_Dispatcher
+{
+    constexpr Splitter()
+        : SplitPattern_3_2_6_Dispatcher{{weight[0], delta[0]}}
+    {
+    }
+
+    static constexpr std::array<float, 1> delta  = {1.149640};
+    static constexpr std::array<float, 1> weight = {1. / 6};
+};
+
+
+/**************************************************************************/
+using SplitPattern_3_2_8_Dispatcher = PatternDispatcher<PurpleDispatcher<DimConst<3>>>;
+
+template<>
+struct Splitter<DimConst<3>, InterpConst<2>, RefinedParticlesConst<8>>
+    : public ASplitter<DimConst<3>, InterpConst<2>, RefinedParticlesConst<8>>,
+      SplitPattern_3_2_8_Dispatcher
+{
+    constexpr Splitter()
+        : SplitPattern_3_2_8_Dispatcher{{weight[0], delta[0]}}
+    {
+    }
+
+    static constexpr std::array<float, 1> delta  = {0.700790};
+    static constexpr std::array<float, 1> weight = {0.125};
+};
+
+
+/**************************************************************************/
+using SplitPattern_3_2_12_Dispatcher = PatternDispatcher<LimeDispatcher<DimConst<3>>>;
+
+template<>
+struct Splitter<DimConst<3>, InterpConst<2>, RefinedParticlesConst<12>>
+    : public ASplitter<DimConst<3>, InterpConst<2>, RefinedParticlesConst<12>>,
+      SplitPattern_3_2_12_Dispatcher
+{
+    constexpr Splitter()
+        : SplitPattern_3_2_12_Dispatcher{{weight[0], delta[0]}}
+    {
+    }
+
+    static constexpr std::array<float, 1> delta  = {0.888210};
+    static constexpr std::array<float, 1> weight = {1. / 12};
+};
+
+
+/**************************************************************************/
+using SplitPattern_3_2_27_Dispatcher
+    = PatternDispatcher<BlackDispatcher<DimConst<3>>, PinkDispatcher<DimConst<3>>,
+                        LimeDispatcher<DimConst<3>>, PurpleDispatcher<DimConst<3>>>;
+
+template<>
+struct Splitter<DimConst<3>, InterpConst<2>, RefinedParticlesConst<27>>
+    : public ASplitter<DimConst<3>, InterpConst<2>, RefinedParticlesConst<27>>,
+      SplitPattern_3_2_27_Dispatcher
+{
+    constexpr Splitter()
+        : SplitPattern_3_2_27_Dispatcher{{weight[0]},
+                                         {weight[1], delta[0]},
+                                         {weight[2], delta[0]},
+                                         {weight[3], delta[0]}}
+    {
+    }
+
+    using Splitter1D = Splitter<DimConst<1>, InterpConst<2>, RefinedParticlesConst<3>>;
+
+    static constexpr std::array<float, 1> delta  = Splitter1D::delta;
+    static constexpr std::array<float, 4> weight = tensorProductWeights<Splitter1D>();
+};
+
+
+/**************************************************************************/
+using SplitPattern_3_3_6_Dispatcher = PatternDispatcher<PinkDispatcher<DimConst<3>>>;
+
+template<>
+struct Splitter<DimConst<3>, InterpConst<3>, RefinedParticlesConst<6>>
+    : public ASplitter<DimConst<3>, InterpConst<3>, RefinedParticlesConst<6>>,
+      SplitPattern_3_3_6_Dispatcher
+{
+    constexpr Splitter()
+        : SplitPattern_3_3_6_Dispatcher{{weight[0], delta[0]}}
+    {
+    }
+
+    static constexpr std::array<float, 1> delta  = {1.312680};
+    static constexpr std::array<float, 1> weight = {1. / 6};
+};
+
+
+/**************************************************************************/
+using SplitPattern_3_3_8_Dispatcher = PatternDispatcher<PurpleDispatcher<DimConst<3>>>;
+
+template<>
+struct Splitter<DimConst<3>, InterpConst<3>, RefinedParticlesConst<8>>
+    : public ASplitter<DimConst<3>, InterpConst<3>, RefinedParticlesConst<8>>,
+      SplitPattern_3_3_8_Dispatcher
+{
+    constexpr Splitter()
+        : SplitPattern_3_3_8_Dispatcher{{weight[0], delta[0]}}
+    {
+    }
+
+    static constexpr std::array<float, 1> delta  = {0.797190};
+    static constexpr std::array<float, 1> weight = {0.125};
+};
+
+
+/**************************************************************************/
+using SplitPattern_3_3_12_Dispatcher = PatternDispatcher<LimeDispatcher<DimConst<3>>>;
+
+template<>
+struct Splitter<DimConst<3>, InterpConst<3>, RefinedParticlesConst<12>>
+    : public ASplitter<DimConst<3>, InterpConst<3>, RefinedParticlesConst<12>>,
+      SplitPattern_3_3_12_Dispatcher
+{
+    constexpr Splitter()
+        : SplitPattern_3_3_12_Dispatcher{{weight[0], delta[0]}}
+    {
+    }
+
+    static constexpr std::array<float, 1> delta  = {1.012780};
+    static constexpr std::array<float, 1> weight = {1. / 12};
+};
+
+
+/**************************************************************************/
+using SplitPattern_3_3_27_Dispatcher
+    = PatternDispatcher<BlackDispatcher<DimConst<3>>, PinkDispatcher<DimConst<3>>,
+                        LimeDispatcher<DimConst<3>>, PurpleDispatcher<DimConst<3>>>;
+
+template<>
+struct Splitter<DimConst<3>, InterpConst<3>, RefinedParticlesConst<27>>
+    : public ASplitter<DimConst<3>, InterpConst<3>, RefinedParticlesConst<27>>,
+      SplitPattern_3_3_27_Dispatcher
+{
+    constexpr Splitter()
+        : SplitPattern_3_3_27_Dispatcher{{weight[0]},
+                                         {weight[1], delta[0]},
+                                         {weight[2], delta[0]},
+                                         {weight[3], delta[0]}}
+    {
+    }
+
+    using Splitter1D = Splitter<DimConst<1>, InterpConst<3>, RefinedParticlesConst<3>>;
+
+    static constexpr std::array<float, 1> delta  = Splitter1D::delta;
+    static constexpr std::array<float, 4> weight = tensorProductWeights<Splitter1D>();
+};
+
+
+} // namespace PHARE::amr
+
+
+#endif /*PHARE_SPLIT_3D_HPP*/
@@ -48,6 +48,24 @@ public:
         dispatch(coarsePartOnRefinedGrid, refinedParticles, idx);
     }
 
+    /** @brief splits all coarse particles (already on the refined grid) of a batch, the
+     * nbRefinedParts children of the i-th coarse particle being written contiguously from
+     * index i * nbRefinedParts of refinedParticles, which is resized accordingly.
+     */
+    template<typename CoarseParticles, typename Particles>
+    void splitBatch(CoarseParticles const& coarsePartsOnRefinedGrid,
+                    Particles& refinedParticles) const
+    {
+        refinedParticles.resize(coarsePartsOnRefinedGrid.size() * nbRefinedParts);
+
+        size_t idx = 0;
+        for (auto const& particle : coarsePartsOnRefinedGrid)
+        {
+            dispatch(particle, refinedParticles, idx);
+            idx += nbRefinedParts;
+        }
+    }
+
     std::tuple<Patterns...> patterns{};
     size_t nbRefinedParts{0};
 
@@ -77,13 +95,20 @@ private:
                 fineParticle.delta  = particle.delta;
                 fineParticle.v      = particle.v;
 
+                // children of a tracer inherit its id, contiguous particle views have none
+                if constexpr (requires { fineParticle.id = particle.id; })
+                    fineParticle.id = particle.id;
+
                 for (size_t iDim = 0; iDim < dimension; iDim++)
                 {
                     fineParticle.delta[iDim]
                         += static_cast<Delta_t>(pattern.deltas_[rpIndex][iDim]);
-                    Delta_t integra = std::floor(fineParticle.delta[iDim]);
-                    fineParticle.delta[iDim] -= integra;
-                    fineParticle.iCell[iDim] += static_cast<int32_t>(integra);
+                    // floor without branch nor libm call, delta is a few cells at most
+                    auto const delta = fineParticle.delta[iDim];
+                    auto integra     = static_cast<int32_t>(delta);
+                    integra -= static_cast<int32_t>(delta < static_cast<Delta_t>(integra));
+                    fineParticle.delta[iDim] -= static_cast<Delta_t>(integra);
+                    fineParticle.iCell[iDim] += integra;
                 }
             }
         });
@@ -135,6 +160,10 @@ template<typename dim>
 struct PinkDispatcher
 {
 };
+template<typename dim>
+struct LimeDispatcher
+{
+};
 
 } // namespace PHARE::amr
 
@@ -59,6 +59,7 @@ namespace solver
             {
                 PHARE_LOG_LINE_STR("regriding level " + std::to_string(levelNumber));
                 PHARE_LOG_START(3, "hybridLevelInitializer::initialize : regriding block");
+                hybridModel.erasePatchTimes(levelNumber);
                 messenger.regrid(hierarchy, levelNumber, oldLevel, model, initDataTime);
                 PHARE_LOG_STOP(3, "hybridLevelInitializer::initialize : regriding block");
             }
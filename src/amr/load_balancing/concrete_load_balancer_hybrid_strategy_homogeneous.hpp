@@ -34,6 +34,12 @@ public:
 
     void compute(level_t& level, PHARE::solver::IPhysicalModel<amr_types>& model) override;
 
+    // the workload does not depend on the particles
+    void computeInitial(level_t& level, PHARE::solver::IPhysicalModel<amr_types>& model) override
+    {
+        compute(level, model);
+    }
+
 
 private:
     int const id_;
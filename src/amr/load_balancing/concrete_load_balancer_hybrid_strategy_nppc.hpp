@@ -6,11 +6,14 @@
 #include <SAMRAI/hier/PatchLevel.h>
 #include <SAMRAI/pdat/CellData.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "core/logger.hpp"
 #include "core/utilities/types.hpp"
 #include "core/data/ndarray/ndarray_vector.hpp"
+#include "core/data/ions/particle_initializers/particle_initializer.hpp"
 
 #include "amr/types/amr_types.hpp"
 #include "amr/load_balancing/load_balancer_hybrid_strategy.hpp"
@@ -39,6 +42,11 @@ public:
 
     void compute(level_t& level, PHARE::solver::IPhysicalModel<amr_types>& model) override;
 
+    /* the number of particles the population initializers will load, as the domain particles
+     * of the level are not there yet, so that the root level can be partitioned before loading
+     */
+    void computeInitial(level_t& level, PHARE::solver::IPhysicalModel<amr_types>& model) override;
+
 
 private:
     int const id_;
@@ -95,6 +103,50 @@ void ConcreteLoadBalancerHybridStrategyNPPC<PHARE_T>::compute(
     // CascadePartitioner
 }
 
+
+
+template<typename PHARE_T>
+void ConcreteLoadBalancerHybridStrategyNPPC<PHARE_T>::computeInitial(
+    level_t& level, PHARE::solver::IPhysicalModel<amr_types>& model)
+{
+    bool static constexpr c_ordering = false;
+    auto static constexpr dimension  = HybridModel::dimension;
+    using ParticleInitializerFactory = typename HybridModel::ParticleInitializerFactory;
+    using ParticleInitializer_t
+        = core::ParticleInitializer<typename HybridModel::particle_array_type, gridlayout_type>;
+
+    auto& hybridModel = dynamic_cast<HybridModel&>(model);
+
+    std::vector<std::unique_ptr<ParticleInitializer_t>> initializers;
+    for (auto& pop : hybridModel.state.ions)
+        initializers.push_back(ParticleInitializerFactory::create(pop.particleInitializerInfo()));
+
+    for (auto& patch : level)
+    {
+        auto const& layout     = layoutFromPatch<gridlayout_type>(*patch);
+        auto patch_data_lb     = dynamic_cast<cell_data_t*>(patch->getPatchData(this->id_).get());
+        auto load_balancer_val = patch_data_lb->getPointer();
+        auto lb_view = core::make_array_view<c_ordering>(load_balancer_val, layout.nbrCells());
+
+        // as in compute, but the counts come in the order of the AMR box cells
+        core::Box<std::uint32_t, dimension> local_box{
+            core::Point{core::ConstArray<std::uint32_t, dimension>()},
+            core::Point{
+                core::generate([](auto const& nCell) { return nCell - 1; }, layout.nbrCells())}};
+
+        for (auto const& cell : local_box)
+            lb_view(cell) = 0;
+
+        for (auto const& initializer : initializers)
+        {
+            auto const counts = initializer->nbrParticlesPerCell(layout);
+            auto count        = counts.begin();
+            for (auto const& cell : local_box)
+                lb_view(cell) += *count++;
+        }
+    }
+}
+
 } // namespace PHARE::amr
 
 #endif
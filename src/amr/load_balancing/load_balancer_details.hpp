@@ -16,6 +16,8 @@ struct LoadBalancerDetailsDefaults
     std::size_t next_rebalance                    = 200;
     std::size_t max_next_rebalance                = 1000;
     double tolerance                              = .05;
+    std::size_t horizon                           = 100;
+    double bandwidth                              = 1e9;
 };
 
 struct LoadBalancerDetails
@@ -26,6 +28,9 @@ struct LoadBalancerDetails
     bool const automatic = false;
     bool const on_init   = false;
 
+    // partition the root level from the workload expected from the initial particle profiles
+    bool const initial_partition = false;
+
     std::size_t const every = 0;
     std::string const mode;
 
@@ -35,12 +40,19 @@ struct LoadBalancerDetails
     std::size_t next_rebalance                    = defaults.next_rebalance;
     std::size_t max_next_rebalance                = defaults.max_next_rebalance;
 
+    // rebalance when the time saved over horizon steps exceeds the migration cost
+    bool cost           = false;
+    std::size_t horizon = defaults.horizon;
+    double bandwidth    = defaults.bandwidth; // bytes per second
+    bool log            = true;               // rank 0 prints each decision
+
     LoadBalancerDetails static FROM(initializer::PHAREDict const& dict)
     {
         return {
             cppdict::get_value(dict, "active", false),
             cppdict::get_value(dict, "auto", false),
             cppdict::get_value(dict, "on_init", false),
+            cppdict::get_value(dict, "initial_partition", false),
             cppdict::get_value(dict, "every", std::size_t{0}),
             cppdict::get_value(dict, "mode", std::string{"nppc"}),
             cppdict::get_value(dict, "tolerance", defaults.tolerance),
@@ -48,6 +60,10 @@ struct LoadBalancerDetails
                                defaults.next_rebalance_backoff_multiplier),
             cppdict::get_value(dict, "next_rebalance", defaults.next_rebalance),
             cppdict::get_value(dict, "max_next_rebalance", defaults.max_next_rebalance),
+            cppdict::get_value(dict, "cost", false),
+            cppdict::get_value(dict, "horizon", defaults.horizon),
+            cppdict::get_value(dict, "bandwidth", defaults.bandwidth),
+            cppdict::get_value(dict, "log", true),
         };
     }
 };
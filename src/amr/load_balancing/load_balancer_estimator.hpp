@@ -28,6 +28,11 @@ public:
                           solver::IPhysicalModel<amr::SAMRAI_Types>& model)
         = 0;
 
+    // estimates the workload of a level before its initial data is loaded
+    virtual void estimateInitial(SAMRAI::hier::PatchLevel& level,
+                                 solver::IPhysicalModel<amr::SAMRAI_Types>& model)
+        = 0;
+
 
 protected:
     int const id_;
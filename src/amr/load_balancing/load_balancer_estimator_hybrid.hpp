@@ -36,6 +36,11 @@ public:
         strat_->compute(level, model);
     }
 
+    void estimateInitial(level_t& level, solver::IPhysicalModel<amr_types>& model) override
+    {
+        strat_->computeInitial(level, model);
+    }
+
 
 private:
     std::unique_ptr<LoadBalancerHybridStrategy<PHARE_T>> strat_;
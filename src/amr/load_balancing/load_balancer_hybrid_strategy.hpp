@@ -22,6 +22,10 @@ public:
     virtual ~LoadBalancerHybridStrategy() {}
 
     virtual void compute(level_t& level, PHARE::solver::IPhysicalModel<amr_types>& model) = 0;
+
+    // estimates the workload of a level whose particles are not loaded yet
+    virtual void computeInitial(level_t& level, PHARE::solver::IPhysicalModel<amr_types>& model)
+        = 0;
 };
 
 
@@ -49,6 +49,9 @@ public:
     void estimate(SAMRAI::hier::PatchLevel& level,
                   PHARE::solver::IPhysicalModel<PHARE::amr::SAMRAI_Types>& model);
 
+    void estimateInitial(SAMRAI::hier::PatchLevel& level,
+                         PHARE::solver::IPhysicalModel<PHARE::amr::SAMRAI_Types>& model);
+
 
 private:
     SAMRAI::tbox::Dimension dim_;
@@ -94,6 +97,16 @@ void LoadBalancerManager<dim>::estimate(
 }
 
 
+
+template<std::size_t dim>
+void LoadBalancerManager<dim>::estimateInitial(
+    SAMRAI::hier::PatchLevel& level, PHARE::solver::IPhysicalModel<PHARE::amr::SAMRAI_Types>& model)
+{
+    if (auto lbe = loadBalancerEstimators_[level.getLevelNumber()])
+        lbe->estimateInitial(level, model);
+}
+
+
 } // namespace PHARE::amr
 
 
@@ -0,0 +1,70 @@
+#ifndef PHARE_AMR_LOAD_BALANCING_REBALANCE_COST_POLICY_HPP
+#define PHARE_AMR_LOAD_BALANCING_REBALANCE_COST_POLICY_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <algorithm>
+
+
+namespace PHARE::amr
+{
+/** \brief RebalanceCostPolicy decides to rebalance when the time a rebalance is expected to save
+ * over the next horizon steps exceeds the time it is expected to cost.
+ *
+ * A step lasts as long as the most loaded rank needs, so a balanced partition saves
+ * stepTime * (1 - meanLoad / maxLoad) per step. The most loaded rank has to send at least
+ * maxLoad - meanLoad workload units, bytesPerUnit each, which costs that volume over the
+ * bandwidth, plus the overhead measured on the previous rebalance.
+ */
+struct RebalanceCostPolicy
+{
+    struct Decision
+    {
+        double imbalance      = 1; // max load over mean load
+        double migrationBytes = 0;
+        double timeSaved      = 0;
+        double migrationCost  = 0;
+        bool rebalance        = false;
+    };
+
+
+    Decision operator()(double const sumLoad, double const maxLoad, int const nbrRanks,
+                        double const stepTime) const
+    {
+        Decision decision;
+        if (nbrRanks < 2 or maxLoad <= 0 or stepTime <= 0)
+            return decision;
+
+        auto const meanLoad = sumLoad / nbrRanks;
+
+        decision.imbalance      = maxLoad / meanLoad;
+        decision.migrationBytes = (maxLoad - meanLoad) * bytesPerUnit;
+        decision.timeSaved      = horizon * stepTime * (1 - meanLoad / maxLoad);
+        decision.migrationCost  = decision.migrationBytes / bandwidth + overhead;
+        decision.rebalance      = decision.timeSaved > decision.migrationCost;
+
+        return decision;
+    }
+
+
+    std::size_t horizon = 100;
+    double bandwidth    = 1e9; // bytes per second
+    double bytesPerUnit = 0;
+
+    // measured time a rebalancing step took above a regular step, in seconds
+    double overhead = 0;
+};
+
+
+
+inline std::ostream& operator<<(std::ostream& os, RebalanceCostPolicy::Decision const& decision)
+{
+    os << "imbalance " << decision.imbalance << ", migration " << decision.migrationBytes
+       << " bytes, saves " << decision.timeSaved << "s for " << decision.migrationCost
+       << "s: " << (decision.rebalance ? "rebalance" : "keep");
+    return os;
+}
+
+} // namespace PHARE::amr
+
+#endif /* PHARE_AMR_LOAD_BALANCING_REBALANCE_COST_POLICY_HPP */
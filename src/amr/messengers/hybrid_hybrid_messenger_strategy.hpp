@@ -22,6 +22,7 @@
 #include "amr/resources_manager/amr_utils.hpp"
 
 #include "core/numerics/interpolator/interpolator.hpp"
+#include "core/numerics/moments/moments.hpp"
 #include "core/hybrid/hybrid_quantities.hpp"
 #include "core/data/particles/particle_array.hpp"
 #include "core/data/vecfield/vecfield_component.hpp"
@@ -35,6 +36,7 @@
 
 
 #include <iterator>
+#include <vector>
 #include <optional>
 #include <utility>
 #include <iomanip>
@@ -162,6 +164,7 @@ namespace amr
             velGhostsRefiners_.registerLevel(hierarchy, level);
 
             patchGhostPartRefiners_.registerLevel(hierarchy, level);
+            leavingPartRefiners_.registerLevel(hierarchy, level);
 
 
             // root level is not initialized with a schedule using coarser level data
@@ -172,6 +175,7 @@ namespace amr
                 // those are for refinement
                 magneticInitRefiners_.registerLevel(hierarchy, level);
                 electricInitRefiners_.registerLevel(hierarchy, level);
+                timeAverageInitRefiners_.registerLevel(hierarchy, level);
                 domainParticlesRefiners_.registerLevel(hierarchy, level);
                 lvlGhostPartOldRefiners_.registerLevel(hierarchy, level);
                 lvlGhostPartNewRefiners_.registerLevel(hierarchy, level);
@@ -200,9 +204,24 @@ namespace amr
 
             bool isRegriddingL0 = levelNumber == 0 and oldLevel;
 
-            magneticInitRefiners_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
-            electricInitRefiners_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
-            domainParticlesRefiners_.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
+            // patches that have the same box as an old level patch of this rank take its model
+            // data by pointer, regrid schedules only fill the other patches. Solver and
+            // messenger data are not moved, they are set by their owner on all patches.
+            auto const unchangedBoxes = moveUnchangedPatchData(
+                *level, *oldLevel, resourcesManager_->getIDs(hybridModel));
+
+            magneticInitRefiners_.regrid(hierarchy, levelNumber, oldLevel, initDataTime,
+                                         unchangedBoxes);
+            electricInitRefiners_.regrid(hierarchy, levelNumber, oldLevel, initDataTime,
+                                         unchangedBoxes);
+            timeAverageInitRefiners_.regrid(hierarchy, levelNumber, oldLevel, initDataTime,
+                                            unchangedBoxes);
+            domainParticlesRefiners_.regrid(hierarchy, levelNumber, oldLevel, initDataTime,
+                                            unchangedBoxes);
+
+            // the old level is not read anymore, the ghost particles it shares with unchanged
+            // patches can be emptied to be filled again below like on new patches
+            emptyGhostParticles_(*level, unchangedBoxes, model);
             patchGhostPartRefiners_.fill(levelNumber, initDataTime);
 
 
@@ -274,6 +293,7 @@ namespace amr
 
             magneticInitRefiners_.fill(levelNumber, initDataTime);
             electricInitRefiners_.fill(levelNumber, initDataTime);
+            timeAverageInitRefiners_.fill(levelNumber, initDataTime);
 
             // no need to call these :
             // magGhostsRefiners_.fill(levelNumber, initDataTime);
@@ -330,6 +350,41 @@ namespace amr
 
 
 
+        /**
+         * @brief fillIonEnteringParticles gives each patch the particles that left the domain of
+         * its neighbors of the same level during the last push and entered its own domain.
+         * Received particles are appended to the domain particles and their moments deposited.
+         * The leaving particle arrays are emptied afterwards.
+         */
+        void fillIonEnteringParticles(IonsT& ions, SAMRAI::hier::PatchLevel& level,
+                                      double const fillTime) override
+        {
+            PHARE_LOG_SCOPE(1, "HybridHybridMessengerStrategy::fillIonEnteringParticles");
+
+            std::vector<std::size_t> domainSizes;
+            for (auto patch : level)
+            {
+                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+                for (auto& pop : ions)
+                    domainSizes.push_back(pop.domainParticles().size());
+            }
+
+            leavingPartRefiners_.fill(level.getLevelNumber(), fillTime);
+
+            auto domainSize = std::begin(domainSizes);
+            for (auto patch : level)
+            {
+                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+                auto layout      = layoutFromPatch<GridLayoutT>(*patch);
+
+                for (auto& pop : ions)
+                    core::depositEnteringParticles(pop, *domainSize++, layout);
+            }
+        }
+
+
+
+
         /**
          * @brief fillIonGhostParticles will fill the interior ghost particle array from
          * neighbor patches of the same level. Before doing that, it empties the array for
@@ -461,7 +516,14 @@ namespace amr
          * the method moves levelGhostParticlesNew particles into levelGhostParticlesOld
          * ones. Then levelGhostParticlesNew are emptied since it will be filled again at
          * firstStep of the next substepping cycle. the new CoarseToFineOld content is then
-         * copied to levelGhostParticles so that they can be pushed during the next subcycle
+         * copied to levelGhostParticles so that they can be pushed during the next subcycle.
+         * Arrays are swapped with their cellmaps and the copy takes the cellmap along, so no
+         * particle is mapped again here.
+         * The copy cannot be a swap: levelGhostParticlesOld has to stay as it was at the
+         * coarse time for the whole next cycle, since ghost moments are time interpolated from
+         * it at each substep, while levelGhostParticles is pushed in place by the ion updater.
+         * The copy reuses the capacity of levelGhostParticles, and of its cellmap, so it does
+         * not allocate once the level ghost layer has its size.
          */
         void lastStep(IPhysicalModel& model, SAMRAI::hier::PatchLevel& level) override
         {
@@ -482,10 +544,7 @@ namespace amr
 
                         core::swap(levelGhostParticlesNew, levelGhostParticlesOld);
                         core::empty(levelGhostParticlesNew);
-                        core::empty(levelGhostParticles);
-                        std::copy(std::begin(levelGhostParticlesOld),
-                                  std::end(levelGhostParticlesOld),
-                                  std::back_inserter(levelGhostParticles));
+                        levelGhostParticles.replace_from(levelGhostParticlesOld);
 
                         if (level.getLevelNumber() == 0)
                         {
@@ -685,6 +744,9 @@ namespace amr
             electricInitRefiners_.addStaticRefiners(info->initElectric, EfieldRefineOp_,
                                                     makeKeys(info->initElectric));
 
+            timeAverageInitRefiners_.addStaticRefiners(info->initTimeAverages, fieldRefineOp_,
+                                                       info->initTimeAverages);
+
 
             domainParticlesRefiners_.addStaticRefiners(
                 info->interiorParticles, interiorParticleRefineOp_, info->interiorParticles);
@@ -702,6 +764,9 @@ namespace amr
 
             patchGhostPartRefiners_.addStaticRefiners(info->patchGhostParticles, nullptr,
                                                       info->patchGhostParticles);
+
+            leavingPartRefiners_.addStaticRefiners(info->patchGhostParticles, nullptr,
+                                                   info->patchGhostParticles);
         }
 
 
@@ -725,6 +790,29 @@ namespace amr
 
 
 
+        void emptyGhostParticles_(SAMRAI::hier::PatchLevel& level,
+                                  SAMRAI::hier::BoxContainer const& boxes, IPhysicalModel& model)
+        {
+            auto& hybridModel = static_cast<HybridModel&>(model);
+            for (auto& patch : level)
+            {
+                if (!containsBox(boxes, patch->getBox()))
+                    continue;
+
+                auto& ions       = hybridModel.state.ions;
+                auto dataOnPatch = resourcesManager_->setOnPatch(*patch, ions);
+                for (auto& pop : ions)
+                {
+                    core::empty(pop.patchGhostParticles());
+                    core::empty(pop.levelGhostParticles());
+                    core::empty(pop.levelGhostParticlesOld());
+                    core::empty(pop.levelGhostParticlesNew());
+                }
+            }
+        }
+
+
+
         void copyLevelGhostOldToPushable_(SAMRAI::hier::PatchLevel& level, IPhysicalModel& model)
         {
             auto& hybridModel = static_cast<HybridModel&>(model);
@@ -737,9 +825,7 @@ namespace amr
                     auto& levelGhostParticlesOld = pop.levelGhostParticlesOld();
                     auto& levelGhostParticles    = pop.levelGhostParticles();
 
-                    core::empty(levelGhostParticles);
-                    std::copy(std::begin(levelGhostParticlesOld), std::end(levelGhostParticlesOld),
-                              std::back_inserter(levelGhostParticles));
+                    levelGhostParticles.replace_from(levelGhostParticlesOld);
                 }
             }
         }
@@ -1003,9 +1089,12 @@ namespace amr
         using PatchGhostRefinerPool     = RefinerPool<rm_t, RefinerType::PatchGhostField>;
         using InitDomPartRefinerPool    = RefinerPool<rm_t, RefinerType::InitInteriorPart>;
         using PatchGhostPartRefinerPool = RefinerPool<rm_t, RefinerType::InteriorGhostParticles>;
+        using LeavingPartRefinerPool    = RefinerPool<rm_t, RefinerType::LeavingParticles>;
 
         InitRefinerPool magneticInitRefiners_{resourcesManager_};
         InitRefinerPool electricInitRefiners_{resourcesManager_};
+        // sums of the time_average diagnostics, so that new patches carry the sums of the area
+        InitRefinerPool timeAverageInitRefiners_{resourcesManager_};
 
         //! store communicators for magnetic fields that need ghosts to be filled
         SharedNodeRefinerPool magSharedNodesRefiners_{resourcesManager_};
@@ -1050,6 +1139,10 @@ namespace amr
         // this contains refiners for each population to exchange patch ghost particles
         PatchGhostPartRefinerPool patchGhostPartRefiners_{resourcesManager_};
 
+        // refiners giving to each patch the particles its neighbors pushed into its domain,
+        // used when patch ghost particles are not pushed
+        LeavingPartRefinerPool leavingPartRefiners_{resourcesManager_};
+
         SynchronizerPool<rm_t> densitySynchronizers_{resourcesManager_};
         SynchronizerPool<rm_t> ionBulkVelSynchronizers_{resourcesManager_};
         SynchronizerPool<rm_t> electroSynchronizers_{resourcesManager_};
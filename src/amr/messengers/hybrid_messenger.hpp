@@ -43,6 +43,7 @@ namespace amr
      * Ghost filling methods tuned for Hybrid quantities:
      *
      * - fillElectricGhosts()
+     * - fillIonEnteringParticles()
      * - fillIonGhostParticles()
      * - fillIonMomentGhosts()
      *
@@ -292,6 +293,23 @@ namespace amr
 
 
 
+        /**
+         * @brief fillIonEnteringParticles is called by a ISolver solving hybrid equations, when
+         * patch ghost particles are not pushed, to give each patch the domain particles that
+         * entered it from neighbor patches of the same level, and deposit their moments.
+         * It must be called before fillIonGhostParticles.
+         * @param ions for which entering particles will be received
+         * @param level
+         * @param fillTime
+         */
+        void fillIonEnteringParticles(IonsT& ions, SAMRAI::hier::PatchLevel& level,
+                                      double const fillTime)
+        {
+            strat_->fillIonEnteringParticles(ions, level, fillTime);
+        }
+
+
+
         /**
          * @brief fillIonGhostParticles is called by a ISolver solving hybrid equations to fill the
          * ghosts particles
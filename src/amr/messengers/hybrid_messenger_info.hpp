@@ -51,6 +51,9 @@ namespace amr
         std::vector<VecFieldNames> initMagnetic;
         std::vector<VecFieldNames> initElectric;
 
+        // names of the sums of time averaged diagnostics, initialized like EM fields
+        std::vector<std::string> initTimeAverages;
+
         // below are the names of the populations that need to be communicated
         // this is for initialization
         std::vector<std::string> interiorParticles;
@@ -75,6 +75,11 @@ namespace amr
             = 0;
 
 
+        virtual void fillIonEnteringParticles(IonsT& ions, SAMRAI::hier::PatchLevel& level,
+                                              double const fillTime)
+            = 0;
+
+
         virtual void fillIonGhostParticles(IonsT& ions, SAMRAI::hier::PatchLevel& level,
                                            double const fillTime)
             = 0;
@@ -94,6 +94,11 @@ namespace amr
         {
         }
 
+        void fillIonEnteringParticles(IonsT& /*ions*/, SAMRAI::hier::PatchLevel& /*level*/,
+                                      double const /*fillTime*/) override
+        {
+        }
+
         void fillIonGhostParticles(IonsT& /*ions*/, SAMRAI::hier::PatchLevel& /*level*/,
                                    double const /*fillTime*/) override
         {
@@ -5,6 +5,8 @@
 #include "core/data/vecfield/vecfield.hpp"
 
 #include "amr/data/field/field_variable_fill_pattern.hpp"
+#include "amr/data/particles/particles_variable_fill_pattern.hpp"
+#include "amr/messengers/regrid_fill_pattern.hpp"
 
 namespace PHARE::amr
 {
@@ -16,6 +18,7 @@ enum class RefinerType {
     InitInteriorPart,
     LevelBorderParticles,
     InteriorGhostParticles,
+    LeavingParticles,
     SharedBorder
 };
 
@@ -114,6 +117,13 @@ public:
                 this->add(algo, algo->createSchedule(level), levelNumber);
             }
 
+            // this branch is used to create a schedule that will give to each patch the
+            // domain particles its neighbors pushed into it, see LeavingParticlesFillPattern
+            else if constexpr (Type == RefinerType::LeavingParticles)
+            {
+                this->add(algo, algo->createSchedule(level), levelNumber);
+            }
+
             // schedule to synchronize shared border values, and not include refinement
             else if constexpr (Type == RefinerType::SharedBorder)
             {
@@ -124,10 +134,20 @@ public:
 
 
 
+    /**
+     * @brief regrid fills the new level from the old level where they overlap and from the
+     * next coarser level elsewhere. Patches whose box is in unchangedBoxes already hold their
+     * old level data and are left untouched, see RegridFillPattern.
+     */
     void regrid(std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& hierarchy,
                 const int levelNumber, std::shared_ptr<SAMRAI::hier::PatchLevel> const& oldLevel,
-                double const initDataTime)
+                double const initDataTime,
+                SAMRAI::hier::BoxContainer const& unchangedBoxes = SAMRAI::hier::BoxContainer{})
     {
+        // overlaps are computed at schedule creation, the unchanged boxes are reset once the
+        // regrid schedules are created so that they do not alter schedules created later
+        regridFillPattern_->setUnchangedBoxes(unchangedBoxes);
+
         for (auto& algo : this->algos)
         {
             auto const& level = hierarchy->getPatchLevel(levelNumber);
@@ -146,6 +166,8 @@ public:
                 schedule->fillData(initDataTime);
             }
         }
+
+        regridFillPattern_->setUnchangedBoxes(SAMRAI::hier::BoxContainer{});
     }
 
 
@@ -286,6 +308,9 @@ public:
                                     or Type == RefinerType::SharedBorder)
                           this->add_algorithm()->registerRefine(*idDest, *idSrc, *idDest, refineOp,
                                                                 fillPattern);
+                      else if constexpr (Type == RefinerType::InitField)
+                          this->add_algorithm()->registerRefine(*idDest, *idSrc, *idDest, refineOp,
+                                                                regridFillPattern_);
                       else
                           this->add_algorithm()->registerRefine(*idDest, *idSrc, *idDest, refineOp);
                   }
@@ -303,7 +328,16 @@ public:
         auto idDest = rm->getID(dest);
         if (idSrc and idDest)
         {
-            this->add_algorithm()->registerRefine(*idDest, *idSrc, *idDest, refineOp);
+            if constexpr (Type == RefinerType::LeavingParticles)
+                this->add_algorithm()->registerRefine(
+                    *idDest, *idSrc, *idDest, refineOp,
+                    std::make_shared<LeavingParticlesFillPattern>());
+            else if constexpr (Type == RefinerType::InitField
+                               or Type == RefinerType::InitInteriorPart)
+                this->add_algorithm()->registerRefine(*idDest, *idSrc, *idDest, refineOp,
+                                                      regridFillPattern_);
+            else
+                this->add_algorithm()->registerRefine(*idDest, *idSrc, *idDest, refineOp);
         }
     }
 
@@ -317,6 +351,10 @@ public:
         : Refiner{name, name, rm, refineOp}
     {
     }
+
+private:
+    // shared by all the algorithms of the refiner, only registered for initialization refiners
+    std::shared_ptr<RegridFillPattern> regridFillPattern_ = std::make_shared<RegridFillPattern>();
 };
 } // namespace PHARE::amr
 
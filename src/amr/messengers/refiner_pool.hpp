@@ -3,6 +3,8 @@
 
 #include "refiner.hpp"
 
+#include "core/logger.hpp"
+
 
 #include <map>
 #include <memory>
@@ -106,6 +108,8 @@ namespace amr
         /** @brief this overload will execute communications for all quantities in the pool. */
         void fill(int const levelNumber, double const initDataTime) const
         {
+            PHARE_LOG_SCOPE(3, "RefinerPool::fill");
+
             for (auto const& [key, refiner] : refiners_)
             {
                 refiner.fill(levelNumber, initDataTime);
@@ -116,6 +120,8 @@ namespace amr
         template<typename VecFieldT>
         void fill(VecFieldT& vec, int const levelNumber, double const fillTime)
         {
+            PHARE_LOG_SCOPE(3, "RefinerPool::fill VecField");
+
             if (refiners_.count(vec.name()) == 0)
                 throw std::runtime_error("no refiner for " + vec.name());
 
@@ -124,15 +130,17 @@ namespace amr
 
 
 
-        /** @brief executes a regridding for all quantities in the pool.*/
-        virtual void regrid(std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& hierarchy,
-                            const int levelNumber,
-                            std::shared_ptr<SAMRAI::hier::PatchLevel> const& oldLevel,
-                            double const initDataTime)
+        /** @brief executes a regridding for all quantities in the pool, patches whose box is in
+         * unchangedBoxes are not filled.*/
+        virtual void
+        regrid(std::shared_ptr<SAMRAI::hier::PatchHierarchy> const& hierarchy,
+               const int levelNumber, std::shared_ptr<SAMRAI::hier::PatchLevel> const& oldLevel,
+               double const initDataTime,
+               SAMRAI::hier::BoxContainer const& unchangedBoxes = SAMRAI::hier::BoxContainer{})
         {
             for (auto& [key, refiner] : refiners_)
             {
-                refiner.regrid(hierarchy, levelNumber, oldLevel, initDataTime);
+                refiner.regrid(hierarchy, levelNumber, oldLevel, initDataTime, unchangedBoxes);
             }
         }
 
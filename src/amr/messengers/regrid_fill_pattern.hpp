@@ -0,0 +1,103 @@
+#ifndef PHARE_SRC_AMR_MESSENGERS_REGRID_FILL_PATTERN_HPP
+#define PHARE_SRC_AMR_MESSENGERS_REGRID_FILL_PATTERN_HPP
+
+#include "core/def/phare_mpi.hpp"
+
+#include "amr/resources_manager/amr_utils.hpp"
+
+#include <SAMRAI/hier/Box.h>
+#include <SAMRAI/hier/BoxContainer.h>
+#include <SAMRAI/hier/BoxGeometry.h>
+#include <SAMRAI/hier/BoxOverlap.h>
+#include <SAMRAI/hier/IntVector.h>
+#include <SAMRAI/hier/PatchDataFactory.h>
+#include <SAMRAI/hier/Transformation.h>
+#include "SAMRAI/xfer/VariableFillPattern.h"
+
+#include <memory>
+#include <string>
+
+
+namespace PHARE::amr
+{
+/** @brief RegridFillPattern is used by the initialization refiners. It behaves like the default
+ * SAMRAI fill pattern, except for the destination patches whose box is one of the unchanged
+ * boxes, for which overlaps are empty.
+ *
+ * When a level is regridded, patches having the same box as an old level patch of the same rank
+ * take the old PatchData by pointer (see moveUnchangedPatchData), so the regrid schedules must
+ * neither copy from the old level nor refine from the coarser level into them.
+ */
+class RegridFillPattern : public SAMRAI::xfer::VariableFillPattern
+{
+public:
+    RegridFillPattern() = default;
+
+    virtual ~RegridFillPattern() {}
+
+    void setUnchangedBoxes(SAMRAI::hier::BoxContainer const& boxes) { unchangedBoxes_ = boxes; }
+
+
+    std::shared_ptr<SAMRAI::hier::BoxOverlap>
+    calculateOverlap(SAMRAI::hier::BoxGeometry const& dst_geometry,
+                     SAMRAI::hier::BoxGeometry const& src_geometry,
+                     SAMRAI::hier::Box const& dst_patch_box, SAMRAI::hier::Box const& src_mask,
+                     SAMRAI::hier::Box const& fill_box, bool const overwrite_interior,
+                     SAMRAI::hier::Transformation const& transformation) const
+    {
+        TBOX_ASSERT_OBJDIM_EQUALITY2(dst_patch_box, src_mask);
+
+        if (containsBox(unchangedBoxes_, dst_patch_box))
+            return dst_geometry.setUpOverlap(SAMRAI::hier::BoxContainer{}, transformation);
+
+        return dst_geometry.calculateOverlap(src_geometry, src_mask, fill_box, overwrite_interior,
+                                             transformation);
+    }
+
+    std::string const& getPatternName() const { return s_name_id; }
+
+private:
+    RegridFillPattern(RegridFillPattern const&)            = delete;
+    RegridFillPattern& operator=(RegridFillPattern const&) = delete;
+
+    static const inline std::string s_name_id = "REGRID_FILL_PATTERN";
+
+    SAMRAI::hier::IntVector const& getStencilWidth()
+    {
+        TBOX_ERROR("getStencilWidth() should not be\n"
+                   << "called.  This pattern creates overlaps based on\n"
+                   << "the BoxGeometry objects and is not restricted to a\n"
+                   << "specific stencil.\n");
+
+        /*
+         * Dummy return value that will never get reached.
+         */
+        return SAMRAI::hier::IntVector::getZero(SAMRAI::tbox::Dimension(1));
+    }
+
+    std::shared_ptr<SAMRAI::hier::BoxOverlap>
+    computeFillBoxesOverlap(SAMRAI::hier::BoxContainer const& fill_boxes,
+                            SAMRAI::hier::BoxContainer const& node_fill_boxes,
+                            SAMRAI::hier::Box const& patch_box, SAMRAI::hier::Box const& data_box,
+                            SAMRAI::hier::PatchDataFactory const& pdf) const
+    {
+        NULL_USE(node_fill_boxes);
+
+        SAMRAI::hier::Transformation transformation(
+            SAMRAI::hier::IntVector::getZero(patch_box.getDim()));
+
+        SAMRAI::hier::BoxContainer overlap_boxes;
+        if (!containsBox(unchangedBoxes_, patch_box))
+        {
+            overlap_boxes = fill_boxes;
+            overlap_boxes.intersectBoxes(data_box);
+        }
+        return pdf.getBoxGeometry(patch_box)->setUpOverlap(overlap_boxes, transformation);
+    }
+
+    SAMRAI::hier::BoxContainer unchangedBoxes_;
+};
+
+} // namespace PHARE::amr
+
+#endif
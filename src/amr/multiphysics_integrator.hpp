@@ -32,6 +32,7 @@
 
 #include "core/logger.hpp"
 #include "core/utilities/algorithm.hpp"
+#include "core/utilities/logger/scope_profiler.hpp"
 
 #include "load_balancing/load_balancer_manager.hpp"
 #include "load_balancing/load_balancer_estimator.hpp"
@@ -305,13 +306,33 @@ namespace solver
                                  = std::shared_ptr<SAMRAI::hier::PatchLevel>(),
                                  bool const allocateData = true) override
         {
+            core::profiler::LevelScope levelScope{levelNumber};
+            PHARE_LOG_SCOPE(1, "Multiphys::initializeLevelData");
+
             auto& model            = getModel_(levelNumber);
             auto& solver           = getSolver_(levelNumber);
             auto& messenger        = getMessengerWithCoarser_(levelNumber);
             auto& levelInitializer = getLevelInitializer(model.name());
 
-            bool const isRegridding = oldLevel != nullptr;
-            auto level              = hierarchy->getPatchLevel(levelNumber);
+            auto level = hierarchy->getPatchLevel(levelNumber);
+
+            if (levelNumber == 0 and rootLevelPartition_ == RootLevelPartition::Estimating)
+            {
+                // only the workload is needed to partition the root level again
+                for (auto patch : *level)
+                    load_balancer_manager_->allocate(*patch, initDataTime);
+                load_balancer_manager_->estimateInitial(*level, model);
+                rootLevelPartition_ = RootLevelPartition::Partitioned;
+                return;
+            }
+
+            // the estimating root level has no data, the new one is made from scratch
+            bool const isPartitionedRootLevel
+                = levelNumber == 0 and rootLevelPartition_ == RootLevelPartition::Partitioned;
+            if (isPartitionedRootLevel)
+                rootLevelPartition_ = RootLevelPartition::None;
+
+            bool const isRegridding = oldLevel != nullptr and !isPartitionedRootLevel;
 
 
             PHARE_LOG_LINE_SS("init level " << levelNumber << " with regriding = " << isRegridding);
@@ -356,7 +377,8 @@ namespace solver
                 messenger.registerLevel(hierarchy, levelNumber);
             }
 
-            levelInitializer.initialize(hierarchy, levelNumber, oldLevel, model, messenger,
+            levelInitializer.initialize(hierarchy, levelNumber,
+                                        isRegridding ? oldLevel : nullptr, model, messenger,
                                         initDataTime, isRegridding);
 
             if (isRegriddingL0)
@@ -415,15 +437,18 @@ namespace solver
                                    int const tag_index, bool const /*initialTime*/,
                                    bool const /*usesRichardsonExtrapolationToo*/) override
         {
+            PHARE_LOG_SCOPE(1, "Multiphys::applyGradientDetector");
             PHARE_LOG_LINE_STR("apply gradient detector on level " + std::to_string(levelNumber));
 
-            auto level = hierarchy->getPatchLevel(levelNumber);
+            auto level   = hierarchy->getPatchLevel(levelNumber);
+            auto& model  = getModel_(levelNumber);
+            auto& tagger = getTagger_(levelNumber);
             for (auto& patch : *level)
             {
-                auto& model  = getModel_(levelNumber);
-                auto& tagger = getTagger_(levelNumber);
                 tagger.tag(model, *patch, tag_index);
             }
+
+            tagger.commitLevelTags(levelNumber);
         }
 
 
@@ -502,6 +527,7 @@ namespace solver
                             double const currentTime, double const newTime, bool const firstStep,
                             bool const lastStep, bool const regridAdvance = false) override
         {
+            core::profiler::LevelScope levelScope{level->getLevelNumber()};
             PHARE_LOG_SCOPE(3, "Multiphys::advanceLevel");
 
             if (regridAdvance)
@@ -608,8 +634,46 @@ namespace solver
 
 
 
+        /**
+         * @brief the next initialization of the root level only estimates its workload from
+         * the initial profiles, without loading any data. Making the root level again then
+         * partitions it with that workload and initializes it as a new level.
+         */
+        void partitionRootLevelBeforeLoading()
+        {
+            rootLevelPartition_ = RootLevelPartition::Estimating;
+        }
+
+
+
+        /**
+         * @brief the bytes the models and solvers of each level of the hierarchy keep on the
+         * patches of this rank
+         */
+        NO_DISCARD core::MemoryReport accountMemory(SAMRAI::hier::PatchHierarchy& hierarchy)
+        {
+            PHARE_LOG_SCOPE(1, "Multiphys::accountMemory");
+
+            core::MemoryReport report;
+            for (int iLevel = 0; iLevel < hierarchy.getNumberOfLevels(); ++iLevel)
+            {
+                auto& level  = AMR_Types::getLevel(hierarchy, iLevel);
+                auto& model  = getModel_(iLevel);
+                auto& memory = report.level(iLevel);
+
+                model.accountMemory(level, memory);
+                getSolver_(iLevel).accountMemory(model, level, memory);
+            }
+            return report;
+        }
+
+
+
     private:
-        bool restartInitialized_ = false;
+        enum class RootLevelPartition { None, Estimating, Partitioned };
+
+        bool restartInitialized_               = false;
+        RootLevelPartition rootLevelPartition_ = RootLevelPartition::None;
         int nbrOfLevels_;
         std::unordered_map<std::size_t, double> subcycleEndTimes_;
         std::unordered_map<std::size_t, double> subcycleStartTimes_;
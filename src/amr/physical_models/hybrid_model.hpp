@@ -1,14 +1,19 @@
 #ifndef PHARE_HYBRID_MODEL_HPP
 #define PHARE_HYBRID_MODEL_HPP
 
+#include <memory>
 #include <string>
+#include <vector>
+#include <unordered_map>
 
 #include "initializer/data_provider.hpp"
 #include "core/models/hybrid_state.hpp"
+#include "core/data/time_average/time_averages.hpp"
 #include "amr/physical_models/physical_model.hpp"
 #include "core/data/ions/particle_initializers/particle_initializer_factory.hpp"
 #include "amr/resources_manager/resources_manager.hpp"
 #include "amr/messengers/hybrid_messenger_info.hpp"
+#include "amr/physical_models/time_averages_restart.hpp"
 #include "core/data/vecfield/vecfield.hpp"
 #include "core/def.hpp"
 
@@ -40,6 +45,7 @@ public:
     using ions_type              = Ions;
     using particle_array_type    = typename Ions::particle_array_type;
     using resources_manager_type = amr::ResourcesManager<gridlayout_type, grid_type>;
+    using time_averages_type     = core::TimeAverages<vecfield_type>;
     using ParticleInitializerFactory
         = core::ParticleInitializerFactory<particle_array_type, gridlayout_type>;
 
@@ -49,6 +55,9 @@ public:
     core::HybridState<Electromag, Ions, Electrons> state;
     std::shared_ptr<resources_manager_type> resourcesManager;
 
+    // running sums of the time_average diagnostics, empty if there is none
+    time_averages_type timeAverages;
+
 
     virtual void initialize(level_t& level) override;
 
@@ -60,6 +69,7 @@ public:
     virtual void allocate(patch_t& patch, double const allocateTime) override
     {
         resourcesManager->allocate(state, patch, allocateTime);
+        resourcesManager->allocate(timeAverages, patch, allocateTime);
     }
 
 
@@ -73,6 +83,17 @@ public:
     virtual void fillMessengerInfo(std::unique_ptr<amr::IMessengerInfo> const& info) const override;
 
 
+    virtual void accountMemory(level_t& level, core::LevelMemory& memory) override
+    {
+        for (auto& patch : level)
+        {
+            auto _ = setOnPatch(*patch);
+            resourcesManager->accountMemory(state, memory);
+            resourcesManager->accountMemory(timeAverages, memory);
+        }
+    }
+
+
     NO_DISCARD auto setOnPatch(patch_t& patch)
     {
         return resourcesManager->setOnPatch(patch, *this);
@@ -85,6 +106,11 @@ public:
         , state{dict}
         , resourcesManager{std::move(_resourcesManager)}
     {
+        if (dict.contains("diagnostics"))
+        {
+            addTimeAverages_(dict["diagnostics"]);
+            timePatches = dict["diagnostics"].contains("performance");
+        }
     }
 
 
@@ -94,19 +120,54 @@ public:
     //                  start the ResourcesUser interface
     //-------------------------------------------------------------------------
 
-    NO_DISCARD bool isUsable() const { return state.isUsable(); }
+    NO_DISCARD bool isUsable() const { return state.isUsable() and timeAverages.isUsable(); }
 
-    NO_DISCARD bool isSettable() const { return state.isSettable(); }
+    NO_DISCARD bool isSettable() const
+    {
+        return state.isSettable() and timeAverages.isSettable();
+    }
 
-    NO_DISCARD auto getCompileTimeResourcesViewList() const { return std::forward_as_tuple(state); }
+    NO_DISCARD auto getCompileTimeResourcesViewList() const
+    {
+        return std::forward_as_tuple(state, timeAverages);
+    }
 
-    NO_DISCARD auto getCompileTimeResourcesViewList() { return std::forward_as_tuple(state); }
+    NO_DISCARD auto getCompileTimeResourcesViewList()
+    {
+        return std::forward_as_tuple(state, timeAverages);
+    }
 
     //-------------------------------------------------------------------------
     //                  ends the ResourcesUser interface
     //-------------------------------------------------------------------------
 
     std::unordered_map<std::string, std::shared_ptr<core::NdArrayVector<dimension, int>>> tags;
+
+    // seconds spent pushing the particles of each patch, per level and patch id, until a
+    // performance diagnostic reads them. Patches are only timed if there is a performance
+    // diagnostic.
+    std::vector<std::unordered_map<std::string, double>> patchTimes;
+    bool timePatches = false;
+
+    NO_DISCARD auto& levelPatchTimes(std::size_t const iLevel)
+    {
+        if (patchTimes.size() <= iLevel)
+            patchTimes.resize(iLevel + 1);
+        return patchTimes[iLevel];
+    }
+
+    // patches of a regridded level and of the finer ones are new, the times of the old ones
+    // would never be read
+    void erasePatchTimes(std::size_t const fromLevel)
+    {
+        if (patchTimes.size() > fromLevel)
+            patchTimes.resize(fromLevel);
+    }
+
+private:
+    void addTimeAverages_(PHARE::initializer::PHAREDict const& diagnostics);
+
+    std::unique_ptr<amr::TimeAveragesRestart<time_averages_type>> timeAveragesRestart_;
 };
 
 
@@ -137,6 +198,7 @@ void HybridModel<GridLayoutT, Electromag, Ions, Electrons, AMR_Types, Grid_t>::i
         }
 
         state.electromag.initialize(layout);
+        timeAverages.zero();
     }
 
 
@@ -175,6 +237,34 @@ void HybridModel<GridLayoutT, Electromag, Ions, Electrons, AMR_Types, Grid_t>::f
     transform_(state.ions, hybridInfo.levelGhostParticlesOld);
     transform_(state.ions, hybridInfo.levelGhostParticlesNew);
     transform_(state.ions, hybridInfo.patchGhostParticles);
+
+    hybridInfo.initTimeAverages = timeAverages.names();
+}
+
+
+
+template<typename GridLayoutT, typename Electromag, typename Ions, typename Electrons,
+         typename AMR_Types, typename Grid_t>
+void HybridModel<GridLayoutT, Electromag, Ions, Electrons, AMR_Types, Grid_t>::addTimeAverages_(
+    PHARE::initializer::PHAREDict const& diagnostics)
+{
+    // several time_average diagnostics are registered like the other diagnostic types, their
+    // quantity is "/time_average/" + the name of the averaged quantity
+    std::string const type = "time_average";
+    std::size_t const tree = std::string{"/" + type + "/"}.size();
+
+    std::size_t diagBlockID = 0;
+    while (diagnostics.contains(type)
+           and diagnostics[type].contains(type + std::to_string(diagBlockID)))
+    {
+        auto const& diag = diagnostics[type][type + std::to_string(diagBlockID)];
+        timeAverages.add(diag["quantity"].template to<std::string>().substr(tree));
+        ++diagBlockID;
+    }
+
+    if (!timeAverages.empty())
+        timeAveragesRestart_
+            = std::make_unique<amr::TimeAveragesRestart<time_averages_type>>(timeAverages);
 }
 
 
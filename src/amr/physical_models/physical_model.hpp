@@ -8,6 +8,7 @@
 #include <string>
 
 #include "amr/messengers/messenger_info.hpp"
+#include "core/utilities/memory_usage.hpp"
 
 namespace PHARE
 {
@@ -67,6 +68,14 @@ namespace solver
 
 
 
+        /**
+         * @brief accountMemory adds to memory the bytes of the model quantities on the patches of
+         * the given level, models not keeping track of them add nothing.
+         */
+        virtual void accountMemory(level_t& /*level*/, core::LevelMemory& /*memory*/) {}
+
+
+
 
         virtual ~IPhysicalModel() = default;
     };
@@ -0,0 +1,69 @@
+#ifndef PHARE_AMR_PHYSICAL_MODELS_TIME_AVERAGES_RESTART_HPP
+#define PHARE_AMR_PHYSICAL_MODELS_TIME_AVERAGES_RESTART_HPP
+
+#include <SAMRAI/tbox/Database.h>
+#include <SAMRAI/tbox/RestartManager.h>
+#include <SAMRAI/tbox/Serializable.h>
+
+#include <memory>
+#include <string>
+
+namespace PHARE::amr
+{
+/**
+ * @brief TimeAveragesRestart saves in SAMRAI restart files the number of samples of the time
+ * averages of a model, and gives them back to the model of a restarted simulation. The sums
+ * themselves are patch data saved with the other resources.
+ */
+template<typename TimeAverages>
+class TimeAveragesRestart : public SAMRAI::tbox::Serializable
+{
+public:
+    static inline std::string const restartName = "PHARE_TimeAverages";
+
+    explicit TimeAveragesRestart(TimeAverages& timeAverages)
+        : timeAverages_{timeAverages}
+    {
+        // the restart file is opened before the model is made, see HierarchyRestarter
+        auto restartManager = SAMRAI::tbox::RestartManager::getManager();
+        if (restartManager->isFromRestart())
+        {
+            auto root = restartManager->getRootDatabase();
+            if (root->isDatabase(restartName))
+                getFromRestart_(*root->getDatabase(restartName));
+        }
+        restartManager->registerRestartItem(restartName, this);
+    }
+
+    ~TimeAveragesRestart()
+    {
+        SAMRAI::tbox::RestartManager::getManager()->unregisterRestartItem(restartName);
+    }
+
+    TimeAveragesRestart(TimeAveragesRestart const&)            = delete;
+    TimeAveragesRestart& operator=(TimeAveragesRestart const&) = delete;
+
+
+    void putToRestart(std::shared_ptr<SAMRAI::tbox::Database> const& restart_db) const override
+    {
+        for (auto const& quantity : timeAverages_.quantities())
+            restart_db->putInteger(quantity,
+                                   static_cast<int>(timeAverages_.nbrSamples(quantity)));
+    }
+
+
+private:
+    void getFromRestart_(SAMRAI::tbox::Database& restart_db)
+    {
+        for (auto const& quantity : timeAverages_.quantities())
+            if (restart_db.keyExists(quantity))
+                timeAverages_.nbrSamples(quantity)
+                    = static_cast<std::size_t>(restart_db.getInteger(quantity));
+    }
+
+    TimeAverages& timeAverages_;
+};
+
+} // namespace PHARE::amr
+
+#endif
@@ -1,6 +1,10 @@
 
 #include "amr/resources_manager/amr_utils.hpp"
 
+#include <SAMRAI/hier/PatchDescriptor.h>
+
+#include <algorithm>
+
 namespace PHARE
 {
 namespace amr
@@ -74,6 +78,62 @@ namespace amr
     {
         return SAMRAI::hier::IntVector{referenceAMRBox.lower()};
     }
+
+
+
+    bool containsBox(SAMRAI::hier::BoxContainer const& boxes, SAMRAI::hier::Box const& box)
+    {
+        return std::any_of(std::begin(boxes), std::end(boxes),
+                           [&](auto const& other) { return other == box; });
+    }
+
+
+
+    SAMRAI::hier::BoxContainer moveUnchangedPatchData(SAMRAI_Types::level_t& level,
+                                                      SAMRAI_Types::level_t const& oldLevel,
+                                                      std::vector<int> const& ids)
+    {
+        // patches of a level do not overlap, their lower index identifies them
+        auto lowerIsLess = [](SAMRAI::hier::Box const& box, SAMRAI::hier::Box const& other) {
+            for (auto iDim = 0u; iDim < box.getDim().getValue(); ++iDim)
+                if (box.lower(iDim) != other.lower(iDim))
+                    return box.lower(iDim) < other.lower(iDim);
+            return false;
+        };
+
+        std::vector<SAMRAI::hier::Patch*> oldPatches;
+        oldPatches.reserve(oldLevel.getLocalNumberOfPatches());
+        for (auto const& oldPatch : oldLevel)
+            oldPatches.push_back(oldPatch.get());
+        std::sort(std::begin(oldPatches), std::end(oldPatches),
+                  [&](auto const* patch, auto const* other) {
+                      return lowerIsLess(patch->getBox(), other->getBox());
+                  });
+
+        SAMRAI::hier::BoxContainer unchangedBoxes;
+
+        for (auto& patch : level)
+        {
+            auto const& box = patch->getBox();
+            auto oldPatch   = std::lower_bound(
+                std::begin(oldPatches), std::end(oldPatches), box,
+                [&](auto const* other, auto const& patchBox) {
+                    return lowerIsLess(other->getBox(), patchBox);
+                });
+            if (oldPatch == std::end(oldPatches) or !((*oldPatch)->getBox() == box))
+                continue;
+
+            for (auto const id : ids)
+            {
+                if (patch->checkAllocated(id) and (*oldPatch)->checkAllocated(id))
+                    patch->setPatchData(id, (*oldPatch)->getPatchData(id));
+            }
+
+            unchangedBoxes.push_back(box);
+        }
+
+        return unchangedBoxes;
+    }
 } // namespace amr
 
 
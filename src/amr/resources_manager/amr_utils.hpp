@@ -5,6 +5,7 @@
 
 #include <SAMRAI/geom/CartesianPatchGeometry.h>
 #include <SAMRAI/hier/Box.h>
+#include <SAMRAI/hier/BoxContainer.h>
 #include <SAMRAI/hier/BoxOverlap.h>
 #include <SAMRAI/hier/IntVector.h>
 #include <SAMRAI/hier/Patch.h>
@@ -18,6 +19,8 @@
 
 #include "amr/utilities/box/amr_box.hpp"
 
+#include <vector>
+
 namespace PHARE
 {
 namespace amr
@@ -69,6 +72,29 @@ namespace amr
     NO_DISCARD SAMRAI::hier::IntVector localToAMRVector(SAMRAI::hier::Box const& referenceAMRBox);
 
 
+
+    /**
+     * @brief containsBox returns true if one of the boxes has the same lower and upper as box
+     */
+    NO_DISCARD bool containsBox(SAMRAI::hier::BoxContainer const& boxes,
+                                SAMRAI::hier::Box const& box);
+
+
+
+    /**
+     * @brief moveUnchangedPatchData gives to each local patch of level the PatchData of the local
+     * patch of oldLevel that has the same box, if there is one. PatchData are moved by pointer,
+     * nothing is copied, and both levels share them until oldLevel is released. Only the
+     * components of ids allocated on both patches are moved, which are meant to be those of the
+     * model, other components are left to their owner. Old patches are sorted by box to be
+     * matched, in O(n log n) for n patches.
+     * @return the boxes of the patches of level that took the data of an oldLevel patch
+     */
+    SAMRAI::hier::BoxContainer moveUnchangedPatchData(SAMRAI_Types::level_t& level,
+                                                      SAMRAI_Types::level_t const& oldLevel,
+                                                      std::vector<int> const& ids);
+
+
     /**
      * @brief AMRToLocal returns a local index relative to the referenceAMRBox lower bound
      *
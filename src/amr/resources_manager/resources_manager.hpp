@@ -4,6 +4,7 @@
 #include "core/def/phare_mpi.hpp"
 
 #include "core/logger.hpp"
+#include "core/utilities/memory_usage.hpp"
 
 #include "field_resource.hpp"
 #include "core/hybrid/hybrid_quantities.hpp"
@@ -19,6 +20,7 @@
 
 #include <map>
 #include <optional>
+#include <unordered_set>
 
 
 namespace PHARE
@@ -196,6 +198,79 @@ namespace amr
 
 
 
+        /** @brief call action on each field and particles resource of the ResourcesView,
+         * recursing into sub-resources like allocate(). A resource shared by several
+         * ResourcesViews, like the ions the electrons refer to, is visited as many times.
+         */
+        template<typename ResourcesView, typename Action>
+        void visitResources(ResourcesView& obj, Action&& action) const
+        {
+            if constexpr (is_resource<ResourcesView>::value)
+            {
+                action(obj);
+            }
+            else
+            {
+                static_assert(has_sub_resources_v<ResourcesView>);
+
+                if constexpr (has_runtime_subresourceview_list<ResourcesView>::value)
+                {
+                    for (auto& resourcesUser : obj.getRunTimeResourcesViewList())
+                    {
+                        this->visitResources(resourcesUser, action);
+                    }
+                }
+
+                if constexpr (has_compiletime_subresourcesview_list<ResourcesView>::value)
+                {
+                    std::apply([this, &action](auto&... subResource) //
+                               { (this->visitResources(subResource, action), ...); },
+                               obj.getCompileTimeResourcesViewList());
+                }
+            }
+        }
+
+
+
+        /** @brief adds to memory the bytes of the resources of the ResourcesView, which must be
+         * set on a patch. Fields are counted in fieldKind, particles in the kind of their array.
+         */
+        template<typename ResourcesView>
+        void accountMemory(ResourcesView& obj, core::LevelMemory& memory,
+                           core::MemoryKind const fieldKind = core::MemoryKind::fields) const
+        {
+            using core::MemoryKind;
+
+            std::unordered_set<std::string> visited;
+            visitResources(obj, [&](auto& resource) {
+                using Resource = std::decay_t<decltype(resource)>;
+
+                if (!visited.insert(resource.name()).second)
+                    return;
+
+                if constexpr (is_field_v<Resource>)
+                {
+                    auto const bytes = resource.size() * sizeof(typename Resource::value_type);
+                    memory[fieldKind] += core::MemoryUsage{bytes, bytes};
+                }
+                else
+                {
+                    auto const add = [&](MemoryKind const kind, auto const* particles) {
+                        if (particles)
+                            memory.addParticles(kind, *particles);
+                    };
+                    add(MemoryKind::domain_particles, resource._domainParticles);
+                    add(MemoryKind::patch_ghost_particles, resource._patchGhostParticles);
+                    add(MemoryKind::level_ghost_particles, resource._levelGhostParticles);
+                    add(MemoryKind::level_ghost_particles, resource._levelGhostParticlesOld);
+                    add(MemoryKind::level_ghost_particles, resource._levelGhostParticlesNew);
+                    add(MemoryKind::leaving_particles, resource._leavingParticles);
+                }
+            });
+        }
+
+
+
 
         /** \brief set all passed resources on given Patch
          *
@@ -107,6 +107,17 @@ namespace solver
         virtual void onRegrid() {} // do what you need to do on regrid
 
 
+
+        /**
+         * @brief accountMemory adds to memory the bytes the ISolver keeps for the patches of the
+         * given level
+         */
+        virtual void accountMemory(IPhysicalModel<AMR_Types>& /*model*/, level_t& /*level*/,
+                                   core::LevelMemory& /*memory*/)
+        {
+        }
+
+
         virtual ~ISolver() = default;
 
 
@@ -14,6 +14,7 @@
 #include "amr/solvers/solver_ppc_model_view.hpp"
 
 #include "core/numerics/ion_updater/ion_updater.hpp"
+#include "core/numerics/resampler/particle_resampler.hpp"
 #include "core/numerics/ampere/ampere.hpp"
 #include "core/numerics/faraday/faraday.hpp"
 #include "core/numerics/ohm/ohm.hpp"
@@ -21,9 +22,16 @@
 #include "core/data/vecfield/vecfield.hpp"
 #include "core/data/grid/gridlayout_utils.hpp"
 
+#include "core/logger.hpp"
+#include "core/utilities/mpi_utils.hpp"
 
+
+#include <chrono>
 #include <iomanip>
 #include <sstream>
+#include <optional>
+#include <iostream>
+#include <unordered_map>
 
 namespace PHARE::solver
 {
@@ -60,6 +68,14 @@ private:
 
     PHARE::core::IonUpdater<Ions, Electromag, GridLayout> ionUpdater_;
 
+    // patch ghost particles are not pushed, neighbor patches exchange leaving particles instead
+    bool skipPatchGhostPush_ = false;
+
+    // domain particles are resampled every resampleEvery_ advances of a level
+    std::optional<core::ParticleResampler<ParticleArray>> resampler_;
+    std::size_t resampleEvery_ = 0;
+    std::unordered_map<int, std::size_t> levelAdvances_;
+
 
 public:
     using patch_t     = typename AMR_Types::patch_t;
@@ -72,8 +88,13 @@ public:
         : ISolver<AMR_Types>{"PPC"}
         , ohm_{dict["ohm"]}
         , ionUpdater_{dict["ion_updater"]}
-
+        , skipPatchGhostPush_{
+              cppdict::get_value(dict, "ion_updater/skip_patch_ghost_push", false)}
+        , resampleEvery_{
+              static_cast<std::size_t>(cppdict::get_value(dict, "resampler/every", 0))}
     {
+        if (resampleEvery_ > 0)
+            resampler_.emplace(dict["resampler"]);
     }
 
     ~SolverPPC() override = default;
@@ -100,6 +121,10 @@ public:
     void onRegrid() override { ionUpdater_.reset(); }
 
 
+    void accountMemory(IPhysicalModel_t& model, level_t& level,
+                       core::LevelMemory& memory) override;
+
+
     std::shared_ptr<ISolverModelView> make_view(level_t& level, IPhysicalModel_t& model) override
     {
         return std::make_shared<ModelViews_t>(level, dynamic_cast<HybridModel&>(model));
@@ -130,6 +155,9 @@ private:
                    double const currentTime, double const newTime, core::UpdaterMode mode);
 
 
+    void resample_(level_t& level, ModelViews_t& views, double const currentTime);
+
+
     void saveState_(level_t& level, ModelViews_t& views);
     void restoreState_(level_t& level, ModelViews_t& views);
 
@@ -199,6 +227,41 @@ void SolverPPC<HybridModel, AMR_Types>::allocate(IPhysicalModel_t& model,
 
 
 
+template<typename HybridModel, typename AMR_Types>
+void SolverPPC<HybridModel, AMR_Types>::accountMemory(IPhysicalModel_t& model, level_t& level,
+                                                      core::LevelMemory& memory)
+{
+    auto& hmodel = dynamic_cast<HybridModel&>(model);
+    auto& rm     = *hmodel.resourcesManager;
+
+    auto const scratch = core::MemoryKind::solver_scratch;
+    auto const add     = [&](auto const& map, std::string const& key) {
+        if (auto const it = map.find(key); it != map.end())
+        {
+            memory[scratch] += it->second.memory_usage();
+            memory[scratch] += it->second.cellmap_memory_usage();
+        }
+    };
+
+    for (auto& patch : level)
+    {
+        auto _ = rm.setOnPatch(*patch, electromagPred_, electromagAvg_);
+        rm.accountMemory(electromagPred_, memory, scratch);
+        rm.accountMemory(electromagAvg_, memory, scratch);
+
+        // saved particles are keyed by patch global id, which may be the same on another level
+        auto const patchID = amr::to_string(patch->getGlobalId());
+        for (auto const& pop : hmodel.state.ions)
+        {
+            add(tmpDomain, patchID + "_" + pop.name());
+            add(patchGhost, patchID + "_" + pop.name());
+        }
+    }
+}
+
+
+
+
 template<typename HybridModel, typename AMR_Types>
 void SolverPPC<HybridModel, AMR_Types>::fillMessengerInfo(
     std::unique_ptr<amr::IMessengerInfo> const& info) const
@@ -213,6 +276,31 @@ void SolverPPC<HybridModel, AMR_Types>::fillMessengerInfo(
 }
 
 
+template<typename HybridModel, typename AMR_Types>
+void SolverPPC<HybridModel, AMR_Types>::resample_(level_t& level, ModelViews_t& views,
+                                                  double const currentTime)
+{
+    PHARE_LOG_SCOPE(1, "SolverPPC::resample_");
+
+    // moments deposited at the last advance are kept, merged particles stay in their cell and
+    // carry the same weight, momentum and energy
+    core::ResamplingCounts counts;
+    for (auto& state : views)
+        for (auto& pop : state.ions)
+            counts += (*resampler_)(pop.domainParticles(), state.layout);
+
+    // all ranks advance the level, rank 0 reports the counts of the level over all ranks
+    auto const total = core::mpi::sum(
+        {static_cast<double>(counts.removed), static_cast<double>(counts.added)});
+    auto const removed = static_cast<std::size_t>(total[0]);
+    auto const added   = static_cast<std::size_t>(total[1]);
+
+    if (core::mpi::rank() == 0 and (removed > 0 or added > 0))
+        std::cout << "resampling level " << level.getLevelNumber() << " at t = " << currentTime
+                  << " removed " << removed << " particles, added " << added << "\n";
+}
+
+
 template<typename HybridModel, typename AMR_Types>
 void SolverPPC<HybridModel, AMR_Types>::saveState_(level_t& level, ModelViews_t& views)
 {
@@ -262,6 +350,9 @@ void SolverPPC<HybridModel, AMR_Types>::advanceLevel(hierarchy_t const& hierarch
     auto& fromCoarser = dynamic_cast<HybridMessenger&>(fromCoarserMessenger);
     auto level        = hierarchy.getPatchLevel(levelNumber);
 
+    if (resampler_ and ++levelAdvances_[levelNumber] % resampleEvery_ == 0)
+        resample_(*level, modelView, currentTime);
+
     predictor1_(*level, modelView, fromCoarser, currentTime, newTime);
 
     average_(*level, modelView, fromCoarser, newTime);
@@ -456,14 +547,32 @@ void SolverPPC<HybridModel, AMR_Types>::moveIons_(level_t& level, ModelViews_t&
     TimeSetter setTime{views, newTime};
 
     {
-        auto dt = newTime - currentTime;
+        auto dt     = newTime - currentTime;
+        auto& model = views.model();
+
         for (auto& state : views)
+        {
+            if (!model.timePatches)
+            {
+                ionUpdater_.updatePopulations(state.ions, state.electromagAvg, state.layout, dt,
+                                              mode);
+                continue;
+            }
+
+            auto const start = std::chrono::steady_clock::now();
             ionUpdater_.updatePopulations(state.ions, state.electromagAvg, state.layout, dt, mode);
+            std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+
+            auto& levelTimes = model.levelPatchTimes(level.getLevelNumber());
+            levelTimes[amr::to_string(state.patch->getGlobalId())] += elapsed.count();
+        }
     }
 
     // this needs to be done before calling the messenger
     setTime([](auto& state) -> auto& { return state.ions; });
 
+    if (skipPatchGhostPush_)
+        fromCoarser.fillIonEnteringParticles(views.model().state.ions, level, newTime);
     fromCoarser.fillIonGhostParticles(views.model().state.ions, level, newTime);
     fromCoarser.fillIonPopMomentGhosts(views.model().state.ions, level, newTime);
 
@@ -2,14 +2,30 @@
 #define DEFAULT_HYBRID_TAGGER_STRATEGY_H
 
 #include "hybrid_tagger_strategy.hpp"
+#include "tagging_criteria.hpp"
 #include "core/data/grid/gridlayoutdefs.hpp"
 #include "core/data/vecfield/vecfield_component.hpp"
 #include "core/data/ndarray/ndarray_vector.hpp"
+#include "core/utilities/box/box.hpp"
+#include "core/utilities/point/point.hpp"
+#include <array>
+#include <vector>
 #include <cstddef>
+#include <cstdint>
 #include "initializer/data_provider.hpp"
 
 namespace PHARE::amr
 {
+/** \brief DefaultHybridTaggerStrategy tags cells where one of the selected criteria is above
+ * the threshold, see TaggingKernel.
+ *
+ * Criteria are "B" (gradient of the magnetic field components, or in 1D the variation of the
+ * averaged By and Bz), "density" (gradient of the ion density) and "current" (magnitude of J).
+ *
+ * A cell already tagged, i.e. given tagged in the tags buffer, stays tagged until its criterion
+ * goes below threshold * (1 - hysteresis), so that cells do not flicker from one regrid to the
+ * next. With hysteresis = 0, tags only depend on the threshold.
+ */
 template<typename HybridModel>
 class DefaultHybridTaggerStrategy : public HybridTaggerStrategy<HybridModel>
 {
@@ -20,120 +36,85 @@ class DefaultHybridTaggerStrategy : public HybridTaggerStrategy<HybridModel>
 public:
     DefaultHybridTaggerStrategy(initializer::PHAREDict const& dict)
         : threshold_{cppdict::get_value(dict, "threshold", 0.1)}
+        , untagThreshold_{threshold_ * (1. - cppdict::get_value(dict, "hysteresis", 0.))}
+        , criteria_{taggingCriteriaFrom(cppdict::get_value(dict, "criteria", std::string{"B"}))}
     {
     }
     void tag(HybridModel& model, gridlayout_type const& layout, int* tags) const override;
 
+    bool usesPreviousTags() const override { return untagThreshold_ < threshold_; }
+
 private:
-    double threshold_ = 0.1;
+    double threshold_      = 0.1;
+    double untagThreshold_ = 0.1;
+    std::vector<TaggingCriterion> criteria_;
 };
 
 template<typename HybridModel>
 void DefaultHybridTaggerStrategy<HybridModel>::tag(HybridModel& model,
                                                    gridlayout_type const& layout, int* tags) const
 {
-    auto& Bx = model.state.electromag.B.getComponent(PHARE::core::Component::X);
-    auto& By = model.state.electromag.B.getComponent(PHARE::core::Component::Y);
-    auto& Bz = model.state.electromag.B.getComponent(PHARE::core::Component::Z);
-
+    auto& B = model.state.electromag.B;
+    auto& J = model.state.J;
     auto& N = model.state.ions.density();
 
+    auto& Bx = B.getComponent(PHARE::core::Component::X);
+    auto& By = B.getComponent(PHARE::core::Component::Y);
+    auto& Bz = B.getComponent(PHARE::core::Component::Z);
+
     // we loop on cell indexes for all qties regardless of their centering
-    auto const& [start_x, _]
-        = layout.physicalStartToEnd(PHARE::core::QtyCentering::dual, PHARE::core::Direction::X);
+    // the tag buffer does not have ghost cells so we take the number of cells of the layout
+    std::array<std::uint32_t, dimension> start;
+    for (std::size_t iDim = 0; iDim < dimension; ++iDim)
+        start[iDim] = layout.physicalStartIndex(PHARE::core::QtyCentering::dual,
+                                                static_cast<PHARE::core::Direction>(iDim));
 
-    // override end_x because the tag buffer does not have ghost cells
-    // and physicalEnd will account for ghost cells
-    auto const& end_x = layout.nbrCells()[0] - 1;
+    auto const nbrCells = layout.nbrCells();
+    TaggingKernel<dimension> kernel{start, nbrCells};
 
-    // SAMRAI tags int* buffer is FORTRAN ordering so we set false to the view
-    bool constexpr c_ordering = false;
-    auto tagsv = core::NdArrayView<dimension, int, c_ordering>(tags, layout.nbrCells());
-
-    if constexpr (dimension == 1 and false)
+    for (auto const criterion : criteria_)
     {
-        // at interporder 1 we choose not to tag the last patch cell since
-        // the 5 points stencil may go beyond the last ghost node.
-        // for interp order 2 and 3 this is ok
-        for (auto iCell = 0u, ix = start_x; iCell <= end_x; ++ix, ++iCell)
+        if (criterion == TaggingCriterion::B)
         {
-            auto crit_by_x = (By(ix + 2) - By(ix)) / (1 + By(ix + 1) - By(ix));
-            auto crit_bz_x = (Bz(ix + 2) - Bz(ix)) / (1 + Bz(ix + 1) - Bz(ix));
-            auto criter    = std::max(crit_by_x, crit_bz_x);
-
-            if (criter > threshold_)
+            if constexpr (dimension == 1)
             {
-                tagsv(iCell) = 1;
+                // at interporder 1 we choose not to tag the last patch cell since
+                // the 5 points stencil may go beyond the last ghost node.
+                // for interp order 2 and 3 this is ok
+                auto constexpr doLastCell = gridlayout_type::nbrGhosts() > 2;
+                kernel.averagedVariation(By, Bz, nbrCells[0] - (doLastCell ? 0 : 1));
             }
             else
-                tagsv(iCell) = 0;
-        }
-    }
-    if constexpr (dimension == 1)
-    {
-        // at interporder 1 we choose not to tag the last patch cell since
-        // the 5 points stencil may go beyond the last ghost node.
-        // for interp order 2 and 3 this is ok
-        auto constexpr doLastCell = gridlayout_type::nbrGhosts() > 2;
-        std::size_t oneOrZero     = doLastCell ? 1 : 0;
-        for (auto iCell = 0u, ix = start_x; iCell < end_x + oneOrZero; ++ix, ++iCell)
-        {
-            auto Byavg     = 0.2 * (By(ix - 2) + By(ix - 1) + By(ix) + By(ix + 1) + By(ix + 2));
-            auto Bzavg     = 0.2 * (Bz(ix - 2) + Bz(ix - 1) + Bz(ix) + Bz(ix + 1) + Bz(ix + 2));
-            auto Byavgp1   = 0.2 * (By(ix - 1) + By(ix) + By(ix + 1) + By(ix + 2) + By(ix + 3));
-            auto Bzavgp1   = 0.2 * (Bz(ix - 1) + Bz(ix) + Bz(ix + 1) + Bz(ix + 2) + Bz(ix + 3));
-            auto criter_by = std::abs(Byavgp1 - Byavg) / (1 + std::abs(Byavg));
-            auto criter_bz = std::abs(Bzavgp1 - Bzavg) / (1 + std::abs(Bzavg));
-            auto criter_b  = std::sqrt(criter_by * criter_by + criter_bz * criter_bz);
-            auto criter    = criter_b;
-
-            if (criter > threshold_)
             {
-                tagsv(iCell) = 1;
+                kernel.gradient(Bx);
+                kernel.gradient(By);
+                kernel.gradient(Bz);
             }
-            else
-                tagsv(iCell) = 0;
         }
-    }
-    if constexpr (dimension == 2)
-    {
-        auto const& [start_y, __]
-            = layout.physicalStartToEnd(PHARE::core::QtyCentering::dual, PHARE::core::Direction::Y);
+        else if (criterion == TaggingCriterion::density)
+            kernel.gradient(N);
 
-        auto const& end_y = layout.nbrCells()[1] - 1;
-
-        for (auto iTag_x = 0u, ix = start_x; iTag_x <= end_x; ++ix, ++iTag_x)
+        else if (criterion == TaggingCriterion::current)
         {
-            for (auto iTag_y = 0u, iy = start_y; iTag_y <= end_y; ++iy, ++iTag_y)
-            {
-                auto field_diff = [&](auto const& F) //
-                {
-                    auto const delta_2x = std::abs(F(ix + 2, iy) - F(ix, iy));
-                    auto const delta_2y = std::abs(F(ix, iy + 2) - F(ix, iy));
-                    auto const delta_x  = std::abs(F(ix + 1, iy) - F(ix, iy));
-                    auto const delta_y  = std::abs(F(ix, iy + 1) - F(ix, iy));
-
-                    auto const criter_x = delta_2x / (1 + delta_x);
-                    auto const criter_y = delta_2y / (1 + delta_y);
-
-                    return std::make_tuple(criter_x, criter_y);
-                };
+            kernel.magnitude(J.getComponent(PHARE::core::Component::X),
+                             J.getComponent(PHARE::core::Component::Y),
+                             J.getComponent(PHARE::core::Component::Z));
+        }
+    }
 
-                auto const& [Bx_x, Bx_y] = field_diff(Bx);
-                auto const& [By_x, By_y] = field_diff(By);
-                auto const& [Bz_x, Bz_y] = field_diff(Bz);
-                auto crit                = std::max({Bx_x, Bx_y, By_x, By_y, Bz_x, Bz_y});
+    // SAMRAI tags int* buffer is FORTRAN ordering so we set false to the view
+    bool constexpr c_ordering = false;
+    auto tagsv = core::NdArrayView<dimension, int, c_ordering>(tags, nbrCells);
 
-                if (crit > threshold_)
-                {
-                    tagsv(iTag_x, iTag_y) = 1;
-                }
-                else
-                {
-                    tagsv(iTag_x, iTag_y) = 0;
-                }
-            }
-        }
+    // cells are iterated in C order, like the kernel criteria
+    auto const cells = core::Box<std::uint32_t, dimension>{core::Point<std::uint32_t, dimension>{},
+                                                           core::Point{nbrCells} - 1u};
+    std::size_t iCell = 0;
+    for (auto const& cell : cells)
+    {
+        auto& tag       = tagsv(*cell);
+        auto const crit = kernel[iCell++];
+        tag             = crit > threshold_ ? 1 : (crit > untagThreshold_ ? tag : 0);
     }
 }
 } // namespace PHARE::amr
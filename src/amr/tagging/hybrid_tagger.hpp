@@ -12,8 +12,12 @@
 
 #include <SAMRAI/pdat/CellData.h>
 
+#include <array>
 #include <memory>
+#include <string>
+#include <vector>
 #include <utility>
+#include <algorithm>
 #include <stdexcept>
 
 
@@ -21,6 +25,13 @@
 
 namespace PHARE::amr
 {
+/** \brief HybridTagger tags the cells of a level with its strategy.
+ *
+ * If the strategy uses previous tags (hysteresis), the tagged cells of each level are kept from
+ * one tagging to the next and given back to the strategy, whatever the patch the cells are on.
+ * They are kept on the rank that tagged them: cells that change rank when the level is
+ * rebalanced start their next tagging untagged.
+ */
 template<typename HybridModel>
 class HybridTagger : public Tagger
 {
@@ -39,8 +50,22 @@ public:
 
     void tag(IPhysicalModel& model, patch_t& patch, int tag_index) override;
 
+    void commitLevelTags(int levelNumber) override;
+
 private:
+    // AMR indexes of the tagged cells of a level, sorted once all its patches are tagged
+    using TaggedCells = std::vector<std::array<int, HybridModel::dimension>>;
+
+    TaggedCells& levelTags_(std::vector<TaggedCells>& tags, int levelNumber)
+    {
+        if (tags.size() <= static_cast<std::size_t>(levelNumber))
+            tags.resize(levelNumber + 1);
+        return tags[levelNumber];
+    }
+
     std::unique_ptr<HybridTaggerStrategy<HybridModel>> strat_;
+    std::vector<TaggedCells> previousTags_;
+    std::vector<TaggedCells> currentTags_;
 };
 
 
@@ -64,8 +89,35 @@ void HybridTagger<HybridModel>::tag(PHARE::solver::IPhysicalModel<amr_t>& model,
         auto modelIsOnPatch = hybridModel.setOnPatch(patch);
         auto pd   = dynamic_cast<SAMRAI::pdat::CellData<int>*>(patch.getPatchData(tag_index).get());
         auto tags = pd->getPointer();
+
+        auto const levelNumber = patch.getPatchLevelNumber();
+        auto const amrBox      = layout.AMRBox();
+
+        // SAMRAI tags int* buffer is FORTRAN ordering so we set false to the view
+        auto patchTags
+            = core::NdArrayView<HybridModel::dimension, int, false>(tags, layout.nbrCells());
+
+        // cells start from their tag of the last tagging of the level, whatever the patch they
+        // were on, the strategy uses them as the current state of the cells for the hysteresis
+        bool const usesPreviousTags = strat_->usesPreviousTags();
+        if (usesPreviousTags)
+        {
+            auto const& previousTags = levelTags_(previousTags_, levelNumber);
+            for (auto const& amrCell : amrBox)
+                patchTags(*(amrCell - amrBox.lower)) = std::binary_search(
+                    previousTags.begin(), previousTags.end(), amrCell.toArray());
+        }
+
         strat_->tag(hybridModel, layout, tags);
 
+        if (usesPreviousTags)
+        {
+            auto& currentTags = levelTags_(currentTags_, levelNumber);
+            for (auto const& amrCell : amrBox)
+                if (patchTags(*(amrCell - amrBox.lower)))
+                    currentTags.push_back(amrCell.toArray());
+        }
+
 
         // These tags will be saved even if they are not used in diags during this advance
         // hybridModel.tags may contain vectors for patches and levels that no longer exist
@@ -106,6 +158,24 @@ void HybridTagger<HybridModel>::tag(PHARE::solver::IPhysicalModel<amr_t>& model,
         throw std::runtime_error("invalid tagging strategy");
 }
 
+
+
+template<typename HybridModel>
+void HybridTagger<HybridModel>::commitLevelTags(int levelNumber)
+{
+    if (!strat_ or !strat_->usesPreviousTags())
+        return;
+
+    // patches do not overlap, each cell is tagged once
+    auto& current  = levelTags_(currentTags_, levelNumber);
+    auto& previous = levelTags_(previousTags_, levelNumber);
+    std::sort(current.begin(), current.end());
+
+    // swapped to reuse the previous storage for the next tagging
+    previous.swap(current);
+    current.clear();
+}
+
 } // namespace PHARE::amr
 
 #endif
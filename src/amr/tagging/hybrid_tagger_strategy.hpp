@@ -11,7 +11,11 @@ class HybridTaggerStrategy
 
 public:
     virtual void tag(HybridModel& model, gridlayout_type const& layout, int* tags) const = 0;
-    virtual ~HybridTaggerStrategy()                                                      = 0;
+
+    // true if tag() reads the tags of the previous tagging from the buffer it is given
+    virtual bool usesPreviousTags() const { return false; }
+
+    virtual ~HybridTaggerStrategy() = 0;
 };
 
 template<typename HybridModel>
@@ -24,6 +24,11 @@ public:
     std::string name() { return name_; }
     virtual void tag(PHARE::solver::IPhysicalModel<amr_t>& model, patch_t& patch, int tag_index)
         = 0;
+
+    /** @brief commitLevelTags is called once all patches of a level have been tagged, their tags
+     * are then the ones the next tagging of the level starts from.
+     */
+    virtual void commitLevelTags(int levelNumber) = 0;
     virtual ~Tagger(){};
 };
 
@@ -0,0 +1,219 @@
+#ifndef PHARE_AMR_TAGGING_TAGGING_CRITERIA_HPP
+#define PHARE_AMR_TAGGING_TAGGING_CRITERIA_HPP
+
+
+#include "core/def.hpp"
+
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace PHARE::amr
+{
+enum class TaggingCriterion { B, density, current };
+
+
+/** \brief taggingCriteriaFrom parses a comma separated list of criteria names among
+ * "B", "density" and "current"
+ */
+NO_DISCARD inline std::vector<TaggingCriterion> taggingCriteriaFrom(std::string const& names)
+{
+    std::vector<TaggingCriterion> criteria;
+    std::stringstream ss{names};
+    std::string name;
+
+    while (std::getline(ss, name, ','))
+    {
+        name.erase(std::remove(name.begin(), name.end(), ' '), name.end());
+
+        if (name == "B")
+            criteria.push_back(TaggingCriterion::B);
+        else if (name == "density")
+            criteria.push_back(TaggingCriterion::density);
+        else if (name == "current")
+            criteria.push_back(TaggingCriterion::current);
+        else
+            throw std::runtime_error("Unknown tagging criterion " + name);
+    }
+
+    if (criteria.empty())
+        throw std::runtime_error("No tagging criterion given");
+
+    return criteria;
+}
+
+
+
+/** \brief TaggingKernel computes refinement criteria on the cells of a patch.
+ *
+ * The criterion of a cell is the max of the criteria computed on it, stored in C order (last
+ * direction varies fastest). Cells are walked row by row along the last direction, which is
+ * contiguous in the fields too, so that each criterion is computed over plain pointers in
+ * loops the compiler can vectorize.
+ *
+ * start is the field index of the first cell in each direction, criteria read fields from
+ * there up to two nodes beyond the last cell.
+ */
+template<std::size_t dim>
+class TaggingKernel
+{
+    using Index = std::array<std::uint32_t, dim>;
+
+public:
+    TaggingKernel(Index const& start, Index const& nbrCells)
+        : start_{start}
+        , nbrCells_{nbrCells}
+        , criterion_(product_(nbrCells), 0.)
+    {
+    }
+
+
+    /** \brief gradient takes, for each direction, |F(i+2) - F(i)| / (1 + |F(i+1) - F(i)|) */
+    template<typename Field>
+    void gradient(Field const& F)
+    {
+        auto const rowLength = nbrCells_[dim - 1];
+
+        forEachRow_([&](auto const iCell, auto const& index) {
+            auto const* f = rowPointer_(F, index);
+            auto* crit    = criterion_.data() + iCell;
+
+            for (std::size_t iDir = 0; iDir < dim; ++iDir)
+            {
+                auto const s = stride_(F, iDir);
+                for (std::uint32_t i = 0; i < rowLength; ++i)
+                {
+                    auto const delta2 = std::abs(f[i + 2 * s] - f[i]);
+                    auto const delta  = std::abs(f[i + s] - f[i]);
+                    crit[i]           = std::max(crit[i], delta2 / (1 + delta));
+                }
+            }
+        });
+    }
+
+
+    /** \brief magnitude takes sqrt(Fx^2 + Fy^2 + Fz^2), components being read at the cell
+     * index regardless of their centering
+     */
+    template<typename Field>
+    void magnitude(Field const& Fx, Field const& Fy, Field const& Fz)
+    {
+        auto const rowLength = nbrCells_[dim - 1];
+
+        forEachRow_([&](auto const iCell, auto const& index) {
+            auto const* fx = rowPointer_(Fx, index);
+            auto const* fy = rowPointer_(Fy, index);
+            auto const* fz = rowPointer_(Fz, index);
+            auto* crit     = criterion_.data() + iCell;
+
+            for (std::uint32_t i = 0; i < rowLength; ++i)
+            {
+                auto const norm = std::sqrt(fx[i] * fx[i] + fy[i] * fy[i] + fz[i] * fz[i]);
+                crit[i]         = std::max(crit[i], norm);
+            }
+        });
+    }
+
+
+    /** \brief averagedVariation is the 1D criterion on two fields: the relative variation of
+     * their 5 points average between consecutive nodes, combined as a norm. It reads fields from
+     * two nodes before the first cell and three nodes beyond the last, so nbrCells can be
+     * smaller than the kernel cells to not go past the last ghost node.
+     */
+    template<typename Field>
+    void averagedVariation(Field const& F1, Field const& F2, std::uint32_t const nbrCells)
+    {
+        static_assert(dim == 1);
+        assert(nbrCells <= nbrCells_[0]);
+
+        auto const* f1 = F1.data() + start_[0];
+        auto const* f2 = F2.data() + start_[0];
+        auto* crit     = criterion_.data();
+
+        auto average = [](auto const* f, auto const i) {
+            return 0.2 * (f[i - 2] + f[i - 1] + f[i] + f[i + 1] + f[i + 2]);
+        };
+
+        for (std::int64_t i = 0; i < static_cast<std::int64_t>(nbrCells); ++i)
+        {
+            auto const avg1  = average(f1, i);
+            auto const avg2  = average(f2, i);
+            auto const crit1 = std::abs(average(f1, i + 1) - avg1) / (1 + std::abs(avg1));
+            auto const crit2 = std::abs(average(f2, i + 1) - avg2) / (1 + std::abs(avg2));
+            auto const norm  = std::sqrt(crit1 * crit1 + crit2 * crit2);
+            crit[i]          = std::max(crit[i], norm);
+        }
+    }
+
+
+    NO_DISCARD double operator[](std::size_t iCell) const { return criterion_[iCell]; }
+
+
+private:
+    static std::size_t product_(Index const& nbrCells)
+    {
+        std::size_t size = 1;
+        for (auto const n : nbrCells)
+            size *= n;
+        return size;
+    }
+
+    // calls fn(first cell of the row, field index of the first cell of the row) for each row
+    template<typename Fn>
+    void forEachRow_(Fn&& fn) const
+    {
+        std::size_t nbrRows = 1;
+        for (std::size_t iDir = 0; iDir + 1 < dim; ++iDir)
+            nbrRows *= nbrCells_[iDir];
+
+        auto index = start_;
+        for (std::size_t iRow = 0; iRow < nbrRows; ++iRow)
+        {
+            fn(iRow * nbrCells_[dim - 1], index);
+
+            for (int iDir = static_cast<int>(dim) - 2; iDir >= 0; --iDir)
+            {
+                if (++index[iDir] < start_[iDir] + nbrCells_[iDir])
+                    break;
+                index[iDir] = start_[iDir];
+            }
+        }
+    }
+
+    template<typename Field>
+    static auto rowPointer_(Field const& F, Index const& index)
+    {
+        auto const shape   = F.shape();
+        std::size_t offset = 0;
+        for (std::size_t iDir = 0; iDir < dim; ++iDir)
+            offset = offset * shape[iDir] + index[iDir];
+        return F.data() + offset;
+    }
+
+    template<typename Field>
+    static std::size_t stride_(Field const& F, std::size_t const iDir)
+    {
+        auto const shape   = F.shape();
+        std::size_t stride = 1;
+        for (std::size_t jDir = iDir + 1; jDir < dim; ++jDir)
+            stride *= shape[jDir];
+        return stride;
+    }
+
+    Index start_;
+    Index nbrCells_;
+    std::vector<double> criterion_;
+};
+
+
+} // namespace PHARE::amr
+
+#endif
@@ -3,6 +3,12 @@
 
 #include "core/logger.hpp"
 #include "core/def/phare_mpi.hpp"
+#include "core/utilities/mpi_utils.hpp"
+#include "core/data/particles/particle.hpp"
+
+#include <chrono>
+#include <sstream>
+#include <iostream>
 
 #include <SAMRAI/mesh/BalanceUtilities.h>
 #include <SAMRAI/algs/TimeRefinementIntegrator.h>
@@ -20,11 +26,13 @@
 #include <SAMRAI/tbox/DatabaseBox.h>
 #include <SAMRAI/tbox/InputManager.h>
 #include <SAMRAI/tbox/MemoryDatabase.h>
+#include <SAMRAI/tbox/RestartManager.h>
 
 
 #include "initializer/data_provider.hpp"
 
 #include "amr/load_balancing/load_balancer_details.hpp"
+#include "amr/load_balancing/rebalance_cost_policy.hpp"
 
 
 namespace PHARE::amr
@@ -48,12 +56,36 @@ public:
     {
         bool rebalance_coarsest_now = _should_rebalance_now();
 
-        auto new_time = timeRefIntegrator_->advanceHierarchy(dt, rebalance_coarsest_now);
+        auto const start = std::chrono::steady_clock::now();
+        auto new_time    = timeRefIntegrator_->advanceHierarchy(dt, rebalance_coarsest_now);
+        std::chrono::duration<double> const step_time = std::chrono::steady_clock::now() - start;
+
+        // the cost policy needs the time of a regular step and what rebalancing adds to it
+        if (rebalance_coarsest_now)
+            cost_policy_.overhead = std::max(0., step_time.count() - last_step_time_);
+        else
+            last_step_time_ = step_time.count();
+
         ++time_step_idx;
         return new_time;
     }
 
-    void initialize() { timeRefIntegrator_->initializeHierarchy(); }
+    void initialize()
+    {
+        // the root level is made once to estimate its workload, then made again by the
+        // hierarchy initialization, partitioned with that workload
+        if (partitionsRootLevelBeforeLoading())
+            timeRefIntegrator_->getGriddingAlgorithm()->makeCoarsestLevel(startTime_);
+
+        timeRefIntegrator_->initializeHierarchy();
+    }
+
+    // restarts already have their partition
+    bool partitionsRootLevelBeforeLoading() const
+    {
+        return is_tagging_refinement and lb_info_.active and lb_info_.initial_partition
+               and !SAMRAI::tbox::RestartManager::getManager()->isFromRestart();
+    }
 
     Integrator(PHARE::initializer::PHAREDict const& dict,
                std::shared_ptr<SAMRAI::hier::PatchHierarchy> hierarchy,
@@ -67,11 +99,15 @@ private:
     amr::LoadBalancerDetails const lb_info_;
     bool const is_tagging_refinement                = false;
     int loadBalancerPatchId_                        = -1;
+    double const startTime_                         = 0;
     std::size_t rebalance_coarsest_auto_back_off    = 0;
     std::size_t time_step_idx                       = 0;
     std::size_t rebalance_coarsest_auto_back_off_by = 1;
 
 
+    RebalanceCostPolicy cost_policy_;
+    double last_step_time_ = 0;
+
     std::shared_ptr<SAMRAI::algs::TimeRefinementIntegrator> timeRefIntegrator_;
 
 
@@ -130,6 +166,24 @@ private:
         return false;
     };
 
+    bool cost_rebalance_check()
+    {
+        if (time_step_idx == 0)
+            return lb_info_.on_init;
+
+        PHARE_LOG_SCOPE(1, "Integrator::_should_rebalance_now::cost");
+
+        // only the root level is rebalanced, finer levels are partitioned when regridded
+        auto const [sumLoad, maxLoad]
+            = core::mpi::sum_and_max(computeNonUniformWorkLoadForLevel0());
+        auto const decision = cost_policy_(sumLoad, maxLoad, core::mpi::size(), last_step_time_);
+
+        if (lb_info_.log and core::mpi::rank() == 0)
+            std::cout << "rebalance check at step " << time_step_idx << ": " << decision << "\n";
+
+        return decision.rebalance;
+    }
+
     std::function<bool()> _rebalance_check;
 };
 
@@ -159,9 +213,14 @@ Integrator<_dimension>::Integrator(
     : lb_info_{lb_info}
     , is_tagging_refinement{_is_tagging_refinement(dict)}
     , loadBalancerPatchId_{loadBalancerPatchId}
+    , startTime_{startTime}
     , rebalance_coarsest_auto_back_off{lb_info_.on_init ? 0 : lb_info_.next_rebalance}
-    , _rebalance_check{lb_info_.automatic ? std::bind(&Integrator::tolerance_rebalance_check, this)
-                                          : std::bind(&Integrator::cadence_rebalance_check, this)}
+    , cost_policy_{lb_info_.horizon, lb_info_.bandwidth, sizeof(core::Particle<dimension>)}
+    , _rebalance_check{lb_info_.cost
+                           ? std::bind(&Integrator::cost_rebalance_check, this)
+                           : (lb_info_.automatic
+                                  ? std::bind(&Integrator::tolerance_rebalance_check, this)
+                                  : std::bind(&Integrator::cadence_rebalance_check, this))}
 {
     loadBalancer->setSAMRAI_MPI(
         SAMRAI::tbox::SAMRAI_MPI::getSAMRAIWorld()); // TODO Is it really needed ?
@@ -79,6 +79,9 @@ namespace core
             return particles_.levelGhostParticlesNew();
         }
 
+        NO_DISCARD auto& leavingParticles() { return particles_.leavingParticles(); }
+        NO_DISCARD auto& leavingParticles() const { return particles_.leavingParticles(); }
+
 
         NO_DISCARD field_type const& density() const { return rho_; }
         NO_DISCARD field_type& density() { return rho_; }
@@ -34,6 +34,7 @@ namespace core
         ParticleArray* _levelGhostParticles{nullptr};
         ParticleArray* _levelGhostParticlesOld{nullptr};
         ParticleArray* _levelGhostParticlesNew{nullptr};
+        ParticleArray* _leavingParticles{nullptr};
 
         auto& name() const { return _name; }
 
@@ -111,6 +112,20 @@ namespace core
         {
             return const_cast<ParticlesPack*>(this)->levelGhostParticlesNew();
         }
+
+
+        //! domain particles which left the patch domain during the last push
+        //! and are to be given to the neighbor patch they entered
+        NO_DISCARD ParticleArray& leavingParticles()
+        {
+            if (_leavingParticles)
+                return *_leavingParticles;
+            throw std::runtime_error("Error - cannot provide access to leavingParticles");
+        }
+        NO_DISCARD ParticleArray const& leavingParticles() const
+        {
+            return const_cast<ParticlesPack*>(this)->leavingParticles();
+        }
     };
 
 
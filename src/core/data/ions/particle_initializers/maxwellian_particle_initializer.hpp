@@ -3,6 +3,8 @@
 
 #include <memory>
 #include <random>
+#include <tuple>
+#include <vector>
 #include <cassert>
 #include <functional>
 
@@ -11,6 +13,8 @@
 #include "core/utilities/types.hpp"
 #include "core/data/ions/particle_initializers/particle_initializer.hpp"
 #include "core/data/particles/particle.hpp"
+#include "core/data/particles/particle_utilities.hpp"
+#include "core/data/particles/tracers.hpp"
 #include "initializer/data_provider.hpp"
 #include "core/utilities/point/point.hpp"
 #include "core/def.hpp"
@@ -44,7 +48,8 @@ public:
         std::uint32_t const& nbrParticlesPerCell, std::optional<std::size_t> seed = {},
         Basis const basis                                 = Basis::Cartesian,
         std::array<InputFunction, 3> const& magneticField = {nullptr, nullptr, nullptr},
-        double densityCutOff                              = 1e-5)
+        double densityCutOff                              = 1e-5,
+        TracerSelection<dimension> const& tracers         = {})
         : density_{density}
         , bulkVelocity_{bulkVelocity}
         , thermalVelocity_{thermalVelocity}
@@ -54,6 +59,7 @@ public:
         , nbrParticlePerCell_{nbrParticlesPerCell}
         , basis_{basis}
         , rngSeed_{seed}
+        , tracers_{tracers}
     {
     }
 
@@ -65,6 +71,13 @@ public:
     void loadParticles(ParticleArray& particles, GridLayout const& layout) const override;
 
 
+    /**
+     * @brief nbrParticlePerCell in the cells where the density is above the cut-off, zero
+     * elsewhere, only the density profile being evaluated
+     */
+    std::vector<std::uint32_t> nbrParticlesPerCell(GridLayout const& layout) const override;
+
+
     virtual ~MaxwellianParticleInitializer() = default;
 
 
@@ -92,6 +105,7 @@ private:
     std::uint32_t nbrParticlePerCell_;
     Basis basis_;
     std::optional<std::size_t> rngSeed_;
+    TracerSelection<dimension> tracers_;
 };
 
 
@@ -134,6 +148,33 @@ private:
 
 
 
+template<typename ParticleArray, typename GridLayout>
+std::vector<std::uint32_t>
+MaxwellianParticleInitializer<ParticleArray, GridLayout>::nbrParticlesPerCell(
+    GridLayout const& layout) const
+{
+    // same cells and coordinates as loadParticles
+    auto ndCellIndices = layout.physicalStartToEndIndices(QtyCentering::primal);
+
+    auto cellCoords = layout.indexesToCoordVectors(
+        ndCellIndices, QtyCentering::primal, [](auto const& gridLayout, auto const&... indexes) {
+            return gridLayout.cellCenteredCoordinates(indexes...);
+        });
+
+    auto const density = std::apply(
+        [&](auto const&... coords) { return density_(coords...); }, cellCoords);
+    auto const n = density->data();
+
+    std::vector<std::uint32_t> nbrParticles(ndCellIndices.size(), 0);
+    for (std::size_t flatCellIdx = 0; flatCellIdx < nbrParticles.size(); ++flatCellIdx)
+        if (n[flatCellIdx] >= densityCutOff_)
+            nbrParticles[flatCellIdx] = nbrParticlePerCell_;
+
+    return nbrParticles;
+}
+
+
+
 template<typename ParticleArray, typename GridLayout>
 void MaxwellianParticleInitializer<ParticleArray, GridLayout>::loadParticles(
     ParticleArray& particles, GridLayout const& layout) const
@@ -204,8 +245,15 @@ void MaxwellianParticleInitializer<ParticleArray, GridLayout>::loadParticles(
             if (basis_ == Basis::Magnetic)
                 particleVelocity = basisTransform(basis, particleVelocity);
 
-            particles.emplace_back(Particle{cellWeight, particleCharge_, iCell,
-                                            deltas(deltaDistrib, randGen), particleVelocity});
+            auto& particle = particles.emplace_back(Particle{
+                cellWeight, particleCharge_, iCell, deltas(deltaDistrib, randGen), particleVelocity});
+
+            if constexpr (Particle::has_id)
+                if (tracers_.any())
+                {
+                    auto const position = positionAsPoint(particle, layout).toArray();
+                    particle.id         = tracers_.id(iCell, ipart, position);
+                }
         }
     }
 }
@@ -1,6 +1,8 @@
 #ifndef PHARE_PARTICLE_INITIALIZER_HPP
 #define PHARE_PARTICLE_INITIALIZER_HPP
 
+#include <vector>
+#include <cstdint>
 
 namespace PHARE
 {
@@ -11,6 +13,12 @@ namespace core
     {
     public:
         virtual void loadParticles(ParticleArray& particles, GridLayout const& layout) const = 0;
+
+        /** @brief number of particles loadParticles puts in each physical cell of the layout,
+         * cells being ordered as the layout AMR box iterates them
+         */
+        virtual std::vector<std::uint32_t> nbrParticlesPerCell(GridLayout const& layout) const = 0;
+
         virtual ~ParticleInitializer() = default;
     };
 
@@ -9,6 +9,8 @@
 #include "particle_initializer.hpp"
 
 #include <memory>
+#include <vector>
+#include <stdexcept>
 
 namespace PHARE
 {
@@ -61,6 +63,8 @@ namespace core
                 if (dict.contains("init") && dict["init"].contains("seed"))
                     seed = dict["init"]["seed"].template to<std::optional<std::size_t>>();
 
+                auto const tracers = tracerSelection_(dict);
+
                 std::array<FunctionType, 3> magneticField = {nullptr, nullptr, nullptr};
 
                 if (basisName == "cartesian")
@@ -68,7 +72,7 @@ namespace core
                     return std::make_unique<
                         MaxwellianParticleInitializer<ParticleArray, GridLayout>>(
                         density, v, vth, charge, nbrPartPerCell, seed, Basis::Cartesian,
-                        magneticField, densityCutOff);
+                        magneticField, densityCutOff, tracers);
                 }
                 else if (basisName == "magnetic")
                 {
@@ -79,12 +83,40 @@ namespace core
                     return std::make_unique<
                         MaxwellianParticleInitializer<ParticleArray, GridLayout>>(
                         density, v, vth, charge, nbrPartPerCell, seed, Basis::Magnetic,
-                        magneticField, densityCutOff);
+                        magneticField, densityCutOff, tracers);
                 }
             }
             // TODO throw?
             return nullptr;
         }
+
+    private:
+        // optional "tracers" block, a fraction and possibly a box of lower then upper corners
+        NO_DISCARD static TracerSelection<dimension>
+        tracerSelection_(initializer::PHAREDict const& dict)
+        {
+            if (!dict.contains("tracers"))
+                return {};
+
+            auto const& tracers = dict["tracers"];
+            auto const fraction = cppdict::get_value(tracers, "fraction", double{0});
+            if (fraction > 0 and !ParticleArray::value_type::has_id)
+                throw std::runtime_error("tracers need PHARE built with -DwithTracers=ON");
+            if (!tracers.contains("box"))
+                return {fraction};
+
+            auto const& corners = tracers["box"].template to<std::vector<double>>();
+            if (corners.size() != 2 * dimension)
+                throw std::runtime_error("tracers box must have lower and upper corners");
+
+            typename TracerSelection<dimension>::Region box;
+            for (std::size_t iDim = 0; iDim < dimension; ++iDim)
+            {
+                box[0][iDim] = corners[iDim];
+                box[1][iDim] = corners[dimension + iDim];
+            }
+            return {fraction, box};
+        }
     };
 
 } // namespace core
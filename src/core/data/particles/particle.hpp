@@ -3,6 +3,7 @@
 
 #include <array>
 #include <random>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <algorithm>
@@ -14,6 +15,11 @@
 #include "core/utilities/span.hpp"
 #include "core/utilities/types.hpp"
 
+// particles carry a tracer id only in builds configured with -DwithTracers=ON
+#ifndef PHARE_WITH_TRACERS
+#define PHARE_WITH_TRACERS 0
+#endif
+
 
 namespace PHARE::core
 {
@@ -41,14 +47,19 @@ struct Particle
 {
     static_assert(dim > 0 and dim < 4, "Only dimensions 1,2,3 are supported.");
     static const size_t dimension = dim;
+    static constexpr bool has_id  = PHARE_WITH_TRACERS;
 
     Particle(double a_weight, double a_charge, std::array<int, dim> cell,
-             std::array<double, dim> a_delta, std::array<double, 3> a_v)
+             std::array<double, dim> a_delta, std::array<double, 3> a_v,
+             [[maybe_unused]] std::uint64_t a_id = 0)
         : weight{a_weight}
         , charge{a_charge}
         , iCell{cell}
         , delta{a_delta}
         , v{a_v}
+#if PHARE_WITH_TRACERS
+        , id{a_id}
+#endif
     {
     }
 
@@ -61,13 +72,22 @@ struct Particle
     std::array<double, dim> delta = ConstArray<double, dim>();
     std::array<double, 3> v       = ConstArray<double, 3>();
 
+#if PHARE_WITH_TRACERS
+    // tracer id, see core/data/particles/tracers.hpp, 0 for particles that are not tracers
+    std::uint64_t id = 0;
+#else
+    // no particle is a tracer, and particles do not pay 8 bytes for an id
+    static constexpr std::uint64_t id = 0;
+#endif
+
     NO_DISCARD bool operator==(Particle<dim> const& that) const
     {
         return (this->weight == that.weight) && //
                (this->charge == that.charge) && //
                (this->iCell == that.iCell) &&   //
                (this->delta == that.delta) &&   //
-               (this->v == that.v);
+               (this->v == that.v) &&           //
+               (this->id == that.id);
     }
 
     template<std::size_t dimension>
@@ -93,6 +113,8 @@ std::ostream& operator<<(std::ostream& out, Particle<dim> const& particle)
         out << v << ",";
     }
     out << "), charge : " << particle.charge << ", weight : " << particle.weight;
+    if (particle.id != 0)
+        out << ", id : " << particle.id;
     out << '\n';
     return out;
 }
@@ -114,6 +136,27 @@ struct ParticleView
 
 
 
+/** State of a particle pushed out of its array, i.e. the array particle is left untouched.
+ *  'index' is the position of the particle in the array it was pushed from, from which
+ *  the charge can be retrieved. The weight is kept so the state can be deposited directly.
+ */
+template<std::size_t dim>
+struct PushedParticle
+{
+    static_assert(dim > 0 and dim < 4, "Only dimensions 1,2,3 are supported.");
+    static constexpr std::size_t dimension = dim;
+
+    double weight = 0;
+
+    std::array<int, dim> iCell    = ConstArray<int, dim>();
+    std::array<double, dim> delta = ConstArray<double, dim>();
+    std::array<double, 3> v       = ConstArray<double, 3>();
+
+    std::size_t index = 0;
+};
+
+
+
 template<std::size_t dim, typename T>
 inline constexpr auto is_phare_particle_type
     = std::is_same_v<Particle<dim>, T> or std::is_same_v<ParticleView<dim>, T>;
@@ -144,7 +187,11 @@ NO_DISCARD typename std::enable_if_t<PHARE::core::is_phare_particle_type<dim, Pa
                                      PHARE::core::Particle<dim>>
 copy(Particle_t<dim> const& from)
 {
-    return {from.weight, from.charge, from.iCell, from.delta, from.v};
+    PHARE::core::Particle<dim> to{from.weight, from.charge, from.iCell, from.delta, from.v};
+    if constexpr (PHARE::core::Particle<dim>::has_id
+                  and std::is_same_v<Particle_t<dim>, PHARE::core::Particle<dim>>)
+        to.id = from.id; // views have no id
+    return to;
 }
 
 
@@ -3,6 +3,7 @@
 
 
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -64,10 +65,14 @@ public:
     NO_DISCARD std::size_t size() const { return particles_.size(); }
     NO_DISCARD std::size_t capacity() const { return particles_.capacity(); }
 
+    NO_DISCARD MemoryUsage memory_usage() const { return core::memory_usage(particles_); }
+    NO_DISCARD MemoryUsage cellmap_memory_usage() const { return cellMap_.memory_usage(); }
+
     void clear()
     {
         particles_.clear();
         cellMap_.clear();
+        staleMap_ = false;
     }
     void reserve(std::size_t newSize) { return particles_.reserve(newSize); }
     void resize(std::size_t newSize) { return particles_.resize(newSize); }
@@ -95,10 +100,15 @@ public:
     NO_DISCARD auto back() { return particles_.back(); }
     NO_DISCARD auto front() { return particles_.front(); }
 
-    auto erase(IndexRange_& range) { cellMap_.erase(particles_, range); }
+    auto erase(IndexRange_& range)
+    {
+        remap_();
+        cellMap_.erase(particles_, range);
+    }
     auto erase(IndexRange_&& range)
     {
         // TODO move ctor for range?
+        remap_();
         cellMap_.erase(std::forward<IndexRange_>(range));
     }
 
@@ -144,20 +154,39 @@ public:
         cellMap_.add(particles_, particles_.size() - 1);
     }
 
-    void swap(ParticleArray<dim>& that) { std::swap(this->particles_, that.particles_); }
+    void swap(ParticleArray<dim>& that)
+    {
+        std::swap(this->particles_, that.particles_);
+        std::swap(this->box_, that.box_);
+        std::swap(this->cellMap_, that.cellMap_);
+        std::swap(this->staleMap_, that.staleMap_);
+    }
 
     void map_particles() const { cellMap_.add(particles_); }
-    void empty_map() { cellMap_.empty(); }
+    void empty_map()
+    {
+        cellMap_.empty();
+        staleMap_ = false;
+    }
 
 
-    NO_DISCARD auto nbr_particles_in(box_t const& box) const { return cellMap_.size(box); }
+    NO_DISCARD auto nbr_particles_in(box_t const& box) const
+    {
+        remap_();
+        return cellMap_.size(box);
+    }
 
     using cell_t = std::array<int, dim>;
-    auto nbr_particles_in(cell_t const& cell) const { return cellMap_.size(cell); }
+    auto nbr_particles_in(cell_t const& cell) const
+    {
+        remap_();
+        return cellMap_.size(cell);
+    }
 
     void export_particles(box_t const& box, ParticleArray<dim>& dest) const
     {
         PHARE_LOG_SCOPE(3, "ParticleArray::export_particles");
+        remap_();
         cellMap_.export_to(box, particles_, dest);
     }
 
@@ -165,6 +194,7 @@ public:
     void export_particles(box_t const& box, ParticleArray<dim>& dest, Fn&& fn) const
     {
         PHARE_LOG_SCOPE(3, "ParticleArray::export_particles (Fn)");
+        remap_();
         cellMap_.export_to(box, particles_.data(), dest, std::forward<Fn>(fn));
     }
 
@@ -172,6 +202,7 @@ public:
     void export_particles(box_t const& box, std::vector<Particle_t>& dest, Fn&& fn) const
     {
         PHARE_LOG_SCOPE(3, "ParticleArray::export_particles (box, vector, Fn)");
+        remap_();
         cellMap_.export_to(box, particles_.data(), dest, std::forward<Fn>(fn));
     }
 
@@ -179,6 +210,7 @@ public:
     void export_particles(ParticleArray& dest, Predicate&& pred) const
     {
         PHARE_LOG_SCOPE(3, "ParticleArray::export_particles (Fn,vector)");
+        remap_();
         cellMap_.export_if(particles_.data(), dest, std::forward<Predicate>(pred));
     }
 
@@ -188,28 +220,90 @@ public:
     {
         auto oldCell                    = particles_[particleIndex].iCell;
         particles_[particleIndex].iCell = newCell;
-        if (!box_.isEmpty())
+        if (!box_.isEmpty() and !staleMap_) // a stale map is rebuilt anyway
         {
             cellMap_.update(particles_, particleIndex, oldCell);
         }
     }
 
+    // only changes the particle cell, the cellmap is flagged as stale and
+    // rebuilt in one pass before its next use
+    template<typename Cell>
+    void change_icell_deferred(Cell const& newCell, std::size_t particleIndex)
+    {
+        particles_[particleIndex].iCell = newCell;
+        staleMap_                       = true;
+    }
+
+
+    // working storage of bucket_sort, kept by callers that sort repeatedly to reuse it
+    struct BucketSortBuffer
+    {
+        Vector sorted;
+        std::vector<std::size_t> destination, offsets, next;
+    };
+
+    /** stable counting sort of the particles by bucket(iCell), in [0, nbrBuckets).
+     * Returns the nbrBuckets + 1 offsets of each bucket in the array, held by the buffer.
+     * The particle storage is swapped with the buffer one, so that sorting again allocates
+     * nothing once capacities are reached. A valid cellmap is permuted with the particles.
+     */
+    template<typename Bucket>
+    auto const& bucket_sort(std::size_t const nbrBuckets, Bucket&& bucket,
+                            BucketSortBuffer& buffer)
+    {
+        auto& [sorted, destination, offsets, next] = buffer;
+
+        offsets.assign(nbrBuckets + 1, 0);
+        destination.resize(particles_.size());
+        for (std::size_t pidx = 0; pidx < particles_.size(); ++pidx)
+        {
+            destination[pidx] = bucket(particles_[pidx].iCell);
+            assert(destination[pidx] < nbrBuckets);
+            ++offsets[destination[pidx] + 1];
+        }
+        for (std::size_t iBucket = 0; iBucket < nbrBuckets; ++iBucket)
+            offsets[iBucket + 1] += offsets[iBucket];
+
+        // destination goes from the particle bucket to its index in the sorted array
+        next.assign(offsets.begin(), offsets.end());
+        sorted.resize(particles_.size());
+        for (std::size_t pidx = 0; pidx < particles_.size(); ++pidx)
+        {
+            destination[pidx]         = next[destination[pidx]]++;
+            sorted[destination[pidx]] = particles_[pidx];
+        }
+
+        particles_.swap(sorted);
+        if (!staleMap_)
+            cellMap_.permute(destination);
+
+        return offsets;
+    }
+
+    // to call after changing the particle vector directly, the cellmap is rebuilt before its
+    // next use
+    void stale_map() { staleMap_ = true; }
+
 
     template<typename Predicate>
     auto partition(Predicate&& pred)
     {
+        remap_();
         return cellMap_.partition(makeIndexRange(*this), std::forward<Predicate>(pred));
     }
 
     template<typename CellIndex>
     void print(CellIndex const& cell) const
     {
+        remap_();
         cellMap_.print(cell);
     }
 
 
     NO_DISCARD bool is_mapped() const
     {
+        remap_();
         bool ok = true;
         if (particles_.size() != cellMap_.size())
         {
@@ -219,17 +313,21 @@ public:
         {
             auto const& p = particles_[pidx];
             auto& icell   = p.iCell;
-            auto l        = cellMap_.list_at(icell);
-            if (!l)
+            if (!isIn(Point{icell}, cellMap_.box()))
                 throw std::runtime_error("particle cell not mapped");
-            auto& ll = l->get();
-            if (!ll.is_indexed(pidx))
+            if (!cellMap_(icell).is_indexed(pidx))
                 throw std::runtime_error("particle not indexed");
         }
         return true;
     }
 
-    void sortMapping() const { cellMap_.sort(); }
+    void sortMapping() const
+    {
+        remap_();
+        cellMap_.sort();
+    }
+
+    NO_DISCARD bool has_stale_map() const { return staleMap_; }
 
     NO_DISCARD auto& vector() { return particles_; }
     NO_DISCARD auto& vector() const { return particles_; }
@@ -243,16 +341,27 @@ public:
             return *this;
         this->resize(that.size());
         std::copy(that.begin(), that.end(), this->begin());
-        this->box_     = that.box_;
-        this->cellMap_ = that.cellMap_;
+        this->box_      = that.box_;
+        this->cellMap_  = that.cellMap_;
+        this->staleMap_ = that.staleMap_;
         return *this;
     }
 
 
 private:
+    void remap_() const
+    {
+        if (staleMap_)
+        {
+            cellMap_.rebuild(particles_);
+            staleMap_ = false;
+        }
+    }
+
     Vector particles_;
     box_t box_;
     mutable CellMap_t cellMap_;
+    mutable bool staleMap_ = false;
 };
 
 } // namespace PHARE::core
@@ -292,6 +401,7 @@ namespace core
             , weight(s)
             , charge(s)
             , v(s * 3)
+            , id(Particle<dim>::has_id ? s : 0)
         {
         }
 
@@ -327,7 +437,15 @@ namespace core
             };
         }
 
-        NO_DISCARD auto copy(std::size_t i) { return _to<Particle<dim>>(i); }
+        // views of arrays given without ids, or built without tracers, are not tracers
+        NO_DISCARD auto copy(std::size_t i)
+        {
+            auto particle = _to<Particle<dim>>(i);
+            if constexpr (Particle<dim>::has_id)
+                if (i < id.size())
+                    particle.id = id[i];
+            return particle;
+        }
         NO_DISCARD auto view(std::size_t i) { return _to<ParticleView<dim>>(i); }
 
         NO_DISCARD auto operator[](std::size_t i) const { return view(i); }
@@ -360,11 +478,17 @@ namespace core
 
         NO_DISCARD auto as_tuple()
         {
-            return std::forward_as_tuple(weight, charge, iCell, delta, v);
+            if constexpr (Particle<dim>::has_id)
+                return std::forward_as_tuple(weight, charge, iCell, delta, v, id);
+            else
+                return std::forward_as_tuple(weight, charge, iCell, delta, v);
         }
         NO_DISCARD auto as_tuple() const
         {
-            return std::forward_as_tuple(weight, charge, iCell, delta, v);
+            if constexpr (Particle<dim>::has_id)
+                return std::forward_as_tuple(weight, charge, iCell, delta, v, id);
+            else
+                return std::forward_as_tuple(weight, charge, iCell, delta, v);
         }
 
         NO_DISCARD auto begin() { return iterator(this); }
@@ -376,6 +500,7 @@ namespace core
         container_t<int> iCell;
         container_t<double> delta;
         container_t<double> weight, charge, v;
+        container_t<std::uint64_t> id;
     };
 
 
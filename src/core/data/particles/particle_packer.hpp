@@ -15,7 +15,9 @@ template<std::size_t dim>
 class ParticlePacker
 {
 public:
-    static constexpr std::size_t n_keys = 5;
+    // ids are packed only in builds with tracers, see PHARE_WITH_TRACERS
+    static constexpr bool has_id        = Particle<dim>::has_id;
+    static constexpr std::size_t n_keys = has_id ? 6 : 5;
 
     ParticlePacker(ParticleArray<dim> const& particles)
         : particles_{particles}
@@ -24,8 +26,12 @@ public:
 
     NO_DISCARD static auto get(Particle<dim> const& particle)
     {
-        return std::forward_as_tuple(particle.weight, particle.charge, particle.iCell,
-                                     particle.delta, particle.v);
+        if constexpr (has_id)
+            return std::forward_as_tuple(particle.weight, particle.charge, particle.iCell,
+                                         particle.delta, particle.v, particle.id);
+        else
+            return std::forward_as_tuple(particle.weight, particle.charge, particle.iCell,
+                                         particle.delta, particle.v);
     }
 
     static auto empty()
@@ -58,6 +64,8 @@ public:
             copyTo(std::get<2>(next), idx, dim, copy.iCell);
             copyTo(std::get<3>(next), idx, dim, copy.delta);
             copyTo(std::get<4>(next), idx, 3, copy.v);
+            if constexpr (has_id)
+                copy.id[idx] = std::get<5>(next);
             idx++;
         }
     }
@@ -65,8 +73,12 @@ public:
 private:
     ParticleArray<dim> const& particles_;
     std::size_t it_ = 0;
-    static inline const std::array<std::string, n_keys> keys_{"weight", "charge", "iCell", "delta",
-                                                              "v"};
+    static inline const std::array<std::string, n_keys> keys_ = [] {
+        std::array<std::string, n_keys> keys{"weight", "charge", "iCell", "delta", "v"};
+        if constexpr (has_id)
+            keys.back() = "id";
+        return keys;
+    }();
 };
 
 
@@ -0,0 +1,119 @@
+#ifndef PHARE_CORE_DATA_PARTICLES_TRACERS_HPP
+#define PHARE_CORE_DATA_PARTICLES_TRACERS_HPP
+
+
+#include "core/def.hpp"
+
+#include <array>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+
+
+namespace PHARE::core
+{
+/** \brief TracerSelection gives the tracer ids of the particles loaded by particle initializers.
+ *
+ * A particle is the iPart-th particle loaded in its cell of the root level, its id packs the cell
+ * AMR index in the high 48 bits and iPart + 1 in the low 16 bits, so that ids are unique per
+ * population and do not depend on the patches or ranks the particles were loaded on. Id 0 is
+ * for particles that are not tracers.
+ *
+ * A fraction of the particles, optionally restricted to those loaded in a physical box, are
+ * tracers. The choice hashes the id, so that it is reproducible regardless of random seeds.
+ *
+ * Ids are then kept by the particle in moves, exchanges and restarts, and particles split from a
+ * tracer, on refined levels or by resampling, inherit its id. Ids are thus unique on the root
+ * level only.
+ *
+ * Particles carry an id only in builds with -DwithTracers=ON, see PHARE_WITH_TRACERS.
+ */
+template<std::size_t dim>
+class TracerSelection
+{
+public:
+    // physical lower and upper corners
+    using Region = std::array<std::array<double, dim>, 2>;
+
+    static constexpr std::uint64_t untraced    = 0;
+    static constexpr std::size_t bitsPerPart   = 16;
+    static constexpr std::size_t bitsPerCell   = (64 - bitsPerPart) / dim;
+    static constexpr std::uint64_t maxPerCell  = (std::uint64_t{1} << bitsPerPart) - 1;
+    static constexpr std::uint64_t cellsPerDim = std::uint64_t{1} << bitsPerCell;
+
+
+    TracerSelection() = default;
+
+    TracerSelection(double fraction, std::optional<Region> box = std::nullopt)
+        : fraction_{fraction}
+        , box_{box}
+    {
+        if (fraction_ < 0 or fraction_ > 1)
+            throw std::runtime_error("TracerSelection: fraction must be in [0, 1]");
+    }
+
+
+    NO_DISCARD bool any() const { return fraction_ > 0; }
+
+
+    /** @brief id of the iPart-th particle of the root level cell iCell, at the given physical
+     * position, untraced if it is not selected
+     */
+    NO_DISCARD std::uint64_t id(std::array<int, dim> const& iCell, std::uint32_t iPart,
+                                std::array<double, dim> const& position) const
+    {
+        if (!any() or (box_ and !contains_(*box_, position)))
+            return untraced;
+
+        if (iPart >= maxPerCell)
+            throw std::runtime_error("TracerSelection: too many particles per cell for ids");
+
+        std::uint64_t id = 0;
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        {
+            auto const i = static_cast<std::uint64_t>(iCell[iDim]);
+            if (iCell[iDim] < 0 or i >= cellsPerDim)
+                throw std::runtime_error("TracerSelection: cell out of the range of ids");
+            id |= i << (bitsPerPart + iDim * bitsPerCell);
+        }
+        id |= iPart + 1;
+
+        return selected_(id) ? id : untraced;
+    }
+
+
+private:
+    NO_DISCARD bool selected_(std::uint64_t const id) const
+    {
+        if (fraction_ >= 1)
+            return true;
+
+        // splitmix64 finalizer, spreads consecutive ids uniformly
+        auto hash = id + 0x9e3779b97f4a7c15;
+        hash      = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+        hash      = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+        hash      = hash ^ (hash >> 31);
+
+        return static_cast<double>(hash)
+               < fraction_ * static_cast<double>(std::numeric_limits<std::uint64_t>::max());
+    }
+
+    NO_DISCARD static bool contains_(Region const& box, std::array<double, dim> const& position)
+    {
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            if (position[iDim] < box[0][iDim] or position[iDim] >= box[1][iDim])
+                return false;
+        return true;
+    }
+
+
+    double fraction_ = 0;
+    std::optional<Region> box_;
+};
+
+} // namespace PHARE::core
+
+
+#endif
@@ -0,0 +1,215 @@
+#ifndef PHARE_CORE_DATA_TIME_AVERAGE_TIME_AVERAGES_HPP
+#define PHARE_CORE_DATA_TIME_AVERAGE_TIME_AVERAGES_HPP
+
+#include "core/def.hpp"
+#include "core/hybrid/hybrid_quantities.hpp"
+#include "core/data/vecfield/vecfield_component.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace PHARE::core
+{
+/**
+ * @brief TimeAverages holds the running sums of the quantities the time_average diagnostics
+ * average between two of their dumps.
+ *
+ * Each sum is a field with the centering of the field it sums, a resource of the model like the
+ * others, so that it is allocated on all patches, refined on new levels and regrids, and saved in
+ * restarts. All patches are sampled at the same times, the number of samples of a quantity is
+ * thus the same everywhere and kept here.
+ *
+ * Quantities are named after the datasets of the electromag and fluid diagnostics:
+ * EM_E, EM_B, density and bulkVelocity, sums are named timeAverage_ + dataset, like
+ * timeAverage_EM_B_x.
+ */
+template<typename VecFieldT>
+class TimeAverages
+{
+public:
+    using field_type                       = typename VecFieldT::field_type;
+    static constexpr std::size_t dimension = VecFieldT::dimension;
+
+    static inline std::string const prefix = "timeAverage_";
+
+    /** @brief adds the sums of quantity, once. Sums must be added before the resources manager
+     * registers them.
+     */
+    void add(std::string const& quantity)
+    {
+        if (has(quantity))
+            return;
+
+        if (quantity == "density")
+            sums_.emplace_back(prefix + quantity, HybridQuantity::Scalar::rho);
+        else
+        {
+            auto const qties = HybridQuantity::componentsQuantities(vector_(quantity));
+            for (std::size_t i = 0; i < components_.size(); ++i)
+                sums_.emplace_back(prefix + quantity + "_" + components_[i].first, qties[i]);
+        }
+        quantities_.push_back(quantity);
+        nbrSamples_.push_back(0);
+    }
+
+    NO_DISCARD bool has(std::string const& quantity) const
+    {
+        return std::find(std::begin(quantities_), std::end(quantities_), quantity)
+               != std::end(quantities_);
+    }
+
+    NO_DISCARD bool empty() const { return quantities_.empty(); }
+
+    NO_DISCARD auto& quantities() const { return quantities_; }
+
+
+    /** @brief names of all the sums, for the messenger to refine them */
+    NO_DISCARD std::vector<std::string> names() const
+    {
+        std::vector<std::string> names;
+        for (auto const& sum : sums_)
+            names.push_back(sum.name());
+        return names;
+    }
+
+
+    //! same on all patches, restored from restarts by the model
+    NO_DISCARD std::size_t& nbrSamples(std::string const& quantity)
+    {
+        return nbrSamples_[index_(quantity)];
+    }
+
+    NO_DISCARD std::size_t nbrSamples(std::string const& quantity) const
+    {
+        return nbrSamples_[index_(quantity)];
+    }
+
+
+    /** @brief sums of quantity on the patch the TimeAverages is set on, one per component */
+    NO_DISCARD std::vector<field_type*> sums(std::string const& quantity)
+    {
+        std::vector<field_type*> sums;
+        for (auto& sum : sums_)
+            if (quantity_of_(sum) == quantity)
+                sums.push_back(&sum);
+        return sums;
+    }
+
+    //! dataset name of a sum, e.g. EM_B_x for timeAverage_EM_B_x
+    NO_DISCARD static std::string datasetName(field_type const& sum)
+    {
+        return sum.name().substr(prefix.size());
+    }
+
+
+    /** @brief adds the current value of quantity to its sums on the patch the TimeAverages and
+     * the model are set on, ghost nodes included. nbrSamples is left to the caller since a
+     * sample is taken on all patches.
+     */
+    template<typename Electromag, typename Ions>
+    void accumulate(std::string const& quantity, Electromag const& electromag, Ions const& ions)
+    {
+        auto sums = this->sums(quantity);
+
+        auto add = [](auto& sum, auto const& field) {
+            std::transform(std::begin(sum), std::end(sum), std::begin(field), std::begin(sum),
+                           [](auto const s, auto const f) { return s + f; });
+        };
+        auto addVecField = [&](auto const& vecField) {
+            for (std::size_t i = 0; i < components_.size(); ++i)
+                add(*sums[i], vecField.getComponent(components_[i].second));
+        };
+
+        if (quantity == "EM_E")
+            addVecField(electromag.E);
+        else if (quantity == "EM_B")
+            addVecField(electromag.B);
+        else if (quantity == "density")
+            add(*sums[0], ions.density());
+        else if (quantity == "bulkVelocity")
+            addVecField(ions.velocity());
+    }
+
+
+    /** @brief zeroes the sums of quantity on the patch the TimeAverages is set on */
+    void zero(std::string const& quantity)
+    {
+        for (auto* sum : sums(quantity))
+            sum->zero();
+    }
+
+    void zero()
+    {
+        for (auto& sum : sums_)
+            sum.zero();
+    }
+
+
+    //-------------------------------------------------------------------------
+    //                  start the ResourcesUser interface
+    //-------------------------------------------------------------------------
+
+    NO_DISCARD bool isUsable() const
+    {
+        return std::all_of(std::begin(sums_), std::end(sums_),
+                           [](auto const& sum) { return sum.isUsable(); });
+    }
+
+    NO_DISCARD bool isSettable() const
+    {
+        return std::all_of(std::begin(sums_), std::end(sums_),
+                           [](auto const& sum) { return sum.isSettable(); });
+    }
+
+    NO_DISCARD std::vector<field_type>& getRunTimeResourcesViewList() { return sums_; }
+
+    //-------------------------------------------------------------------------
+    //                  ends the ResourcesUser interface
+    //-------------------------------------------------------------------------
+
+
+private:
+    NO_DISCARD static HybridQuantity::Vector vector_(std::string const& quantity)
+    {
+        if (quantity == "EM_E")
+            return HybridQuantity::Vector::E;
+        if (quantity == "EM_B")
+            return HybridQuantity::Vector::B;
+        if (quantity == "bulkVelocity")
+            return HybridQuantity::Vector::V;
+        throw std::runtime_error("TimeAverages: no time average for " + quantity);
+    }
+
+    NO_DISCARD static std::string quantity_of_(field_type const& sum)
+    {
+        auto const dataset = datasetName(sum);
+        if (dataset == "density")
+            return dataset;
+        return dataset.substr(0, dataset.rfind('_'));
+    }
+
+    NO_DISCARD std::size_t index_(std::string const& quantity) const
+    {
+        auto const it = std::find(std::begin(quantities_), std::end(quantities_), quantity);
+        if (it == std::end(quantities_))
+            throw std::runtime_error("TimeAverages: " + quantity + " is not averaged");
+        return static_cast<std::size_t>(std::distance(std::begin(quantities_), it));
+    }
+
+    // sums of a vector quantity are in this order
+    static inline std::array<std::pair<std::string, Component>, 3> const components_{
+        {{"x", Component::X}, {"y", Component::Y}, {"z", Component::Z}}};
+
+    std::vector<std::string> quantities_;
+    std::vector<std::size_t> nbrSamples_;
+    std::vector<field_type> sums_; // components of each quantity, in the order of quantities_
+};
+
+} // namespace PHARE::core
+
+#endif
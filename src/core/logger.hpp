@@ -39,30 +39,33 @@ constexpr static std::uint8_t LOG_LEVEL = PHARE_LOG_LEVEL;
 #include <string>
 #include <utility>
 
+#if PHARE_WITH_CALIPER
 namespace PHARE
 {
+// caliper scopes, keys are string literals so nothing is copied for disabled levels
 struct scope_log
 {
-    scope_log(int&& i_, std::string&& str)
+    scope_log(int const i_, char const* const key_)
         : i{i_}
-        , key{std::move(str)}
+        , key{key_}
     {
         if (i <= LOG_LEVEL)
         {
-            PHARE_LOG_START(i, key.c_str());
+            PHARE_LOG_START(i, key);
         }
     }
     ~scope_log()
     {
         if (i <= LOG_LEVEL)
         {
-            PHARE_LOG_STOP(i, key.c_str());
+            PHARE_LOG_STOP(i, key);
         }
     }
 
-    int i;
-    std::string key;
+    int const i;
+    char const* const key;
 };
 } // namespace PHARE
+#endif // PHARE_WITH_CALIPER
 
 #endif /* PHARE_CORE_LOGGER_H */
@@ -0,0 +1,261 @@
+#ifndef PHARE_CORE_NUMERICS_DISTRIBUTION_VELOCITY_HISTOGRAM_HPP
+#define PHARE_CORE_NUMERICS_DISTRIBUTION_VELOCITY_HISTOGRAM_HPP
+
+
+#include "core/def.hpp"
+#include "core/utilities/box/box.hpp"
+#include "core/numerics/interpolator/interpolator.hpp"
+#include "core/data/ions/particle_initializers/maxwellian_particle_initializer.hpp"
+
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <optional>
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace PHARE::core
+{
+/** \brief VelocityHistogram bins the velocities of particles in 1 to 3 velocity axes, in each of
+ * several spatial regions, particles counting for their weight.
+ *
+ * Axes are velocity components in the cartesian basis (vx, vy, vz), or in the local magnetic
+ * basis of localMagneticBasis (vpar along B, vperp1, vperp2, and vperp the norm of the last two),
+ * B being interpolated at the particle as for the push. Velocities out of the range of an axis
+ * are not counted.
+ *
+ * Regions are either boxes in physical coordinates, a particle counting in all the boxes that
+ * contain it, or the cells of the coarsest level, particles of a refined level counting in the
+ * coarse cell that contains them. Particles of a single level must be added, as domain particles
+ * of different levels overlap.
+ *
+ * Counts are region major, then by axis in the given order, the last axis varying fastest.
+ */
+template<std::size_t dim>
+class VelocityHistogram
+{
+public:
+    enum class Component { vx, vy, vz, vpar, vperp1, vperp2, vperp };
+
+    struct Axis
+    {
+        Component component;
+        std::size_t nbrBins;
+        double min, max;
+    };
+
+    // physical lower and upper corners
+    using Region = std::array<std::array<double, dim>, 2>;
+
+
+    /** @brief histograms of particles in each of the given boxes */
+    VelocityHistogram(std::vector<Axis> axes, std::vector<Region> boxes)
+        : axes_{checked_(std::move(axes))}
+        , boxes_{std::move(boxes)}
+        , counts_(boxes_.size() * binsPerRegion_(), 0.)
+    {
+    }
+
+    /** @brief histograms of particles in each cell of the coarsest level, whose cells are
+     * coarseMeshSize wide. Regions are ordered like field datasets, x varying slowest.
+     */
+    VelocityHistogram(std::vector<Axis> axes, Box<int, dim> const& coarseCells,
+                      std::array<double, dim> const& coarseMeshSize)
+        : axes_{checked_(std::move(axes))}
+        , coarseCells_{coarseCells}
+        , coarseMeshSize_{coarseMeshSize}
+        , counts_(coarseCells.size() * binsPerRegion_(), 0.)
+    {
+    }
+
+
+    NO_DISCARD static Component component(std::string const& name)
+    {
+        for (std::size_t i = 0; i < componentNames_.size(); ++i)
+            if (componentNames_[i] == name)
+                return static_cast<Component>(i);
+        throw std::runtime_error("VelocityHistogram: unknown velocity axis " + name);
+    }
+
+    //! true if an axis is in the local magnetic basis
+    NO_DISCARD bool magnetic() const
+    {
+        return std::any_of(std::begin(axes_), std::end(axes_),
+                           [](auto const& axis) { return axis.component >= Component::vpar; });
+    }
+
+    NO_DISCARD std::size_t nbrRegions() const
+    {
+        return coarseCells_ ? coarseCells_->size() : boxes_.size();
+    }
+
+    //! shape of the counts, the shape of the coarse cells or the number of boxes, then the bins
+    NO_DISCARD std::vector<std::size_t> shape() const
+    {
+        std::vector<std::size_t> shape;
+        if (coarseCells_)
+            for (auto const n : coarseCells_->shape())
+                shape.push_back(static_cast<std::size_t>(n));
+        else
+            shape.push_back(boxes_.size());
+        for (auto const& axis : axes_)
+            shape.push_back(axis.nbrBins);
+        return shape;
+    }
+
+    NO_DISCARD auto& counts() { return counts_; }
+    NO_DISCARD auto& counts() const { return counts_; }
+
+    void zero() { std::fill(std::begin(counts_), std::end(counts_), 0.); }
+
+
+    /** @brief bins the particles of a patch whose layout is given, em is only read if an axis is
+     * in the magnetic basis
+     */
+    template<typename Particles, typename Electromag, typename GridLayout>
+    void add(Particles const& particles, Electromag const& em, GridLayout const& layout)
+    {
+        Interpolator<dim, GridLayout::interp_order> interpolator;
+        bool const magnetic = this->magnetic();
+
+        auto const ratio = [&]() {
+            std::array<int, dim> ratio{};
+            if (coarseCells_)
+                for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                    ratio[iDim] = static_cast<int>(
+                        std::round(coarseMeshSize_[iDim] / layout.meshSize()[iDim]));
+            return ratio;
+        }();
+
+        std::array<std::array<double, 3>, 3> basis;
+        for (auto const& particle : particles)
+        {
+            if (magnetic)
+                localMagneticBasis(std::get<1>(interpolator(particle, em, layout)), basis);
+
+            auto const bin = bin_(particle.v, basis);
+            if (!bin)
+                continue;
+
+            if (coarseCells_)
+                counts_[coarseCell_(particle.iCell, ratio) * binsPerRegion_() + *bin]
+                    += particle.weight;
+            else
+            {
+                auto const position = position_(particle, layout);
+                for (std::size_t iBox = 0; iBox < boxes_.size(); ++iBox)
+                    if (contains_(boxes_[iBox], position))
+                        counts_[iBox * binsPerRegion_() + *bin] += particle.weight;
+            }
+        }
+    }
+
+
+private:
+    static inline std::array<std::string, 7> const componentNames_{
+        "vx", "vy", "vz", "vpar", "vperp1", "vperp2", "vperp"};
+
+    static std::vector<Axis> checked_(std::vector<Axis> axes)
+    {
+        if (axes.empty() or axes.size() > 3)
+            throw std::runtime_error("VelocityHistogram: 1 to 3 velocity axes are needed");
+        for (auto const& axis : axes)
+            if (axis.nbrBins == 0 or !(axis.max > axis.min))
+                throw std::runtime_error(
+                    "VelocityHistogram: invalid bins of axis "
+                    + componentNames_[static_cast<std::size_t>(axis.component)]);
+        return axes;
+    }
+
+    NO_DISCARD std::size_t binsPerRegion_() const
+    {
+        std::size_t bins = 1;
+        for (auto const& axis : axes_)
+            bins *= axis.nbrBins;
+        return bins;
+    }
+
+    NO_DISCARD static double component_(Component const component, std::array<double, 3> const& v,
+                                        std::array<std::array<double, 3>, 3> const& basis)
+    {
+        auto dot = [&](auto const& e) { return v[0] * e[0] + v[1] * e[1] + v[2] * e[2]; };
+
+        switch (component)
+        {
+            case Component::vx: return v[0];
+            case Component::vy: return v[1];
+            case Component::vz: return v[2];
+            case Component::vpar: return dot(basis[0]);
+            case Component::vperp1: return dot(basis[1]);
+            case Component::vperp2: return dot(basis[2]);
+            case Component::vperp: return std::hypot(dot(basis[1]), dot(basis[2]));
+        }
+        return 0.;
+    }
+
+    NO_DISCARD std::optional<std::size_t>
+    bin_(std::array<double, 3> const& v, std::array<std::array<double, 3>, 3> const& basis) const
+    {
+        std::size_t bin = 0;
+        for (auto const& axis : axes_)
+        {
+            auto const value = component_(axis.component, v, basis);
+            if (value < axis.min or value >= axis.max)
+                return std::nullopt;
+            auto const i = static_cast<std::size_t>((value - axis.min) / (axis.max - axis.min)
+                                                    * axis.nbrBins);
+            bin = bin * axis.nbrBins + std::min(i, axis.nbrBins - 1);
+        }
+        return bin;
+    }
+
+    NO_DISCARD std::size_t coarseCell_(std::array<int, dim> const& iCell,
+                                       std::array<int, dim> const& ratio) const
+    {
+        auto floorDiv = [](int a, int b) { return a / b - (a % b != 0 and (a < 0) != (b < 0)); };
+
+        auto const shape = coarseCells_->shape();
+        std::size_t cell = 0;
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        {
+            auto const i = floorDiv(iCell[iDim], ratio[iDim]) - coarseCells_->lower[iDim];
+            cell         = cell * shape[iDim] + static_cast<std::size_t>(i);
+        }
+        return cell;
+    }
+
+    template<typename Particle, typename GridLayout>
+    NO_DISCARD static auto position_(Particle const& particle, GridLayout const& layout)
+    {
+        auto const& lower = layout.AMRBox().lower;
+        std::array<double, dim> position;
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            position[iDim] = layout.origin()[iDim]
+                             + (particle.iCell[iDim] - lower[iDim] + particle.delta[iDim])
+                                   * layout.meshSize()[iDim];
+        return position;
+    }
+
+    NO_DISCARD static bool contains_(Region const& box, std::array<double, dim> const& position)
+    {
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            if (position[iDim] < box[0][iDim] or position[iDim] >= box[1][iDim])
+                return false;
+        return true;
+    }
+
+
+    std::vector<Axis> axes_;
+    std::vector<Region> boxes_;
+    std::optional<Box<int, dim>> coarseCells_;
+    std::array<double, dim> coarseMeshSize_{};
+    std::vector<double> counts_;
+};
+
+} // namespace PHARE::core
+
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef PHARE_CORE_NUMERICS_INTERPOLATOR_ELECTROMAG_GATHER_BUFFER_HPP
+#define PHARE_CORE_NUMERICS_INTERPOLATOR_ELECTROMAG_GATHER_BUFFER_HPP
+
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "core/def.hpp"
+#include "core/logger.hpp"
+#include "core/utilities/types.hpp"
+#include "core/hybrid/hybrid_quantities.hpp"
+#include "core/data/ndarray/ndarray_vector.hpp"
+
+
+namespace PHARE::core
+{
+/** \brief ElectromagGatherBuffer interleaves the 6 electromagnetic components on a single
+ * array, so that the mesh to particle interpolation of E and B reads one memory
+ * stream instead of six.
+ *
+ * Node (i,j,k) of the buffer holds {Ex, Ey, Ez, Bx, By, Bz}(i,j,k), i.e. each
+ * component at its own local index (i,j,k), whatever its centering. The buffer extent
+ * is the largest component allocation size in each direction, nodes a component
+ * does not have are set to zero.
+ */
+template<std::size_t dim>
+class ElectromagGatherBuffer
+{
+public:
+    static constexpr std::size_t dimension     = dim;
+    static constexpr std::size_t nbrComponents = 6;
+
+    using Node = std::array<double, nbrComponents>;
+
+    static constexpr auto components
+        = std::array{HybridQuantity::Scalar::Ex, HybridQuantity::Scalar::Ey,
+                     HybridQuantity::Scalar::Ez, HybridQuantity::Scalar::Bx,
+                     HybridQuantity::Scalar::By, HybridQuantity::Scalar::Bz};
+
+
+    /** copies E and B of the given Electromag in the buffer,
+     * to be called each time E or B have changed.
+     */
+    template<typename Electromag, typename GridLayout>
+    void pack(Electromag const& em, GridLayout const& layout)
+    {
+        PHARE_LOG_SCOPE(3, "ElectromagGatherBuffer::pack");
+
+        auto shape = ConstArray<std::uint32_t, dim>(0);
+        for (auto const qty : components)
+        {
+            auto const allocSize = layout.allocSize(qty);
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                shape[iDim] = std::max(shape[iDim], allocSize[iDim]);
+        }
+
+        // nodes outside of a component allocation are zero since construction
+        // and component allocation sizes only depend on the buffer shape
+        if (nodes_.shape() != shape)
+            nodes_ = NdArrayVector<dim, Node>{shape};
+
+        auto const& [Ex, Ey, Ez] = em.E();
+        auto const& [Bx, By, Bz] = em.B();
+
+        pack_(Ex, 0);
+        pack_(Ey, 1);
+        pack_(Ez, 2);
+        pack_(Bx, 3);
+        pack_(By, 4);
+        pack_(Bz, 5);
+    }
+
+
+    template<typename... Indexes>
+    NO_DISCARD Node const& operator()(Indexes... indexes) const
+    {
+        return nodes_(indexes...);
+    }
+
+    NO_DISCARD auto& shape() const { return nodes_.shape(); }
+
+    NO_DISCARD std::size_t size() const { return nodes_.size(); }
+
+    void clear() { nodes_ = NdArrayVector<dim, Node>{ConstArray<std::uint32_t, dim>(0)}; }
+
+
+private:
+    template<typename Field>
+    void pack_(Field const& field, std::size_t const component)
+    {
+        auto const shape = field.shape();
+
+        if constexpr (dim == 1)
+        {
+            for (std::uint32_t ix = 0; ix < shape[0]; ++ix)
+                nodes_(ix)[component] = field(ix);
+        }
+        else if constexpr (dim == 2)
+        {
+            for (std::uint32_t ix = 0; ix < shape[0]; ++ix)
+                for (std::uint32_t iy = 0; iy < shape[1]; ++iy)
+                    nodes_(ix, iy)[component] = field(ix, iy);
+        }
+        else if constexpr (dim == 3)
+        {
+            for (std::uint32_t ix = 0; ix < shape[0]; ++ix)
+                for (std::uint32_t iy = 0; iy < shape[1]; ++iy)
+                    for (std::uint32_t iz = 0; iz < shape[2]; ++iz)
+                        nodes_(ix, iy, iz)[component] = field(ix, iy, iz);
+        }
+    }
+
+    NdArrayVector<dim, Node> nodes_{ConstArray<std::uint32_t, dim>(0)};
+};
+
+} // namespace PHARE::core
+
+
+#endif
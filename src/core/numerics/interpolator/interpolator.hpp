@@ -5,13 +5,16 @@
 
 #include <array>
 #include <cstddef>
+#include <algorithm>
 
+#include "core/utilities/types.hpp"
 #include "core/utilities/point/point.hpp"
 #include "core/def.hpp"
 #include "core/logger.hpp"
 #include "core/hybrid/hybrid_quantities.hpp"
 #include "core/data/grid/gridlayoutdefs.hpp"
 #include "core/utilities/range/range.hpp"
+#include "core/numerics/interpolator/electromag_gather_buffer.hpp"
 
 
 
@@ -460,6 +463,98 @@ public:
 
 
 
+    /**\brief same as above, but E and B are read from an ElectromagGatherBuffer
+     *
+     * Components sharing their primal/dual centering in all directions share their stencil.
+     * Each of the at most 2^dim centering combinations walks its own stencil once, computing
+     * the weight product of each node once for all its components, and reads the 6
+     * interleaved components of the node together.
+     */
+    template<typename Particle_t, typename GridLayout>
+    inline auto operator()(Particle_t& currPart, ElectromagGatherBuffer<dim> const& emBuffer,
+                           GridLayout const& layout)
+    {
+        using E_B_tuple = std::tuple<std::array<double, 3>, std::array<double, 3>>;
+        using Buffer    = ElectromagGatherBuffer<dim>;
+
+        auto constexpr support         = nbrPointsSupport(interpOrder);
+        auto constexpr nbrCombinations = std::uint16_t{1} << dimension;
+
+        // bit iDim of the combination of a component is set if it is dual in direction iDim
+        static constexpr auto combinations = []() {
+            std::array<std::size_t, Buffer::nbrComponents> combinations{};
+            for (std::size_t iComp = 0; iComp < combinations.size(); ++iComp)
+            {
+                auto const centerings = GridLayout::centering(Buffer::components[iComp]);
+                for (std::size_t iDim = 0; iDim < dimension; ++iDim)
+                    if (centerings[iDim] == QtyCentering::dual)
+                        combinations[iComp] |= std::size_t{1} << iDim;
+            }
+            return combinations;
+        }();
+
+        auto& iCell = currPart.iCell;
+        auto& delta = currPart.delta;
+        indexAndWeights_<QtyCentering, QtyCentering::dual>(layout, iCell, delta);
+        indexAndWeights_<QtyCentering, QtyCentering::primal>(layout, iCell, delta);
+
+        std::array<double, Buffer::nbrComponents> EB{};
+
+        for_N<nbrCombinations>([&](auto ic) {
+            constexpr std::size_t combination = ic();
+
+            // e.g. dual in all directions is not the centering of any component in 3D
+            if constexpr (std::find(combinations.begin(), combinations.end(), combination)
+                          != combinations.end())
+            {
+                Starts starts;
+                std::array<std::array<double, support> const*, dimension> weights;
+                for (std::size_t iDim = 0; iDim < dimension; ++iDim)
+                {
+                    bool const dual = (combination >> iDim) & 1;
+                    starts[iDim]    = dual ? dual_startIndex_[iDim] : primal_startIndex_[iDim];
+                    weights[iDim]   = dual ? &dual_weights_[iDim] : &primal_weights_[iDim];
+                }
+
+                auto accumulate = [&](auto const& node, double const weight) {
+                    for_N<Buffer::nbrComponents>([&](auto iComp) {
+                        if constexpr (combinations[iComp()] == combination)
+                            EB[iComp()] += node[iComp()] * weight;
+                    });
+                };
+
+                if constexpr (dimension == 1)
+                {
+                    for (auto ix = 0u; ix < support; ++ix)
+                        accumulate(emBuffer(starts[0] + ix), (*weights[0])[ix]);
+                }
+                else if constexpr (dimension == 2)
+                {
+                    for (auto ix = 0u; ix < support; ++ix)
+                        for (auto iy = 0u; iy < support; ++iy)
+                            accumulate(emBuffer(starts[0] + ix, starts[1] + iy),
+                                       (*weights[0])[ix] * (*weights[1])[iy]);
+                }
+                else if constexpr (dimension == 3)
+                {
+                    for (auto ix = 0u; ix < support; ++ix)
+                        for (auto iy = 0u; iy < support; ++iy)
+                        {
+                            auto const xyWeight = (*weights[0])[ix] * (*weights[1])[iy];
+                            for (auto iz = 0u; iz < support; ++iz)
+                                accumulate(
+                                    emBuffer(starts[0] + ix, starts[1] + iy, starts[2] + iz),
+                                    xyWeight * (*weights[2])[iz]);
+                        }
+                }
+            }
+        });
+
+        return E_B_tuple{{EB[0], EB[1], EB[2]}, {EB[3], EB[4], EB[5]}};
+    }
+
+
+
     /**\brief interpolate electromagnetic fields on all particles in the range
      *
      * For each particle :
@@ -5,10 +5,12 @@
 #include "core/utilities/box/box.hpp"
 #include "core/utilities/range/range.hpp"
 #include "core/numerics/interpolator/interpolator.hpp"
+#include "core/numerics/interpolator/electromag_gather_buffer.hpp"
 #include "core/numerics/pusher/pusher.hpp"
 #include "core/numerics/pusher/pusher_factory.hpp"
 #include "core/numerics/boundary_condition/boundary_condition.hpp"
 #include "core/numerics/moments/moments.hpp"
+#include "core/numerics/moments/tiled_deposit.hpp"
 #include "core/data/ions/ions.hpp"
 
 #include "initializer/data_provider.hpp"
@@ -16,7 +18,10 @@
 #include "core/logger.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <vector>
 
 
 namespace PHARE::core
@@ -37,6 +42,7 @@ public:
     using Particle_t        = typename ParticleArray::Particle_t;
     using PartIterator      = typename ParticleArray::iterator;
     using ParticleRange     = IndexRange<ParticleArray>;
+    using PushedParticles   = std::vector<PushedParticle<dimension>>;
     using BoundaryCondition = PHARE::core::BoundaryCondition<dimension, interp_order>;
     using Pusher = PHARE::core::Pusher<dimension, ParticleRange, Electromag, Interpolator,
                                        BoundaryCondition, GridLayout>;
@@ -49,10 +55,27 @@ private:
     std::unique_ptr<Pusher> pusher_;
     Interpolator interpolator_;
 
+    // E and B are packed once per update in an interleaved buffer read by the pusher
+    bool interleavedGather_ = false;
+    ElectromagGatherBuffer<dimension> emGatherBuffer_;
+
+    // moments are deposited tile by tile if a tile size is given
+    std::optional<TiledDeposit<dimension, interp_order>> tiledDeposit_;
+
+    // patch ghost particles are not pushed, domain particles leaving the patch are kept
+    // in the population leavingParticles for the messenger to give them to the patch they
+    // entered, where they are deposited
+    bool skipPatchGhostPush_ = false;
+
 public:
     IonUpdater(PHARE::initializer::PHAREDict const& dict)
-        : pusher_{makePusher(dict["pusher"]["name"].template to<std::string>())}
+        : pusher_{makePusher(dict["pusher"]["name"].template to<std::string>(),
+                             cppdict::get_value(dict, "pusher/deferred_cellmap", false))}
+        , interleavedGather_{cppdict::get_value(dict, "pusher/interleaved_em_gather", false)}
+        , skipPatchGhostPush_{cppdict::get_value(dict, "skip_patch_ghost_push", false)}
     {
+        if (auto const tileSize = cppdict::get_value(dict, "tile_size", 0); tileSize > 0)
+            tiledDeposit_.emplace(static_cast<std::uint32_t>(tileSize));
     }
 
     void updatePopulations(Ions& ions, Electromag const& em, GridLayout const& layout, double dt,
@@ -65,7 +88,8 @@ public:
     void reset()
     {
         // clear memory
-        tmp_particles_ = std::move(ParticleArray{Box{}});
+        pushedGhosts_ = PushedParticles{};
+        emGatherBuffer_.clear();
     }
 
 
@@ -74,9 +98,34 @@ private:
 
     void updateAndDepositAll_(Ions& ions, Electromag const& em, GridLayout const& layout);
 
+    template<typename Population>
+    void depositDomain_(Population& pop, GridLayout const& layout)
+    {
+        auto& domain = pop.domainParticles();
+        if (tiledDeposit_)
+            (*tiledDeposit_)(domain, pop.density(), pop.flux(), layout);
+        else
+            interpolator_(makeIndexRange(domain), pop.density(), pop.flux(), layout);
+    }
+
 
+    // copies domain particles from firstLeaving onwards that are still in the ghost box
+    template<typename Population>
+    void keepLeaving_(Population& pop, std::size_t const firstLeaving, Box const& ghostBox)
+    {
+        auto& domain  = pop.domainParticles();
+        auto& leaving = pop.leavingParticles();
+
+        leaving.clear();
+        for (auto iPart = firstLeaving; iPart < domain.size(); ++iPart)
+            if (isIn(Point{domain[iPart].iCell}, ghostBox))
+                leaving.push_back(domain[iPart]);
+    }
+
+
+    // pushed state of ghost particles entering the domain
     // dealloced on regridding/load balancing coarsest
-    ParticleArray tmp_particles_{Box{}}; //{std::make_unique<ParticleArray>(Box{})};
+    PushedParticles pushedGhosts_;
 };
 
 
@@ -92,6 +141,12 @@ void IonUpdater<Ions, Electromag, GridLayout>::updatePopulations(Ions& ions, Ele
     resetMoments(ions);
     pusher_->setMeshAndTimeStep(layout.meshSize(), dt);
 
+    if (interleavedGather_)
+    {
+        emGatherBuffer_.pack(em, layout);
+        pusher_->gatherFrom(&emGatherBuffer_);
+    }
+
     if (mode == UpdaterMode::domain_only)
     {
         updateAndDepositDomain_(ions, em, layout);
@@ -137,11 +192,6 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateAndDepositDomain_(Ions& ion
     auto ghostBox{domainBox};
     ghostBox.grow(partGhostWidth);
 
-    auto inGhostBox = [&](auto& particleRange) {
-        return particleRange.array().partition(
-            [&](auto const& cell) { return isIn(Point{cell}, ghostBox); });
-    };
-
     for (auto& pop : ions)
     {
         ParticleArray& domain = pop.domainParticles();
@@ -158,36 +208,40 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateAndDepositDomain_(Ions& ion
             inRange, outRange, em, pop.mass(), interpolator_, layout,
             [](auto& particleRange) { return particleRange; }, inDomainBox);
 
-        interpolator_(inDomain, pop.density(), pop.flux(), layout);
-
         // TODO : we can erase here because we know we are working on a state
         // that has been saved in the solverPPC
         // this makes the updater quite coupled to how the solverPPC works while
         // it kind of pretends not to be by being independent object in core...
         // note we need to erase here if using the back_inserter for ghost copy
         // otherwise they will be added after leaving domain particles.
+        if (skipPatchGhostPush_)
+            keepLeaving_(pop, inDomain.iend(), ghostBox);
+
         domain.erase(makeRange(domain, inDomain.iend(), domain.size()));
 
+        depositDomain_(pop, layout);
+
         // then push patch and level ghost particles
         // push those in the ghostArea (i.e. stop pushing if they're not out of it)
         // deposit moments on those which leave to go inDomainBox
 
-        auto pushAndAccumulateGhosts = [&](auto& inputArray, bool copyInDomain = false) {
-            auto& outputArray = tmp_particles_.replace_from(inputArray);
+        auto pushAndAccumulateGhosts = [&](auto const& inputArray, bool copyInDomain = false) {
+            // ghost particles are left untouched, only the pushed state of those
+            // entering the domain is kept, to be deposited and possibly copied
+            pusher_->move(inputArray, pushedGhosts_, em, pop.mass(), interpolator_, layout,
+                          ghostBox, domainBox);
 
-            inRange  = makeIndexRange(inputArray);
-            outRange = makeIndexRange(outputArray);
-
-            auto enteredInDomain = pusher_->move(inRange, outRange, em, pop.mass(), interpolator_,
-                                                 layout, inGhostBox, inDomainBox);
-
-            interpolator_(enteredInDomain, pop.density(), pop.flux(), layout);
+            interpolator_(makeRange(pushedGhosts_), pop.density(), pop.flux(), layout);
 
             if (copyInDomain)
             {
-                domain.reserve(domain.size() + enteredInDomain.size());
-                std::copy(enteredInDomain.begin(), enteredInDomain.end(),
-                          std::back_inserter(domain));
+                domain.reserve(domain.size() + pushedGhosts_.size());
+                for (auto const& pushed : pushedGhosts_)
+                {
+                    auto const& ghost = inputArray[pushed.index];
+                    domain.emplace_back(Particle_t{pushed.weight, ghost.charge, pushed.iCell,
+                                                   pushed.delta, pushed.v, ghost.id});
+                }
             }
         };
 
@@ -199,7 +253,9 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateAndDepositDomain_(Ions& ion
         // On the contrary level ghost particles entering the domain here do not need to be copied
         // since they contribute to nodes that are not shared with neighbor patches an since
         // level border nodes will receive contributions from levelghost old and new particles
-        pushAndAccumulateGhosts(pop.patchGhostParticles(), true);
+        // If patch ghosts are not pushed, the patches owning them give us their leaving particles.
+        if (!skipPatchGhostPush_)
+            pushAndAccumulateGhosts(pop.patchGhostParticles(), true);
         pushAndAccumulateGhosts(pop.levelGhostParticles());
     }
 }
@@ -252,6 +308,9 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateAndDepositAll_(Ions& ions,
             domainPartRange, domainPartRange, em, pop.mass(), interpolator_, layout,
             [](auto const& particleRange) { return particleRange; }, inDomainBox);
 
+        if (skipPatchGhostPush_)
+            keepLeaving_(pop, inDomain.iend(), ghostBox);
+
         domainParticles.erase(makeRange(domainParticles, inDomain.iend(), domainParticles.size()));
 
         auto pushAndCopyInDomain = [&](auto&& particleRange) {
@@ -266,10 +325,11 @@ void IonUpdater<Ions, Electromag, GridLayout>::updateAndDepositAll_(Ions& ions,
                 makeRange(particleArray, inGhostLayerRange.iend(), particleArray.size()));
         };
 
-        pushAndCopyInDomain(makeIndexRange(pop.patchGhostParticles()));
+        if (!skipPatchGhostPush_)
+            pushAndCopyInDomain(makeIndexRange(pop.patchGhostParticles()));
         pushAndCopyInDomain(makeIndexRange(pop.levelGhostParticles()));
 
-        interpolator_(makeIndexRange(domainParticles), pop.density(), pop.flux(), layout);
+        depositDomain_(pop, layout);
     }
 }
 
@@ -1,8 +1,11 @@
 #ifndef MOMENTS_HPP
 #define MOMENTS_HPP
 
+#include <cstddef>
 #include <iterator>
 
+#include "core/utilities/range/range.hpp"
+#include "core/data/particles/particle_array.hpp"
 #include "core/numerics/interpolator/interpolator.hpp"
 
 
@@ -61,6 +64,25 @@ namespace core
         }
     }
 
+
+    /**
+     * @brief depositEnteringParticles deposits the domain particles of pop from firstEntering
+     * onwards, that neighbor patches of the same level gave as they left them during the last
+     * push, when patch ghost particles are not pushed (see IonUpdater skip_patch_ghost_push).
+     * The leaving particles of pop were given to the neighbors already and are emptied.
+     */
+    template<typename Population, typename GridLayout>
+    void depositEnteringParticles(Population& pop, std::size_t const firstEntering,
+                                  GridLayout const& layout)
+    {
+        Interpolator<GridLayout::dimension, GridLayout::interp_order> interpolate;
+
+        auto& domain = pop.domainParticles();
+        interpolate(makeRange(domain, firstEntering, domain.size()), pop.density(), pop.flux(),
+                    layout);
+        empty(pop.leavingParticles());
+    }
+
 } // namespace core
 } // namespace PHARE
 
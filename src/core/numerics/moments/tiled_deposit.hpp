@@ -0,0 +1,146 @@
+#ifndef PHARE_CORE_NUMERICS_MOMENTS_TILED_DEPOSIT_HPP
+#define PHARE_CORE_NUMERICS_MOMENTS_TILED_DEPOSIT_HPP
+
+
+#include "core/def.hpp"
+#include "core/logger.hpp"
+#include "core/utilities/box/box.hpp"
+#include "core/utilities/box/tile_set.hpp"
+#include "core/utilities/range/range.hpp"
+#include "core/data/ndarray/ndarray_vector.hpp"
+#include "core/data/particles/particle_array.hpp"
+#include "core/numerics/interpolator/interpolator.hpp"
+
+#include <array>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace PHARE::core
+{
+/** \brief TiledDeposit deposits density and flux of particles tile by tile.
+ *
+ * The patch domain box is split in tiles of tileSize cells per direction. Particles are
+ * sorted by tile so that each tile owns a contiguous range of the array, and each range is
+ * deposited on small tile accumulators that stay in cache, then added to the patch moments.
+ * Sorting the domain particles by tile also makes the next push walk the fields tile by tile.
+ * The sort reuses the storage of the previous one and keeps the particle cellmap valid.
+ *
+ * All particles given to the deposit must be in the layout AMR box.
+ */
+template<std::size_t dim, std::size_t interpOrder>
+class TiledDeposit
+{
+    using Accumulator = NdArrayVector<dim, double>;
+
+    // view of a tile accumulator indexed with the patch local indexes
+    class TileField
+    {
+    public:
+        TileField(Accumulator& data, std::array<std::uint32_t, dim> const& lower)
+            : data_{&data}
+            , lower_{lower}
+        {
+        }
+
+        template<typename... Indexes>
+        NO_DISCARD double& operator()(Indexes const... indexes) const
+        {
+            std::array<std::uint32_t, dim> local{static_cast<std::uint32_t>(indexes)...};
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                local[iDim] -= lower_[iDim];
+            return (*data_)(local);
+        }
+
+    private:
+        Accumulator* data_;
+        std::array<std::uint32_t, dim> lower_;
+    };
+
+    struct TileVecField
+    {
+        NO_DISCARD auto operator()() const { return components; }
+
+        std::array<TileField, 3> components;
+    };
+
+public:
+    explicit TiledDeposit(std::uint32_t const tileSize)
+        : tileSize_{tileSize}
+        , accumulators_{makeAccumulators_(tileSize)}
+    {
+    }
+
+
+    template<typename ParticleArray, typename Field, typename VecField, typename GridLayout>
+    void operator()(ParticleArray& particles, Field& density, VecField& flux,
+                    GridLayout const& layout)
+    {
+        PHARE_LOG_SCOPE(3, "TiledDeposit::operator()");
+
+        auto const domainBox = layout.AMRBox();
+        if (tiles_.size() == 0 or !(tiles_.box() == domainBox))
+            tiles_ = TileSet<dim>{domainBox, tileSize_};
+
+        auto const& offsets = particles.bucket_sort(
+            tiles_.size(), [&](auto const& cell) { return tiles_.tileIndex(cell); }, sortBuffer_);
+
+        auto const& [xFlux, yFlux, zFlux] = flux();
+
+        for (std::size_t iTile = 0; iTile < tiles_.size(); ++iTile)
+        {
+            if (offsets[iTile] == offsets[iTile + 1])
+                continue;
+
+            // primal nodes reached by particles of the tile cells
+            auto const localTile = layout.AMRToLocal(tiles_[iTile]);
+            auto const nodes     = Box<std::uint32_t, dim>{localTile.lower - 1,
+                                                       localTile.upper + interpOrder};
+
+            for (auto& accumulator : accumulators_)
+                std::fill(accumulator.begin(), accumulator.end(), 0.);
+
+            auto const lower = *nodes.lower;
+            auto tileDensity = TileField{accumulators_[0], lower};
+            auto tileFlux    = TileVecField{{TileField{accumulators_[1], lower},
+                                          TileField{accumulators_[2], lower},
+                                          TileField{accumulators_[3], lower}}};
+
+            interpolator_(makeRange(particles, offsets[iTile], offsets[iTile + 1]), tileDensity,
+                          tileFlux, layout);
+
+            auto reduce = [&](auto& moment, auto const& accumulator) {
+                for (auto const& node : nodes)
+                    moment(*node) += accumulator(*(node - nodes.lower));
+            };
+            reduce(density, accumulators_[0]);
+            reduce(xFlux, accumulators_[1]);
+            reduce(yFlux, accumulators_[2]);
+            reduce(zFlux, accumulators_[3]);
+        }
+    }
+
+
+private:
+    static auto makeAccumulators_(std::uint32_t const tileSize)
+    {
+        // a tile of tileSize cells reaches tileSize + interpOrder + 1 primal nodes
+        auto const shape = ConstArray<std::uint32_t, dim>(tileSize + interpOrder + 1);
+        return std::array{Accumulator{shape}, Accumulator{shape}, Accumulator{shape},
+                          Accumulator{shape}};
+    }
+
+    std::uint32_t tileSize_;
+    TileSet<dim> tiles_;
+    std::array<Accumulator, 4> accumulators_;
+    Interpolator<dim, interpOrder> interpolator_;
+
+    // reused by the sorts of all the patches and populations deposited
+    typename ParticleArray<dim>::BucketSortBuffer sortBuffer_;
+};
+
+} // namespace PHARE::core
+
+
+#endif
@@ -28,8 +28,22 @@ public:
 
 private:
     using ParticleSelector = typename Super::ParticleSelector;
+    using ParticleArray    = typename Super::ParticleArray;
+    using PushedParticles  = typename Super::PushedParticles;
+    using Box_t            = typename Super::Box_t;
 
 public:
+    BorisPusher() = default;
+
+    /** with deferredCellMap, particles crossing a cell only have their iCell changed
+     * and the cellmap of their array is rebuilt before its next use, rather than
+     * being updated for each crossing. This is cheaper when many particles cross cells.
+     */
+    explicit BorisPusher(bool deferredCellMap)
+        : deferredCellMap_{deferredCellMap}
+    {
+    }
+
     // This move function should be considered when being used so that all particles are pushed
     // twice - see: https://github.com/PHAREHUB/PHARE/issues/571
     /** see Pusher::move() documentation*/
@@ -99,7 +113,8 @@ public:
 
             //  get electromagnetic fields interpolated on the particles of rangeOut stop at newEnd.
             //  get the particle velocity from t=n to t=n+1
-            accelerate_(currPart, interpolator(currPart, emFields, layout), dto2m);
+            accelerate_(currPart, gather_(interpolator, currPart, emFields, layout),
+                        currPart.charge * dto2m);
 
             // now advance the particles from t=n+1/2 to t=n+1 using v_{n+1} just calculated
             // and get a pointer to the first leaving particle
@@ -111,6 +126,43 @@ public:
 
 
 
+    /** see Pusher::move() documentation*/
+    void move(ParticleArray const& particles, PushedParticles& selected,
+              Electromag const& emFields, double mass, Interpolator& interpolator,
+              GridLayout const& layout, Box_t const& pushBox, Box_t const& selectBox) override
+    {
+        PHARE_LOG_SCOPE(3, "Boris::move_no_bc_pushed");
+
+        selected.clear();
+
+        double const dto2m = 0.5 * dt_ / mass;
+        PushedParticle<dim> pushed;
+        for (std::size_t idx = 0; idx < particles.size(); ++idx)
+        {
+            auto const& particle = particles[idx];
+
+            // same steps as the other move() but the particle state is only
+            // written in 'pushed', so 'particles' does not need to be copied
+            pushed.weight = particle.weight;
+            pushed.v      = particle.v;
+            pushed.index  = idx;
+            pushed.iCell  = advancePosition_(particle, pushed);
+
+            if (!isIn(Point{pushed.iCell}, pushBox))
+                continue;
+
+            accelerate_(pushed, gather_(interpolator, pushed, emFields, layout),
+                        particle.charge * dto2m);
+
+            pushed.iCell = advancePosition_(pushed, pushed);
+
+            if (isIn(Point{pushed.iCell}, selectBox))
+                selected.push_back(pushed);
+        }
+    }
+
+
+
     /** see Pusher::move() documentation*/
     void setMeshAndTimeStep(std::array<double, dim> ms, double const ts) override
     {
@@ -124,8 +176,8 @@ public:
 private:
     /** move the particle partIn of half a time step and store it in partOut
      */
-    template<typename Particle>
-    auto advancePosition_(Particle const& partIn, Particle& partOut)
+    template<typename ParticleIn, typename ParticleOut>
+    auto advancePosition_(ParticleIn const& partIn, ParticleOut& partOut)
     {
         std::array<int, dim> newCell;
         for (std::size_t iDim = 0; iDim < dim; ++iDim)
@@ -174,7 +226,7 @@ private:
 
             auto newCell = advancePosition_(inParticles[inIdx], outParticles[outIdx]);
             if (newCell != inParticles[inIdx].iCell)
-                outParticles.change_icell(newCell, outIdx);
+                changeCell_(outParticles, newCell, outIdx);
         }
     }
 
@@ -183,22 +235,38 @@ private:
         auto& particles = range.array();
         auto newCell    = advancePosition_(particles[idx], particles[idx]);
         if (newCell != particles[idx].iCell)
+            changeCell_(particles, newCell, idx);
+    }
+
+    template<typename Particles, typename Cell>
+    void changeCell_(Particles& particles, Cell const& newCell, std::size_t idx)
+    {
+        if (deferredCellMap_)
+            particles.change_icell_deferred(newCell, idx);
+        else
             particles.change_icell(newCell, idx);
     }
 
 
-    /** Accelerate the particles in rangeIn and put the new velocity in rangeOut
+    template<typename Particle>
+    auto gather_(Interpolator& interpolator, Particle& particle, Electromag const& emFields,
+                 GridLayout const& layout)
+    {
+        if (this->gatherBuffer_)
+            return interpolator(particle, *this->gatherBuffer_, layout);
+        return interpolator(particle, emFields, layout);
+    }
+
+
+    /** Accelerate the particle, coef1 is charge * dt / (2 * mass)
      */
     template<typename Particle_t, typename ParticleEB>
-    void accelerate_(Particle_t& part, ParticleEB const& particleEB, double const& dto2m)
+    void accelerate_(Particle_t& part, ParticleEB const& particleEB, double const coef1)
     {
         auto& [pE, pB]        = particleEB;
         auto& [pEx, pEy, pEz] = pE;
         auto& [pBx, pBy, pBz] = pB;
 
-
-        double const coef1 = part.charge * dto2m;
-
         // We now apply the 3 steps of the BORIS PUSHER
 
         // 1st half push of the electric field
@@ -257,6 +325,7 @@ private:
 
     std::array<double, dim> halfDtOverDl_;
     double dt_;
+    bool deferredCellMap_ = false;
 };
 
 } // namespace PHARE::core
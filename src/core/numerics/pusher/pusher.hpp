@@ -5,9 +5,12 @@
 #include <type_traits>
 #include <utility>
 #include <functional>
+#include <vector>
 
+#include "core/utilities/box/box.hpp"
 #include "core/utilities/range/range.hpp"
 #include "core/data/particles/particle.hpp"
+#include "core/numerics/interpolator/electromag_gather_buffer.hpp"
 
 namespace PHARE
 {
@@ -21,6 +24,9 @@ namespace core
         static auto constexpr dimension = GridLayout::dimension;
 
         using ParticleSelector = std::function<ParticleRange(ParticleRange&)>;
+        using ParticleArray    = typename ParticleRange::array_t;
+        using PushedParticles  = std::vector<PushedParticle<dimension>>;
+        using Box_t            = Box<int, dimension>;
 
     public:
         // TODO : to really be independant on boris which has 2 push steps
@@ -32,9 +38,26 @@ namespace core
             = 0;
 
 
+        // push 'particles' without modifying them. Particles still in 'pushBox' after the
+        // first push step are pushed to the end of the step, and the pushed state of those
+        // ending in 'selectBox' is stored in 'selected', which is cleared first.
+        virtual void move(ParticleArray const& particles, PushedParticles& selected,
+                          Electromag const& emFields, double mass, Interpolator& interpolator,
+                          GridLayout const& layout, Box_t const& pushBox, Box_t const& selectBox)
+            = 0;
+
+
         virtual void setMeshAndTimeStep(std::array<double, dim> ms, double ts) = 0;
 
+
+        // if set, E and B are gathered from this buffer, which must have been packed
+        // from the Electromag given to move(), rather than from the Electromag itself
+        void gatherFrom(ElectromagGatherBuffer<dimension> const* buffer) { gatherBuffer_ = buffer; }
+
         virtual ~Pusher() {}
+
+    protected:
+        ElectromagGatherBuffer<dimension> const* gatherBuffer_ = nullptr;
     };
 
 } // namespace core
@@ -17,12 +17,13 @@ namespace core
     public:
         template<std::size_t dim, typename ParticleRange, typename Electromag,
                  typename Interpolator, typename BoundaryCondition, typename GridLayout>
-        static auto makePusher(std::string pusherName)
+        static auto makePusher(std::string pusherName, bool deferredCellMap = false)
         {
             if (pusherName == "modified_boris")
             {
                 return std::make_unique<BorisPusher<dim, ParticleRange, Electromag, Interpolator,
-                                                    BoundaryCondition, GridLayout>>();
+                                                    BoundaryCondition, GridLayout>>(
+                    deferredCellMap);
             }
 
             throw std::runtime_error("Error : Invalid Pusher name");
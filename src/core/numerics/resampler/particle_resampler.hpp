@@ -0,0 +1,316 @@
+#ifndef PHARE_CORE_NUMERICS_RESAMPLER_PARTICLE_RESAMPLER_HPP
+#define PHARE_CORE_NUMERICS_RESAMPLER_PARTICLE_RESAMPLER_HPP
+
+
+#include "core/def.hpp"
+#include "core/logger.hpp"
+#include "core/utilities/box/box.hpp"
+
+#include "initializer/data_provider.hpp"
+
+#include <array>
+#include <cmath>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace PHARE::core
+{
+struct ResamplingCounts
+{
+    std::size_t removed = 0;
+    std::size_t added   = 0;
+
+    auto& operator+=(ResamplingCounts const& that)
+    {
+        removed += that.removed;
+        added += that.added;
+        return *this;
+    }
+};
+
+
+
+/** \brief ParticleResampler bounds the number of particles per cell of a particle array.
+ *
+ * Particles of cells above maxPerCell are binned in velocity space, velocityBins bins per
+ * velocity component spanning the cell velocity range. The most populated bins are then merged,
+ * each into two particles of half the bin weight placed at the bin center of mass with
+ * velocities V +/- sigma, V being the bin mean velocity and sigma its standard deviation per
+ * component. This conserves per cell the weight, so the charge, the momentum and the kinetic
+ * energy of each velocity component. Bins are merged until the cell is at or below maxPerCell.
+ *
+ * If minPerCell is not zero, the heaviest particle of cells below it is split in two particles
+ * of half its weight with the same velocity, moved apart symmetrically inside the cell, until
+ * the cell reaches minPerCell.
+ *
+ * Tracer particles, whose id is not 0, are never merged so that they keep their identity, and
+ * the twin of a split tracer inherits its id.
+ *
+ * All the particles given to the resampler must be in the domain box, and only cells of the
+ * resampled box are resampled.
+ */
+template<typename ParticleArray>
+class ParticleResampler
+{
+    static constexpr auto dim = ParticleArray::dimension;
+
+    using Particle_t = typename ParticleArray::Particle_t;
+    using Box_t      = Box<int, dim>;
+
+public:
+    explicit ParticleResampler(PHARE::initializer::PHAREDict const& dict)
+        : maxPerCell_{static_cast<std::size_t>(cppdict::get_value(dict, "max_per_cell", 0))}
+        , minPerCell_{static_cast<std::size_t>(cppdict::get_value(dict, "min_per_cell", 0))}
+        , velocityBins_{static_cast<std::size_t>(cppdict::get_value(dict, "velocity_bins", 2))}
+    {
+        if (velocityBins_ == 0)
+            throw std::runtime_error("ParticleResampler needs at least one velocity bin");
+    }
+
+
+    /** \brief resamples the cells of the layout AMR box further than the particle ghost width
+     * from its border, particles of the other cells being copied in neighbor patch ghosts
+     */
+    template<typename GridLayout>
+    ResamplingCounts operator()(ParticleArray& particles, GridLayout const& layout)
+    {
+        auto const domainBox = layout.AMRBox();
+        auto const ghosts    = static_cast<int>(GridLayout::nbrParticleGhosts());
+        return resample(particles, domainBox,
+                        Box_t{domainBox.lower + ghosts, domainBox.upper - ghosts});
+    }
+
+
+    ResamplingCounts resample(ParticleArray& particles, Box_t const& domainBox,
+                              Box_t const& resampledBox)
+    {
+        PHARE_LOG_SCOPE(3, "ParticleResampler::resample");
+
+        ResamplingCounts counts;
+        if (particles.size() == 0 or !isValid_(resampledBox))
+            return counts;
+
+        auto const shape   = domainBox.shape();
+        auto const nbrCell = static_cast<std::size_t>(domainBox.size());
+
+        // cells are numbered in C order, like the domain box iteration order
+        auto cellIndex = [&](auto const& iCell) {
+            std::size_t index = 0;
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                index = index * shape[iDim] + (iCell[iDim] - domainBox.lower[iDim]);
+            return index;
+        };
+
+        auto const& offsets = particles.bucket_sort(nbrCell, cellIndex, sortBuffer_);
+        auto& vector       = particles.vector();
+
+        // most cells are copied as they are
+        std::vector<Particle_t> resampled;
+        resampled.reserve(vector.size());
+
+        std::size_t iCell = 0;
+        for (auto const& cell : domainBox)
+        {
+            auto const first = vector.begin() + offsets[iCell];
+            auto const last  = vector.begin() + offsets[iCell + 1];
+            auto const size  = offsets[iCell + 1] - offsets[iCell];
+            ++iCell;
+
+            auto const resample = isIn(cell, resampledBox);
+
+            if (resample and maxPerCell_ > 0 and size > maxPerCell_)
+                counts.removed += merge_(first, last, resampled);
+            else if (resample and minPerCell_ > 0 and size > 0 and size < minPerCell_)
+                counts.added += split_(first, last, resampled);
+            else
+                resampled.insert(resampled.end(), first, last);
+        }
+
+        vector.swap(resampled);
+        particles.stale_map();
+
+        return counts;
+    }
+
+
+private:
+    template<typename Iterator>
+    std::size_t merge_(Iterator first, Iterator last, std::vector<Particle_t>& resampled)
+    {
+        auto const size = static_cast<std::size_t>(std::distance(first, last));
+
+        std::array<double, 3> vmin, vmax;
+        vmin.fill(std::numeric_limits<double>::max());
+        vmax.fill(std::numeric_limits<double>::lowest());
+        for (auto it = first; it != last; ++it)
+            for (std::size_t iComp = 0; iComp < 3; ++iComp)
+            {
+                vmin[iComp] = std::min(vmin[iComp], it->v[iComp]);
+                vmax[iComp] = std::max(vmax[iComp], it->v[iComp]);
+            }
+
+        auto velocityBin = [&](auto const& v) {
+            std::size_t bin = 0;
+            for (std::size_t iComp = 0; iComp < 3; ++iComp)
+            {
+                auto const range = vmax[iComp] - vmin[iComp];
+                auto const iBin  = range > 0 ? static_cast<std::size_t>((v[iComp] - vmin[iComp])
+                                                                       / range * velocityBins_)
+                                             : 0;
+                bin = bin * velocityBins_ + std::min(iBin, velocityBins_ - 1);
+            }
+            return bin;
+        };
+
+        auto const nbrBins = velocityBins_ * velocityBins_ * velocityBins_;
+        // tracers are kept out of the bins
+        auto const untraced = nbrBins;
+        bins_.assign(size, untraced);
+        binSizes_.assign(nbrBins, 0);
+        for (std::size_t iPart = 0; iPart < size; ++iPart)
+            if (first[iPart].id == 0)
+            {
+                bins_[iPart] = velocityBin(first[iPart].v);
+                ++binSizes_[bins_[iPart]];
+            }
+
+        // merge the most populated bins first, until the cell is small enough
+        binOrder_.resize(nbrBins);
+        std::iota(binOrder_.begin(), binOrder_.end(), 0);
+        std::sort(binOrder_.begin(), binOrder_.end(),
+                  [&](auto const a, auto const b) { return binSizes_[a] > binSizes_[b]; });
+
+        merged_.assign(nbrBins, false);
+        std::size_t cellSize = size;
+        for (auto const bin : binOrder_)
+        {
+            if (cellSize <= maxPerCell_ or binSizes_[bin] <= 2)
+                break;
+            merged_[bin] = true;
+            cellSize -= binSizes_[bin] - 2;
+        }
+
+        mergedBins_.assign(nbrBins, Accumulator{});
+        for (std::size_t iPart = 0; iPart < size; ++iPart)
+        {
+            if (bins_[iPart] != untraced and merged_[bins_[iPart]])
+                mergedBins_[bins_[iPart]].add(first[iPart]);
+            else
+                resampled.push_back(first[iPart]);
+        }
+
+        for (std::size_t bin = 0; bin < nbrBins; ++bin)
+            if (merged_[bin])
+                mergedBins_[bin].emplace(*first, resampled);
+
+        return size - cellSize;
+    }
+
+
+    template<typename Iterator>
+    std::size_t split_(Iterator first, Iterator last, std::vector<Particle_t>& resampled)
+    {
+        auto const begin = resampled.size();
+        resampled.insert(resampled.end(), first, last);
+
+        auto const size = resampled.size() - begin;
+        for (auto cellSize = size; cellSize < minPerCell_; ++cellSize)
+        {
+            auto heaviest = std::max_element(
+                resampled.begin() + begin, resampled.end(),
+                [](auto const& a, auto const& b) { return a.weight < b.weight; });
+
+            heaviest->weight *= .5;
+            auto twin = *heaviest;
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            {
+                auto const delta  = heaviest->delta[iDim];
+                auto const offset = .5 * std::min(delta, 1. - delta);
+                heaviest->delta[iDim] -= offset;
+                twin.delta[iDim] += offset;
+            }
+            resampled.push_back(twin);
+        }
+
+        return resampled.size() - begin - size;
+    }
+
+
+    // weighted sums of a merged bin
+    struct Accumulator
+    {
+        double weight = 0;
+        std::array<double, dim> delta{};
+        std::array<double, 3> v{}, v2{};
+
+        void add(Particle_t const& particle)
+        {
+            weight += particle.weight;
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                delta[iDim] += particle.weight * particle.delta[iDim];
+            for (std::size_t iComp = 0; iComp < 3; ++iComp)
+            {
+                v[iComp] += particle.weight * particle.v[iComp];
+                v2[iComp] += particle.weight * particle.v[iComp] * particle.v[iComp];
+            }
+        }
+
+        // the two particles replacing the bin, cell and charge are those of the cell particles
+        void emplace(Particle_t const& cellParticle, std::vector<Particle_t>& resampled) const
+        {
+            Particle_t plus{cellParticle};
+            plus.weight = .5 * weight;
+            if constexpr (Particle_t::has_id)
+                plus.id = 0;
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                plus.delta[iDim] = delta[iDim] / weight;
+
+            Particle_t minus{plus};
+            for (std::size_t iComp = 0; iComp < 3; ++iComp)
+            {
+                auto const mean  = v[iComp] / weight;
+                auto const sigma = std::sqrt(std::max(0., v2[iComp] / weight - mean * mean));
+                plus.v[iComp]    = mean + sigma;
+                minus.v[iComp]   = mean - sigma;
+            }
+
+            resampled.push_back(plus);
+            resampled.push_back(minus);
+        }
+    };
+
+
+    static bool isValid_(Box_t const& box)
+    {
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            if (box.lower[iDim] > box.upper[iDim])
+                return false;
+        return true;
+    }
+
+
+    std::size_t maxPerCell_;
+    std::size_t minPerCell_;
+    std::size_t velocityBins_;
+
+    // reused between resamplings
+    typename ParticleArray::BucketSortBuffer sortBuffer_;
+
+    // reused between cells
+    std::vector<std::size_t> bins_;
+    std::vector<std::size_t> binSizes_;
+    std::vector<std::size_t> binOrder_;
+    std::vector<bool> merged_;
+    std::vector<Accumulator> mergedBins_;
+};
+
+} // namespace PHARE::core
+
+
+#endif
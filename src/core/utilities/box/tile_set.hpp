@@ -0,0 +1,96 @@
+#ifndef PHARE_CORE_UTILITIES_BOX_TILE_SET_HPP
+#define PHARE_CORE_UTILITIES_BOX_TILE_SET_HPP
+
+
+#include "core/def.hpp"
+#include "core/utilities/point/point.hpp"
+#include "core/utilities/box/box.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+
+namespace PHARE::core
+{
+/** \brief TileSet splits a box of cells in tiles of at most tileSize cells per direction.
+ *
+ * Tiles are stored in C order (last direction varies fastest), like the Box iteration,
+ * and tileIndex() returns the position in this order of the tile holding a given cell.
+ * Tiles on the upper side of the box are truncated if the box shape is not a multiple
+ * of the tile size.
+ */
+template<std::size_t dim>
+class TileSet
+{
+public:
+    static constexpr std::size_t dimension = dim;
+    using box_t                            = Box<int, dim>;
+
+    TileSet() = default;
+
+    TileSet(box_t const& box, std::uint32_t const tileSize)
+        : box_{box}
+        , tileSize_{tileSize}
+    {
+        assert(tileSize_ > 0);
+
+        auto const size  = static_cast<int>(tileSize_);
+        auto const shape = box_.shape();
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            nbrTiles_[iDim] = (shape[iDim] + size - 1) / size;
+
+        auto const tileIndexes = box_t{Point<int, dim>{}, nbrTiles_ - 1};
+
+        tiles_.reserve(tileIndexes.size());
+        for (auto const& tileIndex : tileIndexes)
+        {
+            auto& tile = tiles_.emplace_back();
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            {
+                tile.lower[iDim] = box_.lower[iDim] + tileIndex[iDim] * size;
+                tile.upper[iDim] = std::min(tile.lower[iDim] + size - 1, box_.upper[iDim]);
+            }
+        }
+    }
+
+
+    template<typename Cell>
+    NO_DISCARD std::size_t tileIndex(Cell const& cell) const
+    {
+        std::size_t index = 0;
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        {
+            assert(cell[iDim] >= box_.lower[iDim] and cell[iDim] <= box_.upper[iDim]);
+            index = index * nbrTiles_[iDim]
+                    + (cell[iDim] - box_.lower[iDim]) / static_cast<int>(tileSize_);
+        }
+        return index;
+    }
+
+
+    NO_DISCARD auto& box() const { return box_; }
+    NO_DISCARD auto tileSize() const { return tileSize_; }
+    NO_DISCARD auto& shape() const { return nbrTiles_; }
+
+    NO_DISCARD std::size_t size() const { return tiles_.size(); }
+    NO_DISCARD auto& operator[](std::size_t i) const { return tiles_[i]; }
+
+    NO_DISCARD auto begin() const { return tiles_.begin(); }
+    NO_DISCARD auto end() const { return tiles_.end(); }
+
+
+private:
+    box_t box_{};
+    std::uint32_t tileSize_ = 1;
+    Point<int, dim> nbrTiles_;
+    std::vector<box_t> tiles_;
+};
+
+} // namespace PHARE::core
+
+
+#endif
@@ -14,6 +14,7 @@
 #include "core/data/ndarray/ndarray_vector.hpp"
 #include "core/utilities/box/box.hpp"
 #include "core/utilities/indexer.hpp"
+#include "core/utilities/memory_usage.hpp"
 #include "core/logger.hpp"
 #include "core/utilities/meta/meta_utilities.hpp"
 #include "core/utilities/range/range.hpp"
@@ -105,6 +106,14 @@ public:
 
 
 
+    // empty the cellmap and map all items again, items are first counted per cell
+    // so that each cell is reserved at most once
+    template<typename Array, typename CellExtractor = DefaultExtractor,
+             typename = std::enable_if_t<is_iterable_v<Array>, void>>
+    void rebuild(Array const& items, CellExtractor extract = default_extractor);
+
+
+
     // number of indexes stored in that cell of the cellmap
     NO_DISCARD std::size_t size(cell_t cell) const { return cellIndexes_(local_(cell)).size(); }
     NO_DISCARD std::size_t size(cell_t cell) { return cellIndexes_(local_(cell)).size(); }
@@ -132,6 +141,13 @@ public:
 
     NO_DISCARD float used_mem_ratio() const { return static_cast<float>(size()) / capacity(); }
 
+    // the per cell index lists count as used
+    NO_DISCARD MemoryUsage memory_usage() const
+    {
+        auto const lists = nbr_cells() * sizeof(Indexer);
+        return {lists + size() * sizeof(std::size_t), lists + capacity() * sizeof(std::size_t)};
+    }
+
 
     // export from 'from' into 'dest' items indexed in the map found withing 'box'
     template<typename Src, typename Dst>
@@ -183,6 +199,14 @@ public:
     // sort all cell indexes
     void sort();
 
+    // items of the indexed array have been reordered, item i going at newIndexes[i]
+    template<typename Indexes>
+    void permute(Indexes const& newIndexes)
+    {
+        for (auto& cell : cellIndexes_)
+            cell.permute(newIndexes);
+    }
+
     template<typename CellIndex>
     void print(CellIndex const& cell) const;
 
@@ -263,6 +287,35 @@ inline void CellMap<dim, cell_index_t>::add(Array const& items, std::size_t item
 
 
 
+template<std::size_t dim, typename cell_index_t>
+template<typename Array, typename CellExtractor, typename>
+inline void CellMap<dim, cell_index_t>::rebuild(Array const& items, CellExtractor extract)
+{
+    PHARE_LOG_SCOPE(3, "CellMap::rebuild");
+
+    empty();
+    if (box_.isEmpty())
+        return;
+
+    NdArrayVector<dim, std::uint32_t> counts{box_.shape().template toArray<std::uint32_t>()};
+    for (std::size_t itemIndex = 0; itemIndex < items.size(); ++itemIndex)
+    {
+        auto const& cell = extract(items[itemIndex]);
+        if (isIn(Point{cell}, box_))
+            ++counts(local_(cell));
+    }
+
+    for (auto const& cell : box_)
+    {
+        auto const local = local_(cell);
+        cellIndexes_(local).reserve(counts(local));
+    }
+
+    add(items, extract);
+}
+
+
+
 template<std::size_t dim, typename cell_index_t>
 template<typename Array, typename CellExtractor, typename>
 inline void CellMap<dim, cell_index_t>::erase(Array const& items, std::size_t itemIndex,
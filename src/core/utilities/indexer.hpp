@@ -40,7 +40,7 @@ public:
         }
         assert(!is_indexed(itemIndex));
     }
-    NO_DISCARD bool is_indexed(std::size_t itemIndex)
+    NO_DISCARD bool is_indexed(std::size_t itemIndex) const
     {
         return std::end(indexes_) != std::find(std::begin(indexes_), std::end(indexes_), itemIndex);
     }
@@ -59,6 +59,16 @@ public:
         }
     }
 
+    // to use if all items of the indexed array are moved, item i going at newIndexes[i]
+    template<typename Indexes>
+    void permute(Indexes const& newIndexes)
+    {
+        for (auto& index : indexes_)
+            index = newIndexes[index];
+    }
+
+    void reserve(std::size_t size) { indexes_.reserve(size); }
+
     // empty the bucketlist, but leaves the capacity untouched
     void empty() { indexes_.resize(0); };
     NO_DISCARD bool is_empty() const { return indexes_.size() == 0; }
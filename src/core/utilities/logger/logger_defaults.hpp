@@ -1,40 +1,58 @@
 #ifndef PHARE_CORE_UTILITIES_LOGGER_LOGGER_DEFAULTS_HPP
 #define PHARE_CORE_UTILITIES_LOGGER_LOGGER_DEFAULTS_HPP
 
+#include "core/def.hpp"
 #include "core/def/phlop.hpp"
 
 #if PHARE_HAVE_PHLOP
-#define PHARE_SCOPE_TIMER PHLOP_SCOPE_TIMER
+#define PHARE_SCOPE_TIMER(lvl, str) PHLOP_SCOPE_TIMER(str)
+#define PHARE_SCOPE_START(lvl, str)
+#define PHARE_SCOPE_STOP(lvl, str)
 #endif // PHARE_WITH_PHLOP
 
-#ifndef PHARE_SCOPE_TIMER
-#define PHARE_SCOPE_TIMER(str) // nothing
-#endif                         // PHARE_SCOPE_TIMER
+#ifndef PHARE_SCOPE_TIMER // native profiler, recording only if enabled at runtime
+#include "core/utilities/logger/scope_profiler.hpp"
+#define PHARE_SCOPE_TIMER(lvl, str) PHARE_PROFILER_SCOPE(lvl, str)
+#define PHARE_SCOPE_START(lvl, str) PHARE_PROFILER_START(lvl, str)
+#define PHARE_SCOPE_STOP(lvl, str) PHARE_PROFILER_STOP(lvl, str)
+#endif // PHARE_SCOPE_TIMER
 
 
 #if PHARE_LOG_LEVEL >= 1
-#define PHARE_LOG_SCOPE_1(str) PHARE_SCOPE_TIMER(str)
+#define PHARE_LOG_SCOPE_1(str) PHARE_SCOPE_TIMER(1, str)
+#define PHARE_LOG_START_1(str) PHARE_SCOPE_START(1, str)
+#define PHARE_LOG_STOP_1(str) PHARE_SCOPE_STOP(1, str)
 #else
 #define PHARE_LOG_SCOPE_1(str)
+#define PHARE_LOG_START_1(str)
+#define PHARE_LOG_STOP_1(str)
 #endif // LOG_LEVEL >= 1
 
 
 #if PHARE_LOG_LEVEL >= 2
-#define PHARE_LOG_SCOPE_2(str) PHARE_SCOPE_TIMER(str)
+#define PHARE_LOG_SCOPE_2(str) PHARE_SCOPE_TIMER(2, str)
+#define PHARE_LOG_START_2(str) PHARE_SCOPE_START(2, str)
+#define PHARE_LOG_STOP_2(str) PHARE_SCOPE_STOP(2, str)
 #else
 #define PHARE_LOG_SCOPE_2(str)
+#define PHARE_LOG_START_2(str)
+#define PHARE_LOG_STOP_2(str)
 #endif // LOG_LEVEL >= 2
 
 
 #if PHARE_LOG_LEVEL == 3
-#define PHARE_LOG_SCOPE_3(str) PHARE_SCOPE_TIMER(str)
+#define PHARE_LOG_SCOPE_3(str) PHARE_SCOPE_TIMER(3, str)
+#define PHARE_LOG_START_3(str) PHARE_SCOPE_START(3, str)
+#define PHARE_LOG_STOP_3(str) PHARE_SCOPE_STOP(3, str)
 #else
 #define PHARE_LOG_SCOPE_3(str)
+#define PHARE_LOG_START_3(str)
+#define PHARE_LOG_STOP_3(str)
 #endif // LOG_LEVEL == 3
 
 
-#define PHARE_LOG_START(lvl, str)
-#define PHARE_LOG_STOP(lvl, str)
+#define PHARE_LOG_START(lvl, str) PHARE_STR_CAT(PHARE_LOG_START_, lvl)(str)
+#define PHARE_LOG_STOP(lvl, str) PHARE_STR_CAT(PHARE_LOG_STOP_, lvl)(str)
 #define PHARE_LOG_SCOPE(lvl, str) PHARE_STR_CAT(PHARE_LOG_SCOPE_, lvl)(str)
 
 
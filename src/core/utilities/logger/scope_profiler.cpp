@@ -0,0 +1,313 @@
+#include "scope_profiler.hpp"
+
+#include "core/utilities/mpi_utils.hpp"
+
+#include <map>
+#include <tuple>
+#include <limits>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <filesystem>
+
+
+namespace PHARE::core::profiler
+{
+void ThreadProfile::drain()
+{
+    auto const& profiler = Profiler::INSTANCE();
+    auto* const tracer   = profiler.tracer();
+
+    std::string traced;
+    auto const startTicks     = profiler.startTicks();
+    auto const usPerTick      = tracer ? profiler.secondsPerTick() * 1e6 : 0.;
+    auto const toMicroseconds = [&](std::uint64_t const ticks) {
+        return static_cast<std::int64_t>(ticks - startTicks) * usPerTick;
+    };
+
+    for (std::size_t iEvent = 0; iEvent < size_; ++iEvent)
+    {
+        auto const& event = events_[iEvent];
+
+        if (event.site)
+        {
+            auto const parent = stack_.empty() ? CallTree::root : stack_.back().node;
+            stack_.push_back(
+                {tree_.child(parent, event.site->id), event.ticks, event.site, event.level});
+
+            if (tracer)
+                tracer->append(traced, 'B', event.site->name, toMicroseconds(event.ticks), index_,
+                               event.level);
+        }
+        else if (!stack_.empty()) // exits of scopes opened before enabling are dropped
+        {
+            auto const& open = stack_.back();
+            auto& node       = tree_[open.node];
+            node.ticks += event.ticks - open.ticks;
+            ++node.count;
+
+            if (tracer)
+                tracer->append(traced, 'E', open.site->name, toMicroseconds(event.ticks), index_,
+                               open.level);
+            stack_.pop_back();
+        }
+    }
+    size_ = 0;
+
+    if (tracer and !traced.empty())
+        tracer->write(traced);
+}
+
+
+void ThreadProfile::reset()
+{
+    drain();
+    tree_.zero();
+    auto const now = ticks();
+    for (auto& open : stack_)
+        open.ticks = now;
+}
+
+
+
+Tracer::Tracer(std::string const& file, int const rank)
+    : rank_{rank}
+{
+    std::filesystem::create_directories(std::filesystem::path{file}.parent_path());
+    out_.open(file, std::ios::trunc);
+    out_ << "[\n"
+         << R"({"name":"process_name","ph":"M","pid":)" << rank_ << R"(,"args":{"name":"rank )"
+         << rank_ << "\"}},\n"
+         << R"({"name":"process_sort_index","ph":"M","pid":)" << rank_
+         << R"(,"args":{"sort_index":)" << rank_ << "}}";
+}
+
+
+Tracer::~Tracer()
+{
+    out_ << "\n]\n";
+}
+
+
+void Tracer::append(std::string& events, char const phase, char const* const name,
+                    double const microseconds, std::size_t const thread, int const level)
+{
+    auto const track = 100 * thread + static_cast<std::size_t>(level + 1);
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        if (tracks_.insert(track).second)
+        {
+            ss << ",\n"
+               << R"({"name":"thread_name","ph":"M","pid":)" << rank_ << R"(,"tid":)" << track
+               << R"(,"args":{"name":")";
+            if (thread > 0)
+                ss << "thread " << thread << ' ';
+            if (level < 0)
+                ss << "no level";
+            else
+                ss << "level " << level;
+            ss << "\"}},\n"
+               << R"({"name":"thread_sort_index","ph":"M","pid":)" << rank_ << R"(,"tid":)" << track
+               << R"(,"args":{"sort_index":)" << track << "}}";
+        }
+    }
+
+    // scope names are string literals without quotes nor backslashes
+    ss << ",\n"
+       << R"({"name":")" << name << R"(","ph":")" << phase << R"(","ts":)" << microseconds
+       << R"(,"pid":)" << rank_ << R"(,"tid":)" << track << "}";
+
+    events += ss.str();
+}
+
+
+void Tracer::write(std::string const& events)
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    out_ << events;
+}
+
+
+
+Profiler& Profiler::INSTANCE()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+
+void Profiler::enable(bool const onDump)
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    onDump_     = onDump;
+    startTicks_ = ticks();
+    startTime_  = std::chrono::steady_clock::now();
+    enabled_    = true;
+}
+
+
+std::uint32_t Profiler::addSite(Site const& site)
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    sites_.push_back(&site);
+    return static_cast<std::uint32_t>(sites_.size() - 1);
+}
+
+
+ThreadProfile* Profiler::addThread_()
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    threads_.push_back(std::make_unique<ThreadProfile>(threads_.size()));
+    return threads_.back().get();
+}
+
+
+double Profiler::secondsPerTick() const
+{
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - startTime_;
+    auto const elapsedTicks = ticks() - startTicks_;
+    return elapsedTicks > 0 ? elapsed.count() / elapsedTicks : 0.;
+}
+
+
+
+void Profiler::trace(std::string const& directory)
+{
+    auto const rank = mpi::rank();
+    tracer_ = std::make_unique<Tracer>(directory + "/rank." + std::to_string(rank) + ".json", rank);
+    mpi::barrier();
+    enable(onDump_);
+}
+
+
+void Profiler::closeTrace()
+{
+    if (!tracer_)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        for (auto& thread : threads_)
+            thread->drain();
+    }
+    tracer_.reset();
+}
+
+
+
+std::string Profiler::folded_()
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    auto const secondsPerTick = this->secondsPerTick();
+
+    // threads running the same scopes are summed
+    std::map<std::string, std::tuple<double, std::uint64_t, int>> stacks;
+
+    auto fold = [&](auto& self, CallTree const& tree, std::size_t const iNode,
+                    std::string const& path) -> void {
+        for (auto const iChild : tree[iNode].children)
+        {
+            auto const& child = tree[iChild];
+            auto const childPath
+                = path.empty() ? std::string{sites_[child.site]->name}
+                               : path + ";" + sites_[child.site]->name;
+            if (child.count > 0)
+            {
+                auto& [seconds, count, level] = stacks[childPath];
+                seconds += child.ticks * secondsPerTick;
+                count += child.count;
+                level = sites_[child.site]->level;
+            }
+            self(self, tree, iChild, childPath);
+        }
+    };
+
+    for (auto& thread : threads_)
+    {
+        thread->drain();
+        fold(fold, thread->tree(), CallTree::root, "");
+        thread->reset();
+    }
+
+    std::stringstream ss;
+    ss << std::setprecision(9);
+    for (auto const& [path, value] : stacks)
+        ss << path << '\n'
+           << std::get<0>(value) << ' ' << std::get<1>(value) << ' ' << std::get<2>(value) << '\n';
+    return ss.str();
+}
+
+
+
+void Profiler::report(std::string const& title, std::string const& file)
+{
+    if (!enabled())
+        return;
+
+    auto const perRank = mpi::collect(folded_());
+    if (mpi::rank() != 0)
+        return;
+
+    struct Stats
+    {
+        double min = std::numeric_limits<double>::max(), max = 0, sum = 0;
+        std::uint64_t count = 0;
+        std::size_t ranks   = 0;
+        int level           = 0;
+    };
+
+    // scopes separator first, so that children follow their parent before its siblings
+    auto const treeOrder = [](std::string const& a, std::string const& b) {
+        auto const rank = [](char const c) { return c == ';' ? '\0' : c; };
+        return std::lexicographical_compare(
+            a.begin(), a.end(), b.begin(), b.end(),
+            [&](char const x, char const y) { return rank(x) < rank(y); });
+    };
+
+    std::map<std::string, Stats, decltype(treeOrder)> stats{treeOrder};
+    for (auto const& folded : perRank)
+    {
+        std::istringstream lines{folded};
+        std::string path;
+        double seconds;
+        std::uint64_t count;
+        int level;
+        while (std::getline(lines, path) and lines >> seconds >> count >> level)
+        {
+            auto& stat = stats[path];
+            stat.min   = std::min(stat.min, seconds);
+            stat.max   = std::max(stat.max, seconds);
+            stat.sum += seconds;
+            stat.count += count;
+            ++stat.ranks;
+            stat.level = level;
+            lines.ignore(); // end of line
+        }
+    }
+
+    auto const nbrRanks = perRank.size();
+
+    std::filesystem::create_directories(std::filesystem::path{file}.parent_path());
+    std::ofstream out{file, std::ios::app};
+    out << "# " << title << ", " << nbrRanks
+        << " ranks, scope (log level)  seconds min / mean / max over ranks  calls over ranks\n";
+
+    for (auto const& [path, stat] : stats)
+    {
+        auto const depth = std::count(path.begin(), path.end(), ';');
+        auto const leaf  = path.substr(path.rfind(';') + 1);
+        auto const min   = stat.ranks < nbrRanks ? 0. : stat.min; // absent ranks spent nothing
+
+        out << std::string(2 * depth, ' ') << leaf << " (" << stat.level << ")  " << min << " / "
+            << stat.sum / nbrRanks << " / " << stat.max << "  " << stat.count << '\n';
+    }
+    out << '\n';
+}
+
+} // namespace PHARE::core::profiler
@@ -0,0 +1,330 @@
+#ifndef PHARE_CORE_UTILITIES_LOGGER_SCOPE_PROFILER_HPP
+#define PHARE_CORE_UTILITIES_LOGGER_SCOPE_PROFILER_HPP
+
+#include "core/def.hpp"
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <fstream>
+#include <unordered_set>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+/*
+  Native profiler behind PHARE_LOG_SCOPE when phlop is not available.
+
+  Each call site owns a static Site, built once, so that recording a scope costs a branch on the
+  profiler being enabled plus two timestamped events appended to a per thread buffer. Buffers are
+  folded into a per thread call tree when full or when a report is made, so that the tree is
+  walked out of the timed scopes. Reports are reduced over MPI ranks, see report().
+
+  When tracing, the events are also written when folded as Chrome trace events, one file per rank,
+  see trace(). They can be merged and opened in chrome://tracing or ui.perfetto.dev with
+  tools/python3/merge_traces.py.
+*/
+
+namespace PHARE::core::profiler
+{
+NO_DISCARD inline std::uint64_t ticks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+
+// AMR level the calling thread works on, -1 outside of any level, see LevelScope
+inline thread_local int amrLevel = -1;
+
+
+struct Site
+{
+    Site(std::uint8_t const level_, char const* const name_);
+
+    std::uint8_t const level;
+    char const* const name;
+    std::uint32_t const id;
+};
+
+
+class CallTree
+{
+public:
+    struct Node
+    {
+        std::uint32_t site  = 0;
+        std::size_t parent  = 0;
+        std::uint64_t ticks = 0;
+        std::uint64_t count = 0;
+        std::vector<std::size_t> children{};
+    };
+
+    static constexpr std::size_t root = 0;
+
+    CallTree()
+        : nodes_(1)
+    {
+    }
+
+    NO_DISCARD std::size_t child(std::size_t const parent, std::uint32_t const site)
+    {
+        for (auto const child : nodes_[parent].children)
+            if (nodes_[child].site == site)
+                return child;
+
+        nodes_.push_back(Node{site, parent});
+        nodes_[parent].children.push_back(nodes_.size() - 1);
+        return nodes_.size() - 1;
+    }
+
+    NO_DISCARD auto& operator[](std::size_t const node) { return nodes_[node]; }
+    NO_DISCARD auto& operator[](std::size_t const node) const { return nodes_[node]; }
+
+    // keeps the nodes, so that open scopes stay valid
+    void zero()
+    {
+        for (auto& node : nodes_)
+            node.ticks = node.count = 0;
+    }
+
+private:
+    std::vector<Node> nodes_;
+};
+
+
+
+/** writes the events of one rank as a JSON array of Chrome trace events. The process of the
+ * events is the rank, their thread is 100 * thread index + AMR level + 1, so that each level
+ * worked on by a thread gets its own track.
+ */
+class Tracer
+{
+public:
+    Tracer(std::string const& file, int const rank);
+    ~Tracer(); // closes the array
+
+    // appends to events a begin ('B') or end ('E') event
+    void append(std::string& events, char const phase, char const* const name,
+                double const microseconds, std::size_t const thread, int const level);
+
+    void write(std::string const& events);
+
+private:
+    std::mutex mutex_;
+    std::ofstream out_;
+    int const rank_;
+    std::unordered_set<std::size_t> tracks_; // already named
+};
+
+
+
+/** records the scopes of one thread, events are buffered and folded into the call tree when
+ * the buffer is full
+ */
+class ThreadProfile
+{
+public:
+    static constexpr std::size_t capacity = 4096;
+
+    explicit ThreadProfile(std::size_t const index)
+        : index_{index}
+    {
+    }
+
+    void enter(Site const& site) { record_(&site); }
+    void exit() { record_(nullptr); }
+
+    void drain();
+
+    // scopes still open are kept, and only their time from now on is counted once they close
+    void reset();
+
+    NO_DISCARD auto const& tree() const { return tree_; }
+
+private:
+    void record_(Site const* const site)
+    {
+        if (size_ == capacity)
+            drain();
+        events_[size_++] = {ticks(), site, amrLevel};
+    }
+
+    struct Event
+    {
+        std::uint64_t ticks;
+        Site const* site; // nullptr on exit
+        int level;
+    };
+
+    struct Open
+    {
+        std::size_t node;
+        std::uint64_t ticks;
+        Site const* site;
+        int level;
+    };
+
+    std::size_t const index_;
+    std::array<Event, capacity> events_;
+    std::size_t size_ = 0;
+    CallTree tree_;
+    std::vector<Open> stack_;
+};
+
+
+
+class Profiler
+{
+public:
+    NO_DISCARD static Profiler& INSTANCE();
+
+    NO_DISCARD static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    // starts recording, reports are also made at each diagnostics dump if onDump
+    void enable(bool const onDump = false);
+    void disable() { enabled_ = false; }
+
+    NO_DISCARD bool reportsOnDump() const { return enabled() and onDump_; }
+
+    NO_DISCARD static ThreadProfile& thread()
+    {
+        thread_local ThreadProfile* profile = INSTANCE().addThread_();
+        return *profile;
+    }
+
+    /** gathers the call trees of all threads of all ranks, rank 0 appends to file the min, mean
+     * and max over ranks of the time spent in each scope, indented by call depth, then the
+     * recorded times are reset. Collective over MPI_COMM_WORLD, other threads must not be
+     * recording meanwhile.
+     */
+    void report(std::string const& title, std::string const& file = ".phare/timings/profile.txt");
+
+    /** starts recording and writes the scopes of this rank to directory/rank.<rank>.json as
+     * Chrome trace events, timestamps are in microseconds since this call. Collective over
+     * MPI_COMM_WORLD, so that ranks share their time origin up to a barrier latency.
+     */
+    void trace(std::string const& directory = ".phare/traces");
+
+    // writes the events still buffered and closes the trace, same constraints as report()
+    void closeTrace();
+
+    NO_DISCARD Tracer* tracer() const { return tracer_.get(); }
+
+    NO_DISCARD std::uint64_t startTicks() const { return startTicks_; }
+
+    // calibrated from the ticks and time elapsed since enabling
+    NO_DISCARD double secondsPerTick() const;
+
+    std::uint32_t addSite(Site const& site);
+
+private:
+    Profiler() = default;
+
+    ThreadProfile* addThread_();
+
+    // folded stacks of this rank, a line "a;b;c" followed by its "seconds count level" line
+    std::string folded_();
+
+    static inline std::atomic<bool> enabled_{false};
+    bool onDump_ = false;
+
+    std::mutex mutex_;
+    std::vector<Site const*> sites_;
+    std::vector<std::unique_ptr<ThreadProfile>> threads_;
+    std::unique_ptr<Tracer> tracer_;
+
+    std::uint64_t startTicks_ = 0;
+    std::chrono::steady_clock::time_point startTime_;
+};
+
+
+
+inline Site::Site(std::uint8_t const level_, char const* const name_)
+    : level{level_}
+    , name{name_}
+    , id{Profiler::INSTANCE().addSite(*this)}
+{
+}
+
+
+
+struct Scope
+{
+    Scope(Site const& site)
+        : active{Profiler::enabled()}
+    {
+        if (active)
+            Profiler::thread().enter(site);
+    }
+
+    ~Scope()
+    {
+        if (active)
+            Profiler::thread().exit();
+    }
+
+    bool const active;
+};
+
+
+// sets the AMR level the calling thread works on, for traces
+struct LevelScope
+{
+    LevelScope(int const level)
+        : previous{amrLevel}
+    {
+        amrLevel = level;
+    }
+
+    ~LevelScope() { amrLevel = previous; }
+
+    int const previous;
+};
+
+
+inline void start(Site const& site)
+{
+    if (Profiler::enabled())
+        Profiler::thread().enter(site);
+}
+
+inline void stop()
+{
+    if (Profiler::enabled())
+        Profiler::thread().exit();
+}
+
+} // namespace PHARE::core::profiler
+
+
+
+#define PHARE_PROFILER_SCOPE(lvl, str)                                                             \
+    static PHARE::core::profiler::Site const PHARE_STR_CAT(_phare_site_, __LINE__){lvl, str};      \
+    PHARE::core::profiler::Scope PHARE_STR_CAT(_phare_scope_, __LINE__)                            \
+    {                                                                                              \
+        PHARE_STR_CAT(_phare_site_, __LINE__)                                                      \
+    }
+
+#define PHARE_PROFILER_START(lvl, str)                                                             \
+    do                                                                                             \
+    {                                                                                              \
+        static PHARE::core::profiler::Site const _phare_site{lvl, str};                            \
+        PHARE::core::profiler::start(_phare_site);                                                 \
+    } while (0)
+
+#define PHARE_PROFILER_STOP(lvl, str) PHARE::core::profiler::stop()
+
+
+#endif /* PHARE_CORE_UTILITIES_LOGGER_SCOPE_PROFILER_HPP */
@@ -0,0 +1,130 @@
+#include "memory_usage.hpp"
+
+#include "core/utilities/mpi_utils.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <filesystem>
+
+#include <sys/resource.h>
+
+
+namespace PHARE::core
+{
+void MemoryReport::keep_max(MemoryReport const& that)
+{
+    for (std::size_t iLevel = 0; iLevel < that.levels_.size(); ++iLevel)
+    {
+        auto& level = this->level(iLevel);
+        auto it     = that.levels_[iLevel].begin();
+        for (auto& usage : level)
+        {
+            usage.used     = std::max(usage.used, it->used);
+            usage.reserved = std::max(usage.reserved, it->reserved);
+            ++it;
+        }
+    }
+}
+
+
+MemoryReport::Stats MemoryReport::reduce() const
+{
+    auto const nbrLevels = mpi::max(levels_.size());
+
+    // used and reserved of each kind of each level, then of all levels, then the peak RSS
+    std::vector<std::size_t> local(nbrLevels * nbrMemoryKinds * 2 + 3, 0);
+    auto value = local.begin();
+    for (auto const& level : levels_)
+        for (auto const& usage : level)
+        {
+            *value++ = usage.used;
+            *value++ = usage.reserved;
+        }
+    auto const total = this->total();
+    local.end()[-3]  = total.used;
+    local.end()[-2]  = total.reserved;
+    local.end()[-1]  = peak_rss();
+
+    auto const global = mpi::min_max_sum(local);
+
+    Stats stats;
+    stats.nbrRanks = mpi::size();
+    for (auto const& [report, values] : {std::make_pair(&stats.min, &global[0]),
+                                         std::make_pair(&stats.max, &global[1]),
+                                         std::make_pair(&stats.sum, &global[2])})
+    {
+        auto reduced = values->begin();
+        for (std::size_t iLevel = 0; iLevel < nbrLevels; ++iLevel)
+            for (auto& usage : report->level(iLevel))
+            {
+                usage.used     = *reduced++;
+                usage.reserved = *reduced++;
+            }
+    }
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        stats.total[i]   = {global[i].end()[-3], global[i].end()[-2]};
+        stats.peakRSS[i] = global[i].end()[-1];
+    }
+
+    return stats;
+}
+
+
+
+std::size_t peak_rss()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024; // kilobytes on linux
+}
+
+
+
+void write(MemoryReport::Stats const& current, MemoryReport::Stats const& peak,
+           std::string const& title, std::string const& file)
+{
+    if (mpi::rank() != 0)
+        return;
+
+    auto const MiB = [](std::size_t const bytes) { return bytes / (1024. * 1024.); };
+
+    std::filesystem::create_directories(std::filesystem::path{file}.parent_path());
+    std::ofstream out{file, std::ios::app};
+    out << std::fixed << std::setprecision(2);
+    out << "# " << title << ", " << current.nbrRanks
+        << " ranks, MiB min / max / sum over ranks  used  reserved  reserved high watermark max\n";
+
+    auto const line = [&](std::string const& name, MemoryUsage const& min, MemoryUsage const& max,
+                          MemoryUsage const& sum) {
+        out << std::left << std::setw(26) << name << std::right << MiB(min.used) << " / "
+            << MiB(max.used) << " / " << MiB(sum.used) << "  " << MiB(min.reserved) << " / "
+            << MiB(max.reserved) << " / " << MiB(sum.reserved);
+    };
+
+    auto const& levels = current.sum.levels();
+    for (std::size_t iLevel = 0; iLevel < levels.size(); ++iLevel)
+    {
+        auto const& min = current.min.levels()[iLevel];
+        auto const& max = current.max.levels()[iLevel];
+        auto const& sum = levels[iLevel];
+        auto const peakMax
+            = iLevel < peak.max.levels().size() ? peak.max.levels()[iLevel] : LevelMemory{};
+
+        out << "level " << iLevel << '\n';
+        for (std::size_t iKind = 0; iKind < nbrMemoryKinds; ++iKind)
+        {
+            auto const kind = static_cast<MemoryKind>(iKind);
+            line("  " + std::string{memoryKindNames[iKind]}, min[kind], max[kind], sum[kind]);
+            out << "  " << MiB(peakMax[kind].reserved) << '\n';
+        }
+    }
+
+    // the min and max of all levels are over the totals of ranks, not sums of the above
+    line("all levels", current.total[0], current.total[1], current.total[2]);
+    out << "\npeak RSS  " << MiB(current.peakRSS[0]) << " / " << MiB(current.peakRSS[1]) << " / "
+        << MiB(current.peakRSS[2]) << "\n\n";
+}
+
+} // namespace PHARE::core
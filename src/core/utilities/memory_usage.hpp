@@ -0,0 +1,158 @@
+#ifndef PHARE_CORE_UTILITIES_MEMORY_USAGE_HPP
+#define PHARE_CORE_UTILITIES_MEMORY_USAGE_HPP
+
+#include "core/def.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+/*
+  Bytes of the data of a rank, per AMR level and per kind of data, see MemoryReport. Used bytes
+  hold data, reserved bytes also count the capacity containers keep allocated beyond their size.
+*/
+
+namespace PHARE::core
+{
+struct MemoryUsage
+{
+    std::size_t used     = 0;
+    std::size_t reserved = 0;
+
+    MemoryUsage& operator+=(MemoryUsage const& that)
+    {
+        used += that.used;
+        reserved += that.reserved;
+        return *this;
+    }
+};
+
+
+template<typename T>
+NO_DISCARD MemoryUsage memory_usage(std::vector<T> const& vector)
+{
+    return {vector.size() * sizeof(T), vector.capacity() * sizeof(T)};
+}
+
+
+
+enum class MemoryKind : std::uint8_t {
+    domain_particles,
+    patch_ghost_particles,
+    level_ghost_particles, // including the old and new ones of the level ghost refinement
+    leaving_particles,
+    cellmaps, // of all the particle arrays above
+    fields,
+    solver_scratch, // data the solver keeps between its steps, fields and particles
+};
+
+inline constexpr std::array<char const*, 7> memoryKindNames{
+    "domain_particles", "patch_ghost_particles", "level_ghost_particles", "leaving_particles",
+    "cellmaps",         "fields",                "solver_scratch"};
+
+inline constexpr std::size_t nbrMemoryKinds = memoryKindNames.size();
+
+
+
+class LevelMemory
+{
+public:
+    NO_DISCARD auto& operator[](MemoryKind const kind)
+    {
+        return usage_[static_cast<std::size_t>(kind)];
+    }
+    NO_DISCARD auto& operator[](MemoryKind const kind) const
+    {
+        return usage_[static_cast<std::size_t>(kind)];
+    }
+
+    // the particles in kind, their cell map in cellmaps
+    template<typename ParticleArray>
+    void addParticles(MemoryKind const kind, ParticleArray const& particles)
+    {
+        (*this)[kind] += particles.memory_usage();
+        (*this)[MemoryKind::cellmaps] += particles.cellmap_memory_usage();
+    }
+
+    NO_DISCARD MemoryUsage total() const
+    {
+        MemoryUsage total;
+        for (auto const& usage : usage_)
+            total += usage;
+        return total;
+    }
+
+    NO_DISCARD auto begin() const { return usage_.begin(); }
+    NO_DISCARD auto end() const { return usage_.end(); }
+    NO_DISCARD auto begin() { return usage_.begin(); }
+    NO_DISCARD auto end() { return usage_.end(); }
+
+private:
+    std::array<MemoryUsage, nbrMemoryKinds> usage_{};
+};
+
+
+
+/** memory of a rank per AMR level. Reduced over ranks, each entry gives its min, max and sum,
+ * levels without patches on a rank counting for 0 bytes there.
+ */
+class MemoryReport
+{
+public:
+    struct Stats;
+
+    NO_DISCARD LevelMemory& level(std::size_t const iLevel)
+    {
+        if (iLevel >= levels_.size())
+            levels_.resize(iLevel + 1);
+        return levels_[iLevel];
+    }
+
+    NO_DISCARD auto const& levels() const { return levels_; }
+
+    NO_DISCARD MemoryUsage total() const
+    {
+        MemoryUsage total;
+        for (auto const& level : levels_)
+            total += level.total();
+        return total;
+    }
+
+    // keeps the max of each entry, to follow the high watermark of successive reports
+    void keep_max(MemoryReport const& that);
+
+    // collective over MPI_COMM_WORLD
+    NO_DISCARD Stats reduce() const;
+
+private:
+    std::vector<LevelMemory> levels_;
+};
+
+
+struct MemoryReport::Stats
+{
+    MemoryReport min, max, sum;
+    std::array<MemoryUsage, 3> total{};   // of all levels, min, max, sum
+    std::array<std::size_t, 3> peakRSS{}; // min, max, sum
+    int nbrRanks = 0;
+};
+
+
+
+// resident set size high watermark of this process, in bytes
+NO_DISCARD std::size_t peak_rss();
+
+
+/** rank 0 appends to file the MiB used and reserved per level and kind, min / max / sum over
+ * ranks, with the max over ranks of the reserved bytes high watermark of each entry from peak.
+ */
+void write(MemoryReport::Stats const& current, MemoryReport::Stats const& peak,
+           std::string const& title, std::string const& file = ".phare/memory/report.txt");
+
+} // namespace PHARE::core
+
+
+#endif /* PHARE_CORE_UTILITIES_MEMORY_USAGE_HPP */
@@ -72,6 +72,8 @@ namespace core
     constexpr decltype(auto) possibleSimulators()
     {
         // inner tuple = dim, interp, list[possible nbrParticles for dim/interp]
+        // 3D is not there yet: 3D splitters exist but the magnetic field coarsening and the fix
+        // of its divergence at level borders are only implemented up to 2D
         return std::tuple<SimulatorOption<DimConst<1>, InterpConst<1>, 2, 3>,
                           SimulatorOption<DimConst<1>, InterpConst<2>, 2, 3, 4>,
                           SimulatorOption<DimConst<1>, InterpConst<3>, 2, 3, 4, 5>,
@@ -27,6 +27,68 @@ std::size_t max(std::size_t const local, int mpi_size)
 
 
 
+namespace
+{
+    // a pair of doubles reduces to the sum of the first and the max of the second
+    void sum_and_max_op(void* in, void* inout, int* len, MPI_Datatype*)
+    {
+        auto const* a = static_cast<double const*>(in);
+        auto* b       = static_cast<double*>(inout);
+        for (int i = 0; i < *len; ++i, a += 2, b += 2)
+        {
+            b[0] += a[0];
+            b[1] = std::max(a[1], b[1]);
+        }
+    }
+} // namespace
+
+std::array<double, 2> sum_and_max(double const local)
+{
+    static auto const pair = [] {
+        MPI_Datatype type;
+        MPI_Type_contiguous(2, MPI_DOUBLE, &type);
+        MPI_Type_commit(&type);
+        return type;
+    }();
+    static auto const op = [] {
+        MPI_Op sumAndMax;
+        MPI_Op_create(&sum_and_max_op, /*commute=*/1, &sumAndMax);
+        return sumAndMax;
+    }();
+
+    std::array<double, 2> const send{local, local};
+    std::array<double, 2> global;
+    MPI_Allreduce(send.data(), global.data(), 1, pair, op, MPI_COMM_WORLD);
+    return global;
+}
+
+
+std::array<std::vector<std::size_t>, 3> min_max_sum(std::vector<std::size_t> const& local)
+{
+    auto const count = static_cast<int>(local.size());
+    auto const type  = mpi_type_for<std::size_t>();
+
+    std::array<std::vector<std::size_t>, 3> global;
+    for (auto& values : global)
+        values.resize(local.size());
+
+    MPI_Allreduce(local.data(), global[0].data(), count, type, MPI_MIN, MPI_COMM_WORLD);
+    MPI_Allreduce(local.data(), global[1].data(), count, type, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Allreduce(local.data(), global[2].data(), count, type, MPI_SUM, MPI_COMM_WORLD);
+    return global;
+}
+
+
+std::vector<double> sum(std::vector<double> const& local)
+{
+    std::vector<double> global(local.size());
+    MPI_Allreduce(local.data(), global.data(), static_cast<int>(local.size()), MPI_DOUBLE, MPI_SUM,
+                  MPI_COMM_WORLD);
+    return global;
+}
+
+
+
 bool any(bool b)
 {
     int global_sum, local_sum = static_cast<int>(b);
@@ -2,6 +2,7 @@
 #define PHARE_CORE_UTILITIES_MPI_HPP
 
 #include "core/def.hpp"
+#include <array>
 #include <chrono>
 #include <vector>
 #include <string>
@@ -21,6 +22,16 @@ NO_DISCARD std::vector<Data> collect(Data const& data, int mpi_size = 0);
 
 NO_DISCARD std::size_t max(std::size_t const local, int mpi_size = 0);
 
+// sum and max over all ranks, in a single reduction
+NO_DISCARD std::array<double, 2> sum_and_max(double const local);
+
+// element wise min, max and sum over all ranks, local must have the same size on all ranks
+NO_DISCARD std::array<std::vector<std::size_t>, 3>
+min_max_sum(std::vector<std::size_t> const& local);
+
+// element wise sum over all ranks, local must have the same size on all ranks
+NO_DISCARD std::vector<double> sum(std::vector<double> const& local);
+
 NO_DISCARD bool any(bool);
 
 NO_DISCARD int size();
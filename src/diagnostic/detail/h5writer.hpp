@@ -3,6 +3,7 @@
 
 
 #include "core/data/vecfield/vecfield_component.hpp"
+#include "core/logger.hpp"
 #include "core/utilities/mpi_utils.hpp"
 #include "core/utilities/types.hpp"
 #include "core/utilities/meta/meta_utilities.hpp"
@@ -33,6 +34,14 @@ template<typename Writer>
 class MetaDiagnosticWriter;
 template<typename Writer>
 class InfoDiagnosticWriter;
+template<typename Writer>
+class PerformanceDiagnosticWriter;
+template<typename Writer>
+class TimeAverageDiagnosticWriter;
+template<typename Writer>
+class DistributionDiagnosticWriter;
+template<typename Writer>
+class TracerDiagnosticWriter;
 
 
 
@@ -175,6 +184,7 @@ private:
     double timestamp_ = 0;
     std::string filePath_;
     std::string patchPath_; // is passed around as "virtual write()" has no parameters
+    GridLayout const* patchLayout_ = nullptr; // idem, for the patch being visited
     ModelView modelView_;
     Attributes fileAttributes_;
 
@@ -185,7 +195,11 @@ private:
         {"meta", make_writer<MetaDiagnosticWriter<This>>()},
         {"fluid", make_writer<FluidDiagnosticWriter<This>>()},
         {"electromag", make_writer<ElectromagDiagnosticWriter<This>>()},
-        {"particle", make_writer<ParticlesDiagnosticWriter<This>>()} //
+        {"particle", make_writer<ParticlesDiagnosticWriter<This>>()},
+        {"performance", make_writer<PerformanceDiagnosticWriter<This>>()},
+        {"time_average", make_writer<TimeAverageDiagnosticWriter<This>>()},
+        {"distribution", make_writer<DistributionDiagnosticWriter<This>>()},
+        {"tracer", make_writer<TracerDiagnosticWriter<This>>()} //
     };
 
     template<typename Writer>
@@ -211,6 +225,10 @@ private:
     friend class ParticlesDiagnosticWriter<This>;
     friend class MetaDiagnosticWriter<This>;
     friend class InfoDiagnosticWriter<This>;
+    friend class PerformanceDiagnosticWriter<This>;
+    friend class TimeAverageDiagnosticWriter<This>;
+    friend class DistributionDiagnosticWriter<This>;
+    friend class TracerDiagnosticWriter<This>;
     friend class H5TypeWriter<This>;
 
     // used by friends start
@@ -220,8 +238,14 @@ private:
                                 iLevel, globalCoords);
     }
 
+    std::string getTimestampPath() const
+    {
+        return "/t/" + core::to_string_with_precision(timestamp_, timestamp_precision);
+    }
+
 
     auto& patchPath() const { return patchPath_; }
+    auto& patchLayout() const { return *patchLayout_; }
     // used by friends end
 };
 
@@ -231,6 +255,8 @@ template<typename ModelView>
 void H5Writer<ModelView>::dump(std::vector<DiagnosticProperties*> const& diagnostics,
                                double timestamp)
 {
+    PHARE_LOG_SCOPE(1, "H5Writer::dump");
+
     timestamp_                     = timestamp;
     fileAttributes_["dimension"]   = dimension;
     fileAttributes_["interpOrder"] = interpOrder;
@@ -286,7 +312,9 @@ void H5Writer<ModelView>::initializeDatasets_(std::vector<DiagnosticProperties*>
     for (auto* diag : diagnostics)
         typeWriters_.at(diag->type)->createFiles(*diag);
 
-    auto collectPatchAttributes = [&](GridLayout&, std::string patchID, std::size_t iLevel) {
+    auto collectPatchAttributes = [&](GridLayout& gridLayout, std::string patchID,
+                                      std::size_t iLevel) {
+        patchLayout_ = &gridLayout;
         if (!lvlPatchIDs.count(iLevel))
             lvlPatchIDs.emplace(iLevel, std::vector<std::string>());
 
@@ -326,7 +354,8 @@ void H5Writer<ModelView>::writeDatasets_(std::vector<DiagnosticProperties*> cons
     auto writePatch = [&](GridLayout& gridLayout, std::string patchID, std::size_t iLevel) {
         if (!patchAttributes.count(iLevel))
             patchAttributes.emplace(iLevel, std::vector<std::pair<std::string, Attributes>>{});
-        patchPath_ = getPatchPathAddTimestamp(iLevel, patchID);
+        patchPath_   = getPatchPathAddTimestamp(iLevel, patchID);
+        patchLayout_ = &gridLayout;
         patchAttributes[iLevel].emplace_back(patchID,
                                              modelView_.getPatchProperties(patchID, gridLayout));
         for (auto* diagnostic : diagnostics)
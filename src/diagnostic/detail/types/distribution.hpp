@@ -0,0 +1,196 @@
+#ifndef PHARE_DIAGNOSTIC_DETAIL_TYPES_DISTRIBUTION_HPP
+#define PHARE_DIAGNOSTIC_DETAIL_TYPES_DISTRIBUTION_HPP
+
+#include "diagnostic/detail/h5typewriter.hpp"
+
+#include "core/utilities/mpi_utils.hpp"
+#include "core/numerics/distribution/velocity_histogram.hpp"
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <unordered_map>
+
+
+namespace PHARE::diagnostic::h5
+{
+/*
+ * Possible outputs
+ *
+ * /t#/histogram
+ *
+ * quantities are /ions/pop/<pop>/distribution/<name>, the histogram of the domain particles of
+ * the population on one level, reduced over all patches and ranks, see core::VelocityHistogram.
+ * Its parameters are file attributes: axes, bins, ranges, boxes, level. Patches are not written.
+ */
+template<typename H5Writer>
+class DistributionDiagnosticWriter : public H5TypeWriter<H5Writer>
+{
+public:
+    using Super = H5TypeWriter<H5Writer>;
+    using Super::fileData_;
+    using Super::h5Writer_;
+    using Attributes = typename Super::Attributes;
+    using GridLayout = typename H5Writer::GridLayout;
+    using Histogram  = core::VelocityHistogram<GridLayout::dimension>;
+
+    static constexpr auto dimension = GridLayout::dimension;
+
+    DistributionDiagnosticWriter(H5Writer& h5Writer)
+        : Super{h5Writer}
+    {
+    }
+
+    void write(DiagnosticProperties&) override;
+    void compute(DiagnosticProperties&) override {}
+
+    void createFiles(DiagnosticProperties& diagnostic) override;
+
+    void getDataSetInfo(DiagnosticProperties&, std::size_t /*iLevel*/,
+                        std::string const& /*patchID*/, Attributes& /*patchAttributes*/) override
+    {
+    }
+
+    void initDataSets(DiagnosticProperties&,
+                      std::unordered_map<std::size_t, std::vector<std::string>> const&,
+                      Attributes&, std::size_t /*maxLevel*/) override
+    {
+    }
+
+    void writeAttributes(
+        DiagnosticProperties&, Attributes&,
+        std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>&,
+        std::size_t maxLevel) override;
+
+private:
+    static inline std::string const tree{"/distribution/"};
+
+    Histogram& histogram_(DiagnosticProperties const& diagnostic);
+
+    std::unordered_map<std::string, Histogram> histograms_;
+};
+
+
+
+template<typename H5Writer>
+void DistributionDiagnosticWriter<H5Writer>::createFiles(DiagnosticProperties& diagnostic)
+{
+    for (auto const& pop : this->h5Writer_.modelView().getIons())
+    {
+        std::string const popTree{"/ions/pop/" + pop.name() + tree};
+        if (diagnostic.quantity.rfind(popTree, 0) == 0 and !fileData_.count(diagnostic.quantity))
+            fileData_.emplace(diagnostic.quantity, this->h5Writer_.makeFile(diagnostic));
+    }
+}
+
+
+
+template<typename H5Writer>
+auto DistributionDiagnosticWriter<H5Writer>::histogram_(DiagnosticProperties const& diagnostic)
+    -> Histogram&
+{
+    if (auto it = histograms_.find(diagnostic.quantity); it != histograms_.end())
+        return it->second;
+
+    auto const& bins   = diagnostic.param<std::vector<int>>("bins");
+    auto const& ranges = diagnostic.param<std::vector<double>>("ranges");
+    auto const& boxes  = diagnostic.param<std::vector<double>>("boxes");
+
+    std::vector<typename Histogram::Axis> axes;
+    std::istringstream names{diagnostic.param<std::string>("axes")};
+    for (std::string name; std::getline(names, name, ',');)
+    {
+        auto const i = axes.size();
+        if (i >= bins.size() or 2 * i + 1 >= ranges.size())
+            throw std::runtime_error("DistributionDiagnosticWriter: missing bins or range of "
+                                     + name + " for " + diagnostic.quantity);
+        axes.push_back({Histogram::component(name), static_cast<std::size_t>(bins[i]),
+                        ranges[2 * i], ranges[2 * i + 1]});
+    }
+
+    auto const make = [&]() {
+        auto& modelView = this->h5Writer_.modelView();
+        if (boxes.empty())
+        {
+            core::Box<int, dimension> cells;
+            std::array<double, dimension> meshSize;
+            for (std::size_t iDim = 0; iDim < dimension; ++iDim)
+            {
+                cells.lower[iDim] = 0;
+                cells.upper[iDim] = modelView.domainBox()[iDim];
+                meshSize[iDim]    = modelView.cellWidth()[iDim];
+            }
+            return Histogram{std::move(axes), cells, meshSize};
+        }
+
+        if (boxes.size() % (2 * dimension) != 0)
+            throw std::runtime_error("DistributionDiagnosticWriter: boxes of "
+                                     + diagnostic.quantity + " are not lower/upper corners");
+        std::vector<typename Histogram::Region> regions(boxes.size() / (2 * dimension));
+        for (std::size_t iBox = 0; iBox < regions.size(); ++iBox)
+            for (std::size_t iDim = 0; iDim < dimension; ++iDim)
+            {
+                regions[iBox][0][iDim] = boxes[iBox * 2 * dimension + iDim];
+                regions[iBox][1][iDim] = boxes[iBox * 2 * dimension + dimension + iDim];
+            }
+        return Histogram{std::move(axes), std::move(regions)};
+    };
+
+    return histograms_.emplace(diagnostic.quantity, make()).first->second;
+}
+
+
+
+template<typename H5Writer>
+void DistributionDiagnosticWriter<H5Writer>::write(DiagnosticProperties& diagnostic)
+{
+    auto& h5Writer     = this->h5Writer_;
+    auto const& layout = h5Writer.patchLayout();
+    auto const popTree = diagnostic.quantity.substr(std::string{"/ions/pop/"}.size());
+
+    // domain particles of different levels overlap
+    if (static_cast<std::size_t>(layout.levelNumber()) != diagnostic.param<std::size_t>("level"))
+        return;
+
+    auto& histogram = histogram_(diagnostic);
+    auto& modelView = h5Writer.modelView();
+    for (auto const& pop : modelView.getIons())
+        if (popTree.rfind(pop.name() + tree, 0) == 0)
+            histogram.add(pop.domainParticles(), modelView.getElectromag(), layout);
+}
+
+
+
+template<typename H5Writer>
+void DistributionDiagnosticWriter<H5Writer>::writeAttributes(
+    DiagnosticProperties& diagnostic, Attributes& fileAttributes,
+    std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>&,
+    std::size_t /*maxLevel*/)
+{
+    auto& h5Writer  = this->h5Writer_;
+    auto& h5file    = *fileData_.at(diagnostic.quantity);
+    auto& histogram = histogram_(diagnostic);
+
+    // all ranks create the dataset, the reduced histogram is written once
+    auto const counts = core::mpi::sum(histogram.counts());
+    auto const path   = h5Writer.getTimestampPath() + "/histogram";
+    h5file.template create_data_set<double>(path, histogram.shape());
+    if (core::mpi::rank() == 0)
+        h5file.write_data_set_flat(path, counts.data());
+    histogram.zero();
+
+    h5Writer.writeAttribute(h5file, "/", "axes", diagnostic.param<std::string>("axes"));
+    h5Writer.writeAttribute(h5file, "/", "bins", diagnostic.param<std::vector<int>>("bins"));
+    for (auto const& key : {"ranges", "boxes"})
+        h5Writer.writeAttribute(h5file, "/", key, diagnostic.param<std::vector<double>>(key));
+    h5Writer.writeAttribute(h5file, "/", "level", diagnostic.param<std::size_t>("level"));
+
+    if (diagnostic.nAttributes > 0)
+        h5Writer.writeAttributeDict(h5file, diagnostic.fileAttributes, "/py_attrs");
+    h5Writer.writeGlobalAttributeDict(h5file, fileAttributes, "/");
+}
+
+
+} // namespace PHARE::diagnostic::h5
+
+#endif /* PHARE_DIAGNOSTIC_DETAIL_TYPES_DISTRIBUTION_HPP */
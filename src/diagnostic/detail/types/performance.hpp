@@ -0,0 +1,224 @@
+#ifndef PHARE_DIAGNOSTIC_DETAIL_TYPES_PERFORMANCE_HPP
+#define PHARE_DIAGNOSTIC_DETAIL_TYPES_PERFORMANCE_HPP
+
+#include "diagnostic/detail/h5typewriter.hpp"
+
+
+namespace PHARE::diagnostic::h5
+{
+/*
+ * Possible outputs
+ *
+ * /t#/pl#/p# attributes of /patch_load:
+ *     compute_time: seconds spent pushing the patch particles since the previous dump
+ *     particle_count, ghost_particle_count: summed over populations
+ *     (pop)_particle_count, (pop)_ghost_particle_count
+ *
+ * /t#/pl#/p#/workload: domain particles per cell summed over populations, which is the workload
+ *     the NPPC load balancing strategy gives the partitioner
+ */
+template<typename H5Writer>
+class PerformanceDiagnosticWriter : public H5TypeWriter<H5Writer>
+{
+public:
+    using Super = H5TypeWriter<H5Writer>;
+    using Super::checkCreateFileFor_;
+    using Super::fileData_;
+    using Super::h5Writer_;
+    using Super::initDataSets_;
+    using Super::writeAttributes_;
+    using Attributes = typename Super::Attributes;
+    using GridLayout = typename H5Writer::GridLayout;
+    using FloatType  = typename H5Writer::FloatType;
+
+    static constexpr auto dimension = GridLayout::dimension;
+
+    PerformanceDiagnosticWriter(H5Writer& h5Writer)
+        : Super{h5Writer}
+    {
+    }
+
+    void write(DiagnosticProperties&) override;
+
+    void compute(DiagnosticProperties&) override {}
+
+    void createFiles(DiagnosticProperties& diagnostic) override;
+
+    void getDataSetInfo(DiagnosticProperties& diagnostic, std::size_t iLevel,
+                        std::string const& patchID, Attributes& patchAttributes) override;
+
+    void initDataSets(DiagnosticProperties& diagnostic,
+                      std::unordered_map<std::size_t, std::vector<std::string>> const& patchIDs,
+                      Attributes& patchAttributes, std::size_t maxLevel) override;
+
+    void writeAttributes(
+        DiagnosticProperties&, Attributes&,
+        std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>&,
+        std::size_t maxLevel) override;
+
+private:
+    void patchLoad_(Attributes& attributes, std::size_t iLevel, std::string const& patchID);
+};
+
+
+template<typename H5Writer>
+void PerformanceDiagnosticWriter<H5Writer>::createFiles(DiagnosticProperties& diagnostic)
+{
+    std::string tree{"/"};
+    checkCreateFileFor_(diagnostic, fileData_, tree, "patch_load", "workload");
+}
+
+
+template<typename H5Writer>
+void PerformanceDiagnosticWriter<H5Writer>::getDataSetInfo(DiagnosticProperties& diagnostic,
+                                                           std::size_t iLevel,
+                                                           std::string const& patchID,
+                                                           Attributes& patchAttributes)
+{
+    if (diagnostic.quantity == "/workload")
+    {
+        auto const nbrCells = this->h5Writer_.patchLayout().nbrCells();
+        patchAttributes[std::to_string(iLevel) + "_" + patchID]["workload"]
+            = std::vector<std::size_t>(nbrCells.begin(), nbrCells.end());
+    }
+}
+
+
+template<typename H5Writer>
+void PerformanceDiagnosticWriter<H5Writer>::initDataSets(
+    DiagnosticProperties& diagnostic,
+    std::unordered_map<std::size_t, std::vector<std::string>> const& patchIDs,
+    Attributes& patchAttributes, std::size_t maxLevel)
+{
+    auto& h5Writer = this->h5Writer_;
+
+    auto initPatch = [&](auto& iLevel, auto& attr, std::string patchID = "") {
+        bool null = patchID.empty();
+
+        std::string path{h5Writer.getPatchPathAddTimestamp(iLevel, patchID)};
+
+        if (diagnostic.quantity == "/workload")
+            h5Writer.template createDataSet<double>(
+                *fileData_.at(diagnostic.quantity), path + "/workload",
+                null ? std::vector<std::size_t>(dimension, 0)
+                     : attr["workload"].template to<std::vector<std::size_t>>());
+    };
+
+    initDataSets_(patchIDs, patchAttributes, maxLevel, initPatch);
+}
+
+
+
+template<typename H5Writer>
+void PerformanceDiagnosticWriter<H5Writer>::write(DiagnosticProperties& diagnostic)
+{
+    if (diagnostic.quantity != "/workload")
+        return;
+
+    auto& h5Writer   = this->h5Writer_;
+    auto const& ions = h5Writer.modelView().getIons();
+    auto const box   = h5Writer.patchLayout().AMRBox();
+
+    // the AMR box is iterated in the order of field datasets
+    std::vector<double> workload;
+    workload.reserve(box.size());
+    for (auto const& cell : box)
+        workload.push_back(core::sum_from(ions, [&](auto const& pop) {
+            return pop.domainParticles().nbr_particles_in(cell.toArray());
+        }));
+
+    auto& h5 = *fileData_.at(diagnostic.quantity);
+    h5.template write_data_set_flat<dimension>(h5Writer.patchPath() + "/workload",
+                                               workload.data());
+}
+
+
+
+template<typename H5Writer>
+void PerformanceDiagnosticWriter<H5Writer>::patchLoad_(Attributes& attributes,
+                                                       std::size_t const iLevel,
+                                                       std::string const& patchID)
+{
+    auto& modelView = this->h5Writer_.modelView();
+
+    std::size_t domain = 0, ghosts = 0;
+    for (auto const& pop : modelView.getIons())
+    {
+        auto const popDomain = pop.domainParticles().size();
+        auto const popGhosts = pop.patchGhostParticles().size() + pop.levelGhostParticles().size();
+        attributes[pop.name() + "_particle_count"]       = popDomain;
+        attributes[pop.name() + "_ghost_particle_count"] = popGhosts;
+        domain += popDomain;
+        ghosts += popGhosts;
+    }
+    attributes["particle_count"]       = domain;
+    attributes["ghost_particle_count"] = ghosts;
+
+    // read once, so that the next dump has the time spent since this one
+    auto& patchTimes           = modelView.getPatchTimes();
+    attributes["compute_time"] = 0.;
+    if (iLevel < patchTimes.size())
+    {
+        auto& levelTimes = patchTimes[iLevel];
+        if (auto const time = levelTimes.find(patchID); time != levelTimes.end())
+        {
+            attributes["compute_time"] = time->second;
+            levelTimes.erase(time);
+        }
+    }
+}
+
+
+template<typename H5Writer>
+void PerformanceDiagnosticWriter<H5Writer>::writeAttributes(
+    DiagnosticProperties& diagnostic, Attributes& fileAttributes,
+    std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>&
+        patchAttributes,
+    std::size_t maxLevel)
+{
+    auto& h5Writer = this->h5Writer_;
+    auto& file     = *fileData_.at(diagnostic.quantity);
+
+    if (diagnostic.quantity != "/patch_load")
+    {
+        writeAttributes_(diagnostic, file, fileAttributes, patchAttributes, maxLevel);
+        return;
+    }
+
+    // a copy, as the patch attributes are written for all the diagnostics of a dump
+    auto patchLoads = patchAttributes;
+
+    std::size_t lvl_idx = -1, p_idx = 0;
+    auto gatherPatchLoads = [&](GridLayout&, std::string patchID, std::size_t iLevel) {
+        if (iLevel != lvl_idx)
+        {
+            lvl_idx = iLevel;
+            p_idx   = 0;
+        }
+
+        auto& patches = patchLoads[iLevel];
+        assert(patches[p_idx].first == patchID);
+        patchLoad_(patches[p_idx].second, iLevel, patchID);
+        ++p_idx;
+    };
+    h5Writer.modelView().visitHierarchy(gatherPatchLoads, h5Writer_.minLevel, maxLevel);
+
+    // attributes are written collectively, patches this rank lacks on a level have no load
+    Attributes defaultPatchAttributes;
+    for (auto const& pop : h5Writer.modelView().getIons())
+    {
+        defaultPatchAttributes[pop.name() + "_particle_count"]       = std::size_t{0};
+        defaultPatchAttributes[pop.name() + "_ghost_particle_count"] = std::size_t{0};
+    }
+    defaultPatchAttributes["particle_count"]       = std::size_t{0};
+    defaultPatchAttributes["ghost_particle_count"] = std::size_t{0};
+    defaultPatchAttributes["compute_time"]         = 0.;
+
+    writeAttributes_(diagnostic, file, fileAttributes, patchLoads, maxLevel,
+                     defaultPatchAttributes);
+}
+
+
+} // namespace PHARE::diagnostic::h5
+
+#endif /* PHARE_DIAGNOSTIC_DETAIL_TYPES_PERFORMANCE_HPP */
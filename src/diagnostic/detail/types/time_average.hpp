@@ -0,0 +1,212 @@
+#ifndef PHARE_DIAGNOSTIC_DETAIL_TYPES_TIME_AVERAGE_HPP
+#define PHARE_DIAGNOSTIC_DETAIL_TYPES_TIME_AVERAGE_HPP
+
+#include "diagnostic/detail/h5typewriter.hpp"
+
+
+namespace PHARE::diagnostic::h5
+{
+/*
+ * Possible outputs
+ *
+ * /t#/pl#/p#/(EM_E, EM_B, bulkVelocity)_(x,y,z)
+ * /t#/pl#/p#/density
+ * /t# attribute nbr_samples
+ *
+ * quantities are /time_average/(EM_E, EM_B, density, bulkVelocity), each dump writes the mean of
+ * the samples taken at the compute timestamps since the previous dump, the current time included.
+ * Sums are in the model, see core::TimeAverages.
+ */
+template<typename H5Writer>
+class TimeAverageDiagnosticWriter : public H5TypeWriter<H5Writer>
+{
+public:
+    using Super = H5TypeWriter<H5Writer>;
+    using Super::checkCreateFileFor_;
+    using Super::fileData_;
+    using Super::h5Writer_;
+    using Super::initDataSets_;
+    using Super::writeAttributes_;
+    using Super::writeGhostsAttr_;
+    using Attributes = typename Super::Attributes;
+    using GridLayout = typename H5Writer::GridLayout;
+    using FloatType  = typename H5Writer::FloatType;
+
+    static constexpr auto dimension = GridLayout::dimension;
+
+    TimeAverageDiagnosticWriter(H5Writer& h5Writer)
+        : Super{h5Writer}
+    {
+    }
+
+    void write(DiagnosticProperties&) override;
+    void compute(DiagnosticProperties&) override;
+
+    void createFiles(DiagnosticProperties& diagnostic) override;
+
+    void getDataSetInfo(DiagnosticProperties& diagnostic, std::size_t iLevel,
+                        std::string const& patchID, Attributes& patchAttributes) override;
+
+    void initDataSets(DiagnosticProperties& diagnostic,
+                      std::unordered_map<std::size_t, std::vector<std::string>> const& patchIDs,
+                      Attributes& patchAttributes, std::size_t maxLevel) override;
+
+    void writeAttributes(
+        DiagnosticProperties&, Attributes&,
+        std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>&,
+        std::size_t maxLevel) override;
+
+private:
+    static inline std::string const tree{"/time_average/"};
+
+    static auto quantity_(DiagnosticProperties const& diagnostic)
+    {
+        return diagnostic.quantity.substr(tree.size());
+    }
+};
+
+
+
+template<typename H5Writer>
+void TimeAverageDiagnosticWriter<H5Writer>::compute(DiagnosticProperties& diagnostic)
+{
+    auto& modelView    = this->h5Writer_.modelView();
+    auto& timeAverages = modelView.getTimeAverages();
+    auto& electromag   = modelView.getElectromag();
+    auto& ions         = modelView.getIons();
+    auto const qty     = quantity_(diagnostic);
+
+    auto accumulate = [&](GridLayout&, std::string, std::size_t) {
+        timeAverages.accumulate(qty, electromag, ions);
+    };
+    modelView.visitHierarchy(accumulate, this->h5Writer_.minLevel, this->h5Writer_.maxLevel);
+
+    ++timeAverages.nbrSamples(qty);
+}
+
+
+
+template<typename H5Writer>
+void TimeAverageDiagnosticWriter<H5Writer>::createFiles(DiagnosticProperties& diagnostic)
+{
+    checkCreateFileFor_(diagnostic, fileData_, tree, "EM_E", "EM_B", "density", "bulkVelocity");
+}
+
+
+
+template<typename H5Writer>
+void TimeAverageDiagnosticWriter<H5Writer>::getDataSetInfo(DiagnosticProperties& diagnostic,
+                                                           std::size_t iLevel,
+                                                           std::string const& patchID,
+                                                           Attributes& patchAttributes)
+{
+    auto& timeAverages = this->h5Writer_.modelView().getTimeAverages();
+    auto& attr = patchAttributes[std::to_string(iLevel) + "_" + patchID]["time_average"];
+
+    for (auto* sum : timeAverages.sums(quantity_(diagnostic)))
+    {
+        auto const name = timeAverages.datasetName(*sum);
+
+        // highfive doesn't accept uint32 which ndarray.shape() is
+        auto const& shape = sum->shape();
+        attr[name]        = std::vector<std::size_t>(shape.data(), shape.data() + shape.size());
+
+        auto const ghosts        = GridLayout::nDNbrGhosts(sum->physicalQuantity());
+        attr[name + "_ghosts_x"] = static_cast<std::size_t>(ghosts[0]);
+        if constexpr (dimension > 1)
+            attr[name + "_ghosts_y"] = static_cast<std::size_t>(ghosts[1]);
+        if constexpr (dimension > 2)
+            attr[name + "_ghosts_z"] = static_cast<std::size_t>(ghosts[2]);
+    }
+}
+
+
+
+template<typename H5Writer>
+void TimeAverageDiagnosticWriter<H5Writer>::initDataSets(
+    DiagnosticProperties& diagnostic,
+    std::unordered_map<std::size_t, std::vector<std::string>> const& patchIDs,
+    Attributes& patchAttributes, std::size_t maxLevel)
+{
+    auto& h5Writer     = this->h5Writer_;
+    auto& h5file       = *fileData_.at(diagnostic.quantity);
+    auto& timeAverages = h5Writer.modelView().getTimeAverages();
+    auto const sums    = timeAverages.sums(quantity_(diagnostic));
+
+    auto initDS = [&](auto& path, auto& attr, std::string key, auto null) {
+        auto dsPath = path + "/" + key;
+        h5Writer.template createDataSet<FloatType>(
+            h5file, dsPath,
+            null ? std::vector<std::size_t>(dimension, 0)
+                 : attr[key].template to<std::vector<std::size_t>>());
+
+        this->writeGhostsAttr_(
+            h5file, dsPath, null ? 0 : attr[key + "_ghosts_x"].template to<std::size_t>(), null);
+        if constexpr (dimension > 1)
+            this->writeGhostsAttr_(
+                h5file, dsPath, null ? 0 : attr[key + "_ghosts_y"].template to<std::size_t>(),
+                null);
+        if constexpr (dimension > 2)
+            this->writeGhostsAttr_(
+                h5file, dsPath, null ? 0 : attr[key + "_ghosts_z"].template to<std::size_t>(),
+                null);
+    };
+
+    auto initPatch = [&](auto& level, auto& attr, std::string patchID = "") {
+        bool null = patchID.empty();
+        std::string path{h5Writer.getPatchPathAddTimestamp(level, patchID)};
+        for (auto* sum : sums)
+            initDS(path, attr["time_average"], timeAverages.datasetName(*sum), null);
+    };
+
+    initDataSets_(patchIDs, patchAttributes, maxLevel, initPatch);
+}
+
+
+
+template<typename H5Writer>
+void TimeAverageDiagnosticWriter<H5Writer>::write(DiagnosticProperties& diagnostic)
+{
+    auto& h5Writer      = this->h5Writer_;
+    auto& h5file        = *fileData_.at(diagnostic.quantity);
+    auto& timeAverages  = h5Writer.modelView().getTimeAverages();
+    auto const qty      = quantity_(diagnostic);
+    auto const nSamples = timeAverages.nbrSamples(qty);
+
+    // the sums of the patch become its averages, and start over once written
+    for (auto* sum : timeAverages.sums(qty))
+    {
+        if (nSamples > 0)
+            for (auto& value : *sum)
+                value /= nSamples;
+
+        h5file.template write_data_set_flat<dimension>(
+            h5Writer.patchPath() + "/" + timeAverages.datasetName(*sum), sum->data());
+        sum->zero();
+    }
+}
+
+
+
+template<typename H5Writer>
+void TimeAverageDiagnosticWriter<H5Writer>::writeAttributes(
+    DiagnosticProperties& diagnostic, Attributes& fileAttributes,
+    std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>&
+        patchAttributes,
+    std::size_t maxLevel)
+{
+    auto& h5Writer   = this->h5Writer_;
+    auto& h5file     = *fileData_.at(diagnostic.quantity);
+    auto& nbrSamples = h5Writer.modelView().getTimeAverages().nbrSamples(quantity_(diagnostic));
+
+    h5Writer.writeAttribute(h5file, h5Writer.getTimestampPath(), "nbr_samples",
+                            std::size_t{nbrSamples});
+    nbrSamples = 0; // all patches are written
+
+    writeAttributes_(diagnostic, h5file, fileAttributes, patchAttributes, maxLevel);
+}
+
+
+} // namespace PHARE::diagnostic::h5
+
+#endif /* PHARE_DIAGNOSTIC_DETAIL_TYPES_TIME_AVERAGE_HPP */
@@ -0,0 +1,187 @@
+#ifndef PHARE_DIAGNOSTIC_DETAIL_TYPES_TRACER_HPP
+#define PHARE_DIAGNOSTIC_DETAIL_TYPES_TRACER_HPP
+
+#include "diagnostic/detail/h5typewriter.hpp"
+
+#include "core/utilities/mpi_utils.hpp"
+#include "core/data/particles/tracers.hpp"
+#include "core/data/particles/particle_utilities.hpp"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <numeric>
+#include <unordered_map>
+
+
+namespace PHARE::diagnostic::h5
+{
+/*
+ * Possible outputs
+ *
+ * /t#/id
+ * /t#/position
+ * /t#/v
+ * /t#/weight
+ *
+ * quantities are /ions/pop/<pop>/tracers, the domain particles of the population on one level
+ * that are tracers, see core::TracerSelection. Datasets are flat over all patches and ranks,
+ * each rank writing its slice, positions are physical. The level is a file attribute.
+ * Patches are not written. On refined levels, ids are shared by the particles split from a
+ * tracer.
+ */
+template<typename H5Writer>
+class TracerDiagnosticWriter : public H5TypeWriter<H5Writer>
+{
+public:
+    using Super = H5TypeWriter<H5Writer>;
+    using Super::fileData_;
+    using Super::h5Writer_;
+    using Attributes = typename Super::Attributes;
+    using GridLayout = typename H5Writer::GridLayout;
+
+    static constexpr auto dimension = GridLayout::dimension;
+
+    TracerDiagnosticWriter(H5Writer& h5Writer)
+        : Super{h5Writer}
+    {
+    }
+
+    void write(DiagnosticProperties&) override;
+    void compute(DiagnosticProperties&) override {}
+
+    void createFiles(DiagnosticProperties& diagnostic) override;
+
+    void getDataSetInfo(DiagnosticProperties&, std::size_t /*iLevel*/,
+                        std::string const& /*patchID*/, Attributes& /*patchAttributes*/) override
+    {
+    }
+
+    void initDataSets(DiagnosticProperties&,
+                      std::unordered_map<std::size_t, std::vector<std::string>> const&,
+                      Attributes&, std::size_t /*maxLevel*/) override
+    {
+    }
+
+    void writeAttributes(
+        DiagnosticProperties&, Attributes&,
+        std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>&,
+        std::size_t maxLevel) override;
+
+private:
+    struct Tracers
+    {
+        std::vector<std::uint64_t> id;
+        std::vector<double> position, v, weight;
+
+        NO_DISCARD std::size_t size() const { return id.size(); }
+
+        void clear()
+        {
+            id.clear();
+            position.clear();
+            v.clear();
+            weight.clear();
+        }
+    };
+
+    std::unordered_map<std::string, Tracers> tracers_;
+};
+
+
+
+template<typename H5Writer>
+void TracerDiagnosticWriter<H5Writer>::createFiles(DiagnosticProperties& diagnostic)
+{
+    for (auto const& pop : this->h5Writer_.modelView().getIons())
+    {
+        std::string const quantity{"/ions/pop/" + pop.name() + "/tracers"};
+        if (diagnostic.quantity == quantity and !fileData_.count(diagnostic.quantity))
+            fileData_.emplace(diagnostic.quantity, this->h5Writer_.makeFile(diagnostic));
+    }
+}
+
+
+
+template<typename H5Writer>
+void TracerDiagnosticWriter<H5Writer>::write(DiagnosticProperties& diagnostic)
+{
+    auto& h5Writer     = this->h5Writer_;
+    auto const& layout = h5Writer.patchLayout();
+
+    // domain particles of different levels overlap
+    if (static_cast<std::size_t>(layout.levelNumber()) != diagnostic.param<std::size_t>("level"))
+        return;
+
+    auto& tracers = tracers_[diagnostic.quantity];
+    for (auto const& pop : h5Writer.modelView().getIons())
+    {
+        if (diagnostic.quantity != "/ions/pop/" + pop.name() + "/tracers")
+            continue;
+
+        for (auto const& particle : pop.domainParticles())
+        {
+            if (particle.id == core::TracerSelection<dimension>::untraced)
+                continue;
+
+            auto const position = core::positionAsPoint(particle, layout);
+            tracers.id.push_back(particle.id);
+            tracers.position.insert(std::end(tracers.position), std::begin(position),
+                                    std::end(position));
+            tracers.v.insert(std::end(tracers.v), std::begin(particle.v), std::end(particle.v));
+            tracers.weight.push_back(particle.weight);
+        }
+    }
+}
+
+
+
+template<typename H5Writer>
+void TracerDiagnosticWriter<H5Writer>::writeAttributes(
+    DiagnosticProperties& diagnostic, Attributes& fileAttributes,
+    std::unordered_map<std::size_t, std::vector<std::pair<std::string, Attributes>>>&,
+    std::size_t /*maxLevel*/)
+{
+    auto& h5Writer = this->h5Writer_;
+    auto& h5file   = *fileData_.at(diagnostic.quantity);
+    auto& tracers  = tracers_[diagnostic.quantity];
+
+    // all ranks create the datasets, each writes its tracers after those of the lower ranks
+    auto const counts = core::mpi::collect(tracers.size());
+    auto const offset = std::accumulate(std::begin(counts),
+                                        std::begin(counts) + core::mpi::rank(), std::size_t{0});
+    auto const total  = std::accumulate(std::begin(counts), std::end(counts), std::size_t{0});
+
+    auto const path = h5Writer.getTimestampPath() + "/";
+    auto write      = [&](std::string const& key, auto const& data, std::size_t const width) {
+        using Type = typename std::decay_t<decltype(data)>::value_type;
+
+        std::vector<std::size_t> shape{total}, start{offset}, count{tracers.size()};
+        if (width > 1)
+        {
+            shape.push_back(width);
+            start.push_back(0);
+            count.push_back(width);
+        }
+
+        h5file.template create_data_set<Type>(path + key, shape);
+        if (tracers.size() > 0)
+            h5file.file().getDataSet(path + key).select(start, count).write_raw(data.data());
+    };
+    write("id", tracers.id, 1);
+    write("position", tracers.position, dimension);
+    write("v", tracers.v, 3);
+    write("weight", tracers.weight, 1);
+    tracers.clear();
+
+    h5Writer.writeAttribute(h5file, "/", "level", diagnostic.param<std::size_t>("level"));
+
+    if (diagnostic.nAttributes > 0)
+        h5Writer.writeAttributeDict(h5file, diagnostic.fileAttributes, "/py_attrs");
+    h5Writer.writeGlobalAttributeDict(h5file, fileAttributes, "/");
+}
+
+
+} // namespace PHARE::diagnostic::h5
+
+#endif /* PHARE_DIAGNOSTIC_DETAIL_TYPES_TRACER_HPP */
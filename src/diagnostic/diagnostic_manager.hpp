@@ -20,7 +20,9 @@ enum class Mode { LIGHT, FULL };
 template<typename DiagManager>
 void registerDiagnostics(DiagManager& dMan, initializer::PHAREDict const& diagsParams)
 {
-    std::vector<std::string> const diagTypes = {"fluid", "electromag", "particle", "meta", "info"};
+    std::vector<std::string> const diagTypes
+        = {"fluid",       "electromag",   "particle",     "meta",  "info",
+           "performance", "time_average", "distribution", "tracer"};
 
     for (auto& diagType : diagTypes)
     {
@@ -143,6 +145,18 @@ DiagnosticsManager<Writer>::addDiagDict(initializer::PHAREDict const& diagParams
     diagProps.computeTimestamps
         = diagParams["compute_timestamps"].template to<std::vector<double>>();
 
+    if (diagProps.type == "distribution")
+    {
+        diagProps["axes"]   = diagParams["axes"].template to<std::string>();
+        diagProps["bins"]   = diagParams["bins"].template to<std::vector<int>>();
+        diagProps["ranges"] = diagParams["ranges"].template to<std::vector<double>>();
+        diagProps["boxes"]  = diagParams["boxes"].template to<std::vector<double>>();
+        diagProps["level"]  = diagParams["level"].template to<std::size_t>();
+    }
+
+    if (diagProps.type == "tracer")
+        diagProps["level"] = diagParams["level"].template to<std::size_t>();
+
     diagProps.nAttributes = diagParams["n_attributes"].template to<std::size_t>();
     for (std::size_t i = 0; i < diagProps.nAttributes; ++i)
     {
@@ -161,8 +175,11 @@ void DiagnosticsManager<Writer>::dump_level(std::size_t level, double timeStamp)
 {
     std::vector<DiagnosticProperties*> activeDiagnostics;
 
+    // time averages, distributions and tracers are written for all levels at once, as writing
+    // them starts the next average, histogram or gathering of tracers
     for (auto& diag : diagnostics_)
-        activeDiagnostics.emplace_back(&diag);
+        if (diag.type != "time_average" and diag.type != "distribution" and diag.type != "tracer")
+            activeDiagnostics.emplace_back(&diag);
 
     writer_->dump_level(level, activeDiagnostics, timeStamp);
 }
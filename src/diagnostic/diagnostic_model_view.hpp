@@ -53,6 +53,10 @@ public:
 
     NO_DISCARD auto& getIons() const { return model_.state.ions; }
 
+    NO_DISCARD auto& getElectromag() const { return model_.state.electromag; }
+
+    NO_DISCARD auto& getTimeAverages() const { return model_.timeAverages; }
+
 
     template<typename Action>
     void visitHierarchy(Action&& action, int minLevel = 0, int maxLevel = 0)
@@ -108,6 +112,9 @@ public:
         return model_.tags.at(key);
     }
 
+    // seconds spent pushing the particles of a patch since last read, per level and patch id
+    NO_DISCARD auto& getPatchTimes() const { return model_.patchTimes; }
+
 
 protected:
     Model& model_;
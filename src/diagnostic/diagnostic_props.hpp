@@ -13,7 +13,8 @@ namespace PHARE::diagnostic
 struct DiagnosticProperties
 {
     // Types limited to actual need, no harm to modify
-    using Params         = cppdict::Dict<std::size_t>;
+    using Params
+        = cppdict::Dict<std::size_t, std::string, std::vector<int>, std::vector<double>>;
     using FileAttributes = cppdict::Dict<std::string>;
 
     std::vector<double> writeTimestamps, computeTimestamps;
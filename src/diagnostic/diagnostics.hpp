@@ -30,6 +30,10 @@
 #include "diagnostic/detail/types/fluid.hpp"
 #include "diagnostic/detail/types/meta.hpp"
 #include "diagnostic/detail/types/info.hpp"
+#include "diagnostic/detail/types/performance.hpp"
+#include "diagnostic/detail/types/time_average.hpp"
+#include "diagnostic/detail/types/distribution.hpp"
+#include "diagnostic/detail/types/tracer.hpp"
 
 #endif
 
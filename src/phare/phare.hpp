@@ -3,6 +3,7 @@
 #define PHARE_PHARE_INCLUDE_HPP
 
 #include "core/def/phlop.hpp" // scope timing
+#include "core/utilities/logger/scope_profiler.hpp"
 
 #include "simulator/simulator.hpp"
 #include "core/utilities/algorithm.hpp"
@@ -46,10 +47,23 @@ public:
                     .file_name(".phare/timings/rank." + std::to_string(core::mpi::rank()) + ".txt")
                     .init(); //
         )
+
+        // otherwise PHARE_LOG_SCOPE uses the native profiler, "dump" also reports on dumps
+        if constexpr (!PHARE_HAVE_PHLOP)
+            if (auto e = core::get_env("PHARE_SCOPE_TIMING", "false");
+                e == "1" || e == "true" || e == "dump")
+                core::profiler::Profiler::INSTANCE().enable(e == "dump");
+
+        // scopes of each rank as Chrome trace events, see tools/python3/merge_traces.py
+        if constexpr (!PHARE_HAVE_PHLOP)
+            if (auto e = core::get_env("PHARE_SCOPE_TRACE", "false"); e == "1" || e == "true")
+                core::profiler::Profiler::INSTANCE().trace();
     }
 
     ~SamraiLifeCycle()
     {
+        core::profiler::Profiler::INSTANCE().report("end of run");
+        core::profiler::Profiler::INSTANCE().closeTrace();
         PHARE_WITH_PHLOP(phlop::ScopeTimerMan::reset());
         SAMRAI::tbox::SAMRAIManager::shutdown();
         SAMRAI::tbox::SAMRAIManager::finalize();
@@ -58,6 +72,7 @@ public:
 
     static void reset()
     {
+        core::profiler::Profiler::INSTANCE().report("reset");
         PHARE_WITH_PHLOP(phlop::ScopeTimerMan::reset());
         PHARE::initializer::PHAREDictHandler::INSTANCE().stop();
         SAMRAI::tbox::SAMRAIManager::shutdown();
@@ -56,12 +56,64 @@ void declareDim(py::module& m)
         .def_readwrite("weight", &CP::weight)
         .def_readwrite("charge", &CP::charge)
         .def_readwrite("v", &CP::v)
+        .def_readwrite("id", &CP::id)
         .def("size", &CP::size);
 
     name = "PatchData" + name;
     declarePatchData<CP, dim>(m, name.c_str());
 }
 
+// {"levels": [{kind: {"used": {"min", "max", "sum"}, "reserved": ..., "peak_reserved": ...}}],
+//  "total": {"used": ..., "reserved": ...}, "peak_rss": {"min", "max", "sum"}, "nbr_ranks"}
+inline py::dict memory_report_dict(core::MemoryReport::Stats const& current,
+                                   core::MemoryReport::Stats const& peak)
+{
+    auto const stats = [](std::size_t const min, std::size_t const max, std::size_t const sum) {
+        py::dict dict;
+        dict["min"] = min;
+        dict["max"] = max;
+        dict["sum"] = sum;
+        return dict;
+    };
+
+    py::list levels;
+    for (std::size_t iLevel = 0; iLevel < current.sum.levels().size(); ++iLevel)
+    {
+        auto const& min     = current.min.levels()[iLevel];
+        auto const& max     = current.max.levels()[iLevel];
+        auto const& sum     = current.sum.levels()[iLevel];
+        auto const& peakMin = peak.min.levels()[iLevel];
+        auto const& peakMax = peak.max.levels()[iLevel];
+        auto const& peakSum = peak.sum.levels()[iLevel];
+
+        py::dict level;
+        for (std::size_t iKind = 0; iKind < core::nbrMemoryKinds; ++iKind)
+        {
+            auto const kind = static_cast<core::MemoryKind>(iKind);
+            py::dict usage;
+            usage["used"]     = stats(min[kind].used, max[kind].used, sum[kind].used);
+            usage["reserved"] = stats(min[kind].reserved, max[kind].reserved, sum[kind].reserved);
+            usage["peak_reserved"]
+                = stats(peakMin[kind].reserved, peakMax[kind].reserved, peakSum[kind].reserved);
+            level[core::memoryKindNames[iKind]] = usage;
+        }
+        levels.append(level);
+    }
+
+    auto const& [totalMin, totalMax, totalSum] = current.total;
+    py::dict total;
+    total["used"]     = stats(totalMin.used, totalMax.used, totalSum.used);
+    total["reserved"] = stats(totalMin.reserved, totalMax.reserved, totalSum.reserved);
+
+    auto const& [rssMin, rssMax, rssSum] = current.peakRSS;
+    py::dict report;
+    report["levels"]    = levels;
+    report["total"]     = total;
+    report["peak_rss"]  = stats(rssMin, rssMax, rssSum);
+    report["nbr_ranks"] = current.nbrRanks;
+    return report;
+}
+
 template<typename Simulator, typename PyClass>
 void declareSimulator(PyClass&& sim)
 {
@@ -74,7 +126,13 @@ void declareSimulator(PyClass&& sim)
         .def("to_str", &Simulator::to_str)
         .def("domain_box", &Simulator::domainBox)
         .def("cell_width", &Simulator::cellWidth)
-        .def("dump", &Simulator::dump, py::arg("timestamp"), py::arg("timestep"));
+        .def("dump", &Simulator::dump, py::arg("timestamp"), py::arg("timestep"))
+        .def("memory_report",
+             [](Simulator& self) {
+                 auto const [current, peak] = self.memoryReport();
+                 return memory_report_dict(current, peak);
+             })
+        .def("nbr_particles", &Simulator::nbrParticles);
 }
 
 template<typename _dim, typename _interp, typename _nbRefinedPart>
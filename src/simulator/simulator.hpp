@@ -12,6 +12,8 @@
 #include "core/utilities/types.hpp"
 #include "core/utilities/mpi_utils.hpp"
 #include "core/utilities/timestamps.hpp"
+#include "core/utilities/memory_usage.hpp"
+#include "core/utilities/logger/scope_profiler.hpp"
 #include "amr/tagging/tagger_factory.hpp"
 #include "amr/load_balancing/load_balancer_details.hpp"
 #include "amr/load_balancing/load_balancer_manager.hpp"
@@ -66,6 +68,9 @@ public:
 
     bool dump(double timestamp, double timestep) override
     {
+        if (auto& profiler = core::profiler::Profiler::INSTANCE(); profiler.reportsOnDump())
+            profiler.report("dump at time " + std::to_string(timestamp));
+
         if (rMan)
         {
             rMan->dump(timestamp, timestep);
@@ -79,6 +84,33 @@ public:
         return false;
     }
 
+    /** collective over MPI_COMM_WORLD, the bytes used and reserved per level and kind of data
+     * reduced over ranks, then the high watermark of each entry over the reports made so far
+     */
+    NO_DISCARD std::pair<core::MemoryReport::Stats, core::MemoryReport::Stats> memoryReport()
+    {
+        auto const report = multiphysInteg_->accountMemory(*hierarchy_);
+        memoryPeak_.keep_max(report);
+        return {report.reduce(), memoryPeak_.reduce()};
+    }
+
+    /** collective over MPI_COMM_WORLD, the number of domain particles of all populations on
+     * each level, summed over ranks
+     */
+    NO_DISCARD std::vector<std::size_t> nbrParticles()
+    {
+        auto& ions = hybridModel_->state.ions;
+        std::vector<std::size_t> counts(hierarchy_->getNumberOfLevels(), 0);
+        for (int iLevel = 0; iLevel < hierarchy_->getNumberOfLevels(); ++iLevel)
+            for (auto& patch : *hierarchy_->getPatchLevel(iLevel))
+            {
+                auto _ = hybridModel_->resourcesManager->setOnPatch(*patch, ions);
+                for (auto const& pop : ions)
+                    counts[iLevel] += pop.domainParticles().size();
+            }
+        return core::mpi::min_max_sum(counts)[2];
+    }
+
     Simulator(PHARE::initializer::PHAREDict const& dict,
               std::shared_ptr<PHARE::amr::Hierarchy> const& hierarchy);
     ~Simulator()
@@ -161,6 +193,11 @@ private:
     bool isInitialized         = false;
     std::size_t fineDumpLvlMax = 0;
 
+    // memory is reported every memoryReportEvery_ advances if > 0, see memoryReport()
+    std::size_t memoryReportEvery_ = 0;
+    std::size_t nbrAdvances_       = 0;
+    core::MemoryReport memoryPeak_;
+
     // physical models that can be used
     std::shared_ptr<HybridModel> hybridModel_;
     std::shared_ptr<MHDModel> mhdModel_;
@@ -258,6 +295,7 @@ void Simulator<dim, _interp, nbRefinedPart>::hybrid_init(initializer::PHAREDict
 
 
     hybridModel_->resourcesManager->registerResources(hybridModel_->state);
+    hybridModel_->resourcesManager->registerResources(hybridModel_->timeAverages);
 
     // we register the hybrid model for all possible levels in the hierarchy
     // since for now it is the only model available, same for the solver
@@ -336,6 +374,8 @@ Simulator<_dimension, _interp_order, _nbRefinedPart>::Simulator(
     , dt_{dict["simulation"]["time_step"].template to<double>()}
     , timeStepNbr_{dict["simulation"]["time_step_nbr"].template to<int>()}
     , finalTime_{dt_ * timeStepNbr_}
+    , memoryReportEvery_{static_cast<std::size_t>(
+          cppdict::get_value(dict, "simulation/memory_report/every", 0))}
     , functors_{functors_setup(dict)}
     , multiphysInteg_{std::make_shared<MultiPhysicsIntegrator>(dict["simulation"], functors_)}
 {
@@ -375,7 +415,12 @@ void Simulator<_dimension, _interp_order, _nbRefinedPart>::initialize()
             std::runtime_error("cannot initialize  - simulator already isInitialized");
 
         if (integrator_ != nullptr)
+        {
+            if (integrator_->partitionsRootLevelBeforeLoading())
+                multiphysInteg_->partitionRootLevelBeforeLoading();
+
             integrator_->initialize();
+        }
         else
             throw std::runtime_error("Error - Simulator has no integrator");
     }
@@ -436,6 +481,14 @@ double Simulator<_dimension, _interp_order, _nbRefinedPart>::advance(double dt)
         throw std::runtime_error("forcing error");
     }
 
+    if (memoryReportEvery_ > 0 and ++nbrAdvances_ % memoryReportEvery_ == 0)
+    {
+        auto const [current, peak] = memoryReport();
+        core::write(current, peak,
+                    "advance " + std::to_string(nbrAdvances_) + " at time "
+                        + std::to_string(currentTime_));
+    }
+
     return dt_new;
 }
 
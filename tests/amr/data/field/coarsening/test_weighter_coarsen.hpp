@@ -4,6 +4,7 @@
 #include <numeric>
 
 #include "amr/data/field/coarsening/field_coarsen_index_weight.hpp"
+#include "amr/data/field/coarsening/field_coarsen_stencil.hpp"
 #include "core/data/grid/gridlayout.hpp"
 #include "core/data/grid/gridlayout_impl.hpp"
 
@@ -52,4 +53,27 @@ INSTANTIATE_TEST_SUITE_P(TestWithMultipleWeightPointsThat, AWeighter,
                                             createWeighter(8), createWeighter(9),
                                             createWeighter(10), createWeighter(11)}));
 
+
+
+TEST(FieldCoarsenStencil, givesSameStartIndexesAndWeightsAsRatio2Coarsening)
+{
+    SAMRAI::hier::IntVector ratio{SAMRAI::tbox::Dimension{1}, 2};
+
+    auto check = [&](QtyCentering centering, auto const& stencilWeights) {
+        FieldCoarsenIndexesAndWeights<1> indexesAndWeights{{{centering}}, ratio};
+        auto const& weights = indexesAndWeights.weights(Direction::X);
+
+        ASSERT_EQ(weights.size(), stencilWeights.size());
+        for (std::size_t i = 0; i < weights.size(); ++i)
+            EXPECT_DOUBLE_EQ(weights[i], stencilWeights[i]);
+
+        for (int coarseIndex = -3; coarseIndex < 4; ++coarseIndex)
+            EXPECT_EQ(indexesAndWeights.computeStartIndexes(Point<int, 1>{coarseIndex})[dirX],
+                      FieldCoarsenStencil::fineStartIndex(centering, coarseIndex));
+    };
+
+    check(QtyCentering::primal, FieldCoarsenStencil::primalWeights);
+    check(QtyCentering::dual, FieldCoarsenStencil::dualWeights);
+}
+
 #endif
@@ -11,6 +11,7 @@
 #include "amr/data/field/refine/field_linear_refine.hpp"
 #include "amr/data/field/refine/field_refine_operator.hpp"
 #include "amr/data/field/refine/field_refiner.hpp"
+#include "amr/data/field/refine/field_refine_stencil.hpp"
 #include "core/data/grid/gridlayout.hpp"
 
 #include "test_field_refinement_on_hierarchy.hpp"
@@ -382,6 +383,30 @@ TYPED_TEST(aFieldLinearRefineIndexesAndWeights, giveACorrectWeightIndexesForDual
 
 
 
+TEST(FieldRefineStencil, givesSameStartIndexesAndWeightsAsRatio2LinearRefine)
+{
+    for (auto const centering : {QtyCentering::primal, QtyCentering::dual})
+    {
+        SAMRAI::hier::IntVector ratio{SAMRAI::tbox::Dimension{1}, 2};
+        FieldRefineIndexesAndWeights<1> indexesAndWeights{{{centering}}, ratio};
+        auto const& weights = indexesAndWeights.weights(Direction::X);
+
+        for (int fineIndex = -5; fineIndex < 6; ++fineIndex)
+        {
+            Point<int, 1> fine{fineIndex};
+            EXPECT_EQ(indexesAndWeights.coarseStartIndex(fine)[dirX],
+                      FieldRefineStencil::coarseStartIndex(centering, fineIndex));
+
+            auto const& expected = weights[indexesAndWeights.computeWeightIndex(fine)[dirX]];
+            auto const& actual   = FieldRefineStencil::weights(centering, fineIndex);
+            EXPECT_DOUBLE_EQ(expected[0], actual[0]);
+            EXPECT_DOUBLE_EQ(expected[1], actual[1]);
+        }
+    }
+}
+
+
+
 
 int main(int argc, char** argv)
 {
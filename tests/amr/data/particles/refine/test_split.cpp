@@ -3,11 +3,16 @@
 #include "core/def/phare_mpi.hpp"
 
 #include "core/utilities/types.hpp"
+#include "core/data/particles/particle.hpp"
 #include "amr/data/particles/refine/split.hpp"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
 
 namespace
 {
@@ -22,7 +27,8 @@ struct SplitterTest : public ::testing::Test
     SplitterTest() { Splitter splitter; }
 };
 
-using Splitters = testing::Types<Splitter<1, 1, 2>, Splitter<2, 1, 8> /*, Splitter<3, 1, 27>*/>;
+using Splitters = testing::Types<Splitter<1, 1, 2>, Splitter<2, 1, 8>, Splitter<3, 1, 6>,
+                                 Splitter<3, 1, 27>, Splitter<3, 2, 12>, Splitter<3, 3, 8>>;
 
 TYPED_TEST_SUITE(SplitterTest, Splitters);
 
@@ -31,4 +37,124 @@ TYPED_TEST(SplitterTest, constexpr_init)
     constexpr TypeParam param{};
 }
 
+TYPED_TEST(SplitterTest, childrenWeightsSumToTheCoarseWeightTimesTheRefinedCellsPerCell)
+{
+    constexpr auto dim           = TypeParam::dimension;
+    constexpr auto nbRefinedPart = TypeParam::nbRefinedPart;
+    using Particle_t             = PHARE::core::Particle<dim>;
+
+    TypeParam splitter;
+
+    Particle_t particle;
+    particle.weight = 1;
+    particle.charge = 1;
+    for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        particle.delta[iDim] = .5;
+
+    std::array<Particle_t, nbRefinedPart> children;
+    splitter(particle, children);
+
+    double weight = 0;
+    for (auto const& child : children)
+        weight += child.weight;
+
+    EXPECT_NEAR(weight, std::pow(PHARE::amr::refinementRatio, dim), 1e-5);
+}
+
+TYPED_TEST(SplitterTest, splitBatchGivesSameChildrenAsParticleSplit)
+{
+    constexpr auto dim           = TypeParam::dimension;
+    constexpr auto nbRefinedPart = TypeParam::nbRefinedPart;
+    using Particle_t             = PHARE::core::Particle<dim>;
+
+    TypeParam splitter;
+
+    std::vector<Particle_t> coarseParticles;
+    for (auto const delta : {0., .01, .25, .5, .75, .99})
+    {
+        auto& particle  = coarseParticles.emplace_back();
+        particle.weight = 1;
+        particle.charge = 1;
+        particle.v      = {1, 2, 3};
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        {
+            particle.iCell[iDim] = -3 + static_cast<int>(iDim);
+            particle.delta[iDim] = delta;
+        }
+    }
+
+    std::vector<Particle_t> batch;
+    splitter.splitBatch(coarseParticles, batch);
+    ASSERT_EQ(batch.size(), coarseParticles.size() * nbRefinedPart);
+
+    for (std::size_t iPart = 0; iPart < coarseParticles.size(); ++iPart)
+    {
+        std::array<Particle_t, nbRefinedPart> children;
+        splitter(coarseParticles[iPart], children);
+
+        for (std::size_t iChild = 0; iChild < nbRefinedPart; ++iChild)
+        {
+            auto const& child = batch[iPart * nbRefinedPart + iChild];
+            EXPECT_EQ(child, children[iChild]);
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            {
+                EXPECT_GE(child.delta[iDim], 0);
+                EXPECT_LT(child.delta[iDim], 1);
+                auto const position = coarseParticles[iPart].iCell[iDim]
+                                      + coarseParticles[iPart].delta[iDim];
+                auto const childPosition = child.iCell[iDim] + child.delta[iDim];
+                EXPECT_LE(std::abs(childPosition - position),
+                          TypeParam::maxCellDistanceFromSplit() + 1);
+            }
+        }
+    }
+}
+
+
+template<std::size_t interpOrder>
+void expect27IsTheTensorProductOf1D3()
+{
+    using Particle1D = PHARE::core::Particle<1>;
+    using Particle3D = PHARE::core::Particle<3>;
+
+    Particle1D particle1D;
+    particle1D.weight = 1;
+    particle1D.delta  = {.3};
+
+    Particle3D particle3D;
+    particle3D.weight = 1;
+    particle3D.delta  = {.3, .3, .3};
+
+    std::array<Particle1D, 3> children1D;
+    std::array<Particle3D, 27> children3D;
+    Splitter<1, interpOrder, 3>{}(particle1D, children1D);
+    Splitter<3, interpOrder, 27>{}(particle3D, children3D);
+
+    // each 3D child is a triplet of 1D children, one per direction, with the product of their
+    // weights, and each triplet is one 3D child
+    auto isTriplet = [&](auto const& child, auto const& ix, auto const& iy, auto const& iz) {
+        std::array<Particle1D const*, 3> const triplet{&ix, &iy, &iz};
+        for (std::size_t iDim = 0; iDim < 3; ++iDim)
+            if (child.iCell[iDim] != triplet[iDim]->iCell[0]
+                or std::abs(child.delta[iDim] - triplet[iDim]->delta[0]) > 1e-6)
+                return false;
+        return std::abs(child.weight - ix.weight * iy.weight * iz.weight) < 1e-6;
+    };
+
+    for (auto const& ix : children1D)
+        for (auto const& iy : children1D)
+            for (auto const& iz : children1D)
+                EXPECT_EQ(1, std::count_if(std::begin(children3D), std::end(children3D),
+                                           [&](auto const& child) {
+                                               return isTriplet(child, ix, iy, iz);
+                                           }));
+}
+
+TEST(Splitter3D, pattern27IsTheTensorProductOfThe1DPatternOf3)
+{
+    expect27IsTheTensorProductOf1D3<1>();
+    expect27IsTheTensorProductOf1D3<2>();
+    expect27IsTheTensorProductOf1D3<3>();
+}
+
 } // namespace
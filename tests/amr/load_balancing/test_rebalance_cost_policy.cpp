@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+
+#include "amr/load_balancing/rebalance_cost_policy.hpp"
+
+#include <sstream>
+
+using namespace PHARE::amr;
+
+
+
+TEST(RebalanceCostPolicy, keepsABalancedPartition)
+{
+    RebalanceCostPolicy policy{100, 1e9, 64};
+
+    auto const decision = policy(4e6, 1e6, 4, 1.);
+
+    EXPECT_DOUBLE_EQ(decision.imbalance, 1.);
+    EXPECT_DOUBLE_EQ(decision.migrationBytes, 0.);
+    EXPECT_DOUBLE_EQ(decision.timeSaved, 0.);
+    EXPECT_FALSE(decision.rebalance);
+}
+
+
+
+TEST(RebalanceCostPolicy, rebalancesWhenTheTimeSavedExceedsTheMigrationCost)
+{
+    // mean load is 1e6, the most loaded rank sends 1e6 units of 64 bytes
+    RebalanceCostPolicy policy{100, 1e9, 64};
+
+    auto const decision = policy(4e6, 2e6, 4, .1);
+
+    EXPECT_DOUBLE_EQ(decision.imbalance, 2.);
+    EXPECT_DOUBLE_EQ(decision.migrationBytes, 64e6);
+    EXPECT_DOUBLE_EQ(decision.timeSaved, 100 * .1 * .5);
+    EXPECT_DOUBLE_EQ(decision.migrationCost, .064);
+    EXPECT_TRUE(decision.rebalance);
+}
+
+
+
+TEST(RebalanceCostPolicy, keepsThePartitionWhenMigratingCostsMoreThanItSaves)
+{
+    RebalanceCostPolicy policy{100, 1e9, 64};
+
+    // a short horizon does not pay for the migration
+    policy.horizon = 1;
+    EXPECT_FALSE(policy(4e6, 2e6, 4, .1).rebalance);
+
+    // neither does the overhead of the previous rebalance
+    policy.horizon  = 100;
+    policy.overhead = 10;
+    EXPECT_FALSE(policy(4e6, 2e6, 4, .1).rebalance);
+}
+
+
+
+TEST(RebalanceCostPolicy, needsSeveralRanksAndAMeasuredStep)
+{
+    RebalanceCostPolicy policy{100, 1e9, 64};
+
+    EXPECT_FALSE(policy(2e6, 2e6, 1, .1).rebalance);
+    EXPECT_FALSE(policy(4e6, 2e6, 4, 0.).rebalance);
+}
+
+
+
+TEST(RebalanceCostPolicy, logsItsDecision)
+{
+    RebalanceCostPolicy policy{100, 1e9, 64};
+
+    std::stringstream log;
+    log << policy(4e6, 2e6, 4, .1);
+
+    EXPECT_NE(log.str().find("rebalance"), std::string::npos);
+}
+
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -8,6 +8,7 @@
 #include "core/models/hybrid_state.hpp"
 #include "core/data/vecfield/vecfield.hpp"
 #include "core/data/tensorfield/tensorfield.hpp"
+#include "amr/resources_manager/amr_utils.hpp"
 
 
 #include <string>
@@ -243,6 +244,45 @@ TEST(usingResourcesManager, toGetTimeOfAResourcesUser)
 
 
 
+TEST(usingResourcesManager, toMoveOnlyTheGivenPatchDataOfUnchangedPatches)
+{
+    ResourcesManager<GridLayout<GridLayoutImplYee<1, 1>>, Grid1D> resourcesManager;
+    IonPopulation1D_P pop;
+    VecField1D_P B;
+
+    // both hierarchies have a single patch with the same box
+    auto oldHierarchy = std::make_unique<BasicHierarchy>(inputBase + "/input/input_db_1d");
+    auto newHierarchy = std::make_unique<BasicHierarchy>(inputBase + "/input/input_db_1d");
+    oldHierarchy->init();
+    newHierarchy->init();
+    resourcesManager.registerResources(pop.user);
+    resourcesManager.registerResources(B.user);
+
+    auto& oldLevel = *oldHierarchy->hierarchy->getPatchLevel(0);
+    auto& newLevel = *newHierarchy->hierarchy->getPatchLevel(0);
+    for (auto* level : {&oldLevel, &newLevel})
+        for (auto& patch : *level)
+        {
+            resourcesManager.allocate(pop.user, *patch, 0.);
+            resourcesManager.allocate(B.user, *patch, 0.);
+        }
+
+    auto const popIDs         = resourcesManager.getIDs(pop.user);
+    auto const bIDs           = resourcesManager.getIDs(B.user);
+    auto const unchangedBoxes = moveUnchangedPatchData(newLevel, oldLevel, popIDs);
+    EXPECT_EQ(1, unchangedBoxes.size());
+
+    auto& oldPatch = **oldLevel.begin();
+    auto& newPatch = **newLevel.begin();
+    for (auto const id : popIDs)
+        EXPECT_EQ(oldPatch.getPatchData(id), newPatch.getPatchData(id));
+    for (auto const id : bIDs)
+        EXPECT_NE(oldPatch.getPatchData(id), newPatch.getPatchData(id));
+}
+
+
+
+
 REGISTER_TYPED_TEST_SUITE_P(aResourceUserCollection, hasPointersValidOnlyWithGuard);
 
 
@@ -5,6 +5,8 @@
 #include "phare/phare.hpp"
 #include "amr/tagging/tagger.hpp"
 #include "amr/tagging/tagger_factory.hpp"
+#include "amr/tagging/tagging_criteria.hpp"
+#include "amr/tagging/default_hybrid_tagger_strategy.hpp"
 #include "amr/resources_manager/resources_manager.hpp"
 
 #include "core/data/ndarray/ndarray_vector.hpp"
@@ -245,6 +247,215 @@ TYPED_TEST(TestTagger, scaledAvg)
 
 
 
+TEST(TaggingKernel, gradientIsTheMaxOverDirectionsAndFields)
+{
+    auto constexpr dim = 2;
+    std::array<std::uint32_t, dim> const start{2, 2};
+    std::array<std::uint32_t, dim> const nbrCells{5, 7};
+
+    auto field = [](double const kx, double const ky) {
+        PHARE::core::NdArrayVector<dim> F{12u, 13u};
+        for (auto ix = 0u; ix < F.shape()[0]; ++ix)
+            for (auto iy = 0u; iy < F.shape()[1]; ++iy)
+                F(ix, iy) = std::sin(kx * ix) * std::cos(ky * iy);
+        return F;
+    };
+    auto const F1 = field(0.3, 1.1);
+    auto const F2 = field(0.9, 0.2);
+
+    TaggingKernel<dim> kernel{start, nbrCells};
+    kernel.gradient(F1);
+    kernel.gradient(F2);
+
+    auto criterion = [](auto const& F, auto ix, auto iy) {
+        auto const critx
+            = std::abs(F(ix + 2, iy) - F(ix, iy)) / (1 + std::abs(F(ix + 1, iy) - F(ix, iy)));
+        auto const crity
+            = std::abs(F(ix, iy + 2) - F(ix, iy)) / (1 + std::abs(F(ix, iy + 1) - F(ix, iy)));
+        return std::max(critx, crity);
+    };
+
+    std::size_t iCell = 0;
+    for (auto ix = start[0]; ix < start[0] + nbrCells[0]; ++ix)
+        for (auto iy = start[1]; iy < start[1] + nbrCells[1]; ++iy)
+        {
+            auto const expected = std::max(criterion(F1, ix, iy), criterion(F2, ix, iy));
+            EXPECT_DOUBLE_EQ(expected, kernel[iCell++]);
+        }
+}
+
+
+TEST(TaggingKernel, gradientIn3DIsTheMaxOverDirections)
+{
+    auto constexpr dim = 3;
+    std::array<std::uint32_t, dim> const start{2, 2, 2};
+    std::array<std::uint32_t, dim> const nbrCells{4, 5, 6};
+
+    PHARE::core::NdArrayVector<dim> F{9u, 10u, 11u};
+    for (auto ix = 0u; ix < F.shape()[0]; ++ix)
+        for (auto iy = 0u; iy < F.shape()[1]; ++iy)
+            for (auto iz = 0u; iz < F.shape()[2]; ++iz)
+                F(ix, iy, iz) = std::sin(0.3 * ix) * std::cos(1.1 * iy) * std::sin(0.7 * iz + 1.);
+
+    TaggingKernel<dim> kernel{start, nbrCells};
+    kernel.gradient(F);
+
+    auto criterion = [&](auto ix, auto iy, auto iz) {
+        auto const f     = F(ix, iy, iz);
+        auto const critx = std::abs(F(ix + 2, iy, iz) - f) / (1 + std::abs(F(ix + 1, iy, iz) - f));
+        auto const crity = std::abs(F(ix, iy + 2, iz) - f) / (1 + std::abs(F(ix, iy + 1, iz) - f));
+        auto const critz = std::abs(F(ix, iy, iz + 2) - f) / (1 + std::abs(F(ix, iy, iz + 1) - f));
+        return std::max({critx, crity, critz});
+    };
+
+    std::size_t iCell = 0;
+    for (auto ix = start[0]; ix < start[0] + nbrCells[0]; ++ix)
+        for (auto iy = start[1]; iy < start[1] + nbrCells[1]; ++iy)
+            for (auto iz = start[2]; iz < start[2] + nbrCells[2]; ++iz)
+                EXPECT_DOUBLE_EQ(criterion(ix, iy, iz), kernel[iCell++]);
+}
+
+
+
+// the quantities DefaultHybridTaggerStrategy reads, on a single 3D patch
+struct TaggedModel3D
+{
+    static auto constexpr dimension = 3;
+    using gridlayout_type           = GridLayout<GridLayoutImplYee<dimension, 1>>;
+    using Field                     = PHARE::core::NdArrayVector<dimension>;
+
+    struct VecField
+    {
+        std::array<Field, 3> components;
+        auto& getComponent(PHARE::core::Component c) { return components[static_cast<int>(c)]; }
+    };
+
+    struct Ions
+    {
+        Field rho;
+        auto& density() { return rho; }
+    };
+
+    struct Electromag
+    {
+        VecField B;
+    };
+
+    struct State
+    {
+        Electromag electromag;
+        VecField J;
+        Ions ions;
+    };
+
+    TaggedModel3D(std::array<std::uint32_t, dimension> const& shape)
+        : state{Electromag{vecfield_(shape)}, vecfield_(shape), Ions{Field{shape}}}
+    {
+    }
+
+    State state;
+
+private:
+    static VecField vecfield_(std::array<std::uint32_t, dimension> const& shape)
+    {
+        return VecField{{Field{shape}, Field{shape}, Field{shape}}};
+    }
+};
+
+
+struct DefaultTagging3D : public ::testing::Test
+{
+    using GridLayoutT = TaggedModel3D::gridlayout_type;
+
+    GridLayoutT layout{{0.1, 0.1, 0.1}, {4u, 5u, 6u}, {0., 0., 0.}};
+    std::uint32_t start = layout.physicalStartIndex(PHARE::core::QtyCentering::dual,
+                                                    PHARE::core::Direction::X);
+    TaggedModel3D model{{4u + 2 * start + 3, 5u + 2 * start + 3, 6u + 2 * start + 3}};
+
+    // tags buffer of the patch, SAMRAI uses the FORTRAN ordering
+    std::vector<int> tags = std::vector<int>(4 * 5 * 6, 0);
+
+    DefaultHybridTaggerStrategy<TaggedModel3D> strategy = [] {
+        PHARE::initializer::PHAREDict dict;
+        dict["threshold"]  = 0.5;
+        dict["hysteresis"] = 0.5;
+        dict["criteria"]   = std::string{"current"};
+        return DefaultHybridTaggerStrategy<TaggedModel3D>{dict};
+    }();
+
+    int& tag(std::uint32_t ix, std::uint32_t iy, std::uint32_t iz)
+    {
+        return tags[ix + 4 * (iy + 5 * iz)];
+    }
+
+    void setJx(std::uint32_t ix, std::uint32_t iy, std::uint32_t iz, double const value)
+    {
+        auto& Jx = model.state.J.getComponent(PHARE::core::Component::X);
+        Jx(start + ix, start + iy, start + iz) = value;
+    }
+};
+
+
+TEST_F(DefaultTagging3D, tagsTheCellsAboveTheThreshold)
+{
+    setJx(1, 3, 4, 0.6);
+    setJx(3, 0, 5, 0.6);
+    strategy.tag(model, layout, tags.data());
+
+    EXPECT_EQ(1, tag(1, 3, 4));
+    EXPECT_EQ(1, tag(3, 0, 5));
+    EXPECT_EQ(2, std::count(std::begin(tags), std::end(tags), 1));
+}
+
+
+TEST_F(DefaultTagging3D, keepsTaggedCellsTaggedDownToTheUntagThreshold)
+{
+    // untag threshold is 0.5 * (1 - 0.5), criteria between 0.25 and 0.5 keep the previous tags
+    auto& Jx = model.state.J.getComponent(PHARE::core::Component::X);
+    std::fill(Jx.data(), Jx.data() + Jx.size(), 0.3);
+    tag(0, 0, 0) = 1;
+    tag(2, 4, 1) = 1;
+    strategy.tag(model, layout, tags.data());
+
+    EXPECT_EQ(1, tag(0, 0, 0));
+    EXPECT_EQ(1, tag(2, 4, 1));
+    EXPECT_EQ(2, std::count(std::begin(tags), std::end(tags), 1));
+
+    setJx(2, 4, 1, 0.2);
+    setJx(3, 3, 3, 0.6);
+    strategy.tag(model, layout, tags.data());
+
+    EXPECT_EQ(1, tag(0, 0, 0));
+    EXPECT_EQ(0, tag(2, 4, 1));
+    EXPECT_EQ(1, tag(3, 3, 3));
+    EXPECT_EQ(2, std::count(std::begin(tags), std::end(tags), 1));
+}
+
+
+TEST_F(DefaultTagging3D, usesPreviousTagsOnlyWithHysteresis)
+{
+    EXPECT_TRUE(strategy.usesPreviousTags());
+
+    PHARE::initializer::PHAREDict dict;
+    dict["threshold"] = 0.5;
+    dict["criteria"]  = std::string{"current"};
+    EXPECT_FALSE(DefaultHybridTaggerStrategy<TaggedModel3D>{dict}.usesPreviousTags());
+}
+
+
+
+TEST(TaggingKernel, criteriaAreParsedFromACommaSeparatedList)
+{
+    auto const criteria = taggingCriteriaFrom("B, current");
+    ASSERT_EQ(2u, criteria.size());
+    EXPECT_EQ(TaggingCriterion::B, criteria[0]);
+    EXPECT_EQ(TaggingCriterion::current, criteria[1]);
+
+    EXPECT_THROW(taggingCriteriaFrom("velocity"), std::runtime_error);
+}
+
+
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
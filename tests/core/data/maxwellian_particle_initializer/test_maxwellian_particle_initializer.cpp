@@ -1,3 +1,5 @@
+#include <set>
+#include <cstdint>
 #include <type_traits>
 
 
@@ -21,7 +23,7 @@ using namespace PHARE::initializer;
 
 class AMaxwellianParticleInitializer1D : public ::testing::Test
 {
-private:
+protected:
     using GridLayoutT       = GridLayout<GridLayoutImplYee<1, 1>>;
     using ParticleArrayT    = ParticleArray<1>;
     using InitFunctionArray = std::array<InitFunction<1>, 3>;
@@ -76,6 +78,59 @@ TEST_F(AMaxwellianParticleInitializer1D, loadsParticlesInTheDomain)
 
 
 
+TEST_F(AMaxwellianParticleInitializer1D, countsTheParticlesItLoadsPerCellWithoutLoadingThem)
+{
+    // the density is x, so cells left of x = 2 are below the cut-off
+    std::uint32_t const ppc = 10;
+    MaxwellianParticleInitializer<ParticleArrayT, GridLayoutT> cutInitializer{
+        density, InitFunctionArray{vx, vy, vz}, InitFunctionArray{vthx, vthy, vthz}, 1., ppc,
+        std::nullopt, Basis::Cartesian, InitFunctionArray{nullptr, nullptr, nullptr}, 2.};
+
+    auto const counts = cutInitializer.nbrParticlesPerCell(layout);
+    cutInitializer.loadParticles(particles, layout);
+
+    ASSERT_EQ(counts.size(), layout.AMRBox().size());
+    std::size_t iCell = 0, nbrEmptyCells = 0;
+    for (auto const& cell : layout.AMRBox())
+    {
+        auto const& counted = counts[iCell++];
+        EXPECT_EQ(counted, particles.nbr_particles_in(cell.toArray()));
+        EXPECT_TRUE(counted == 0 or counted == ppc);
+        nbrEmptyCells += counted == 0;
+    }
+    EXPECT_EQ(nbrEmptyCells, 20u);
+}
+
+
+
+
+#if PHARE_WITH_TRACERS
+TEST_F(AMaxwellianParticleInitializer1D, givesIdsToTheParticlesOfTheTracerBox)
+{
+    // the box covers the cells 60 to 69 of the patch starting at cell 50
+    std::uint32_t const ppc = 10;
+    TracerSelection<1> const tracers{1., TracerSelection<1>::Region{{{1.}, {2.}}}};
+    MaxwellianParticleInitializer<ParticleArrayT, GridLayoutT> tracingInitializer{
+        density, InitFunctionArray{vx, vy, vz}, InitFunctionArray{vthx, vthy, vthz}, 1., ppc,
+        std::nullopt, Basis::Cartesian, InitFunctionArray{nullptr, nullptr, nullptr}, 1e-16,
+        tracers};
+
+    tracingInitializer.loadParticles(particles, layout);
+
+    std::set<std::uint64_t> ids;
+    for (auto const& particle : particles)
+    {
+        auto const traced = particle.iCell[0] >= 60 and particle.iCell[0] < 70;
+        EXPECT_EQ(particle.id != TracerSelection<1>::untraced, traced);
+        if (traced)
+            ids.insert(particle.id);
+    }
+    EXPECT_EQ(ids.size(), 10u * ppc);
+}
+#endif
+
+
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
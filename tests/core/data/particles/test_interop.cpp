@@ -49,8 +49,11 @@ TYPED_TEST(ParticleListTest, SoAandAoSInterop)
     for (auto const& view : contiguous)
     {
         auto i = particleArray.size();
-        particleArray.emplace_back(std::copy(view));
+        auto& particle = particleArray.emplace_back(std::copy(view));
         EXPECT_EQ(contiguous[i], particleArray.back());
+#if PHARE_WITH_TRACERS
+        particle.id = i % 2 ? i : 0; // every other particle is a tracer
+#endif
     }
     EXPECT_EQ(particleArray.size(), size);
     EXPECT_EQ(contiguous.size(), particleArray.size());
@@ -61,6 +64,9 @@ TYPED_TEST(ParticleListTest, SoAandAoSInterop)
     std::size_t i = 0;
     for (auto const& particle : AoSFromSoA)
         EXPECT_EQ(particle, particleArray[i++]);
+
+    for (i = 0; i < size; i++) // ids are not in views
+        EXPECT_EQ(AoSFromSoA.copy(i), particleArray[i]);
 }
 
 int main(int argc, char** argv)
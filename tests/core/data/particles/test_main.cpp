@@ -94,6 +94,89 @@ TEST_F(AParticle, CanBeReducedToAnAbsolutePositionPoint)
 
 
 
+TEST(AParticleArray, isRemappedAfterDeferredCellChanges)
+{
+    Box<int, 1> box{{0}, {9}};
+    ParticleArray<1> particles{grow(box, 1)};
+    for (int iCell = 0; iCell < 10; ++iCell)
+        particles.push_back(Particle<1>{1., 1., {iCell}, {.5}, {0., 0., 0.}});
+
+    for (std::size_t idx = 1; idx < particles.size(); idx += 2)
+        particles.change_icell_deferred(std::array{particles[idx].iCell[0] + 1}, idx);
+
+    EXPECT_TRUE(particles.has_stale_map());
+    EXPECT_EQ(0u, particles.nbr_particles_in({1}));
+    EXPECT_FALSE(particles.has_stale_map());
+    EXPECT_EQ(1u, particles.nbr_particles_in({10}));
+    EXPECT_TRUE(particles.is_mapped());
+
+    auto inBox = particles.partition([&](auto const& cell) { return isIn(Point{cell}, box); });
+    EXPECT_EQ(9u, inBox.size());
+}
+
+
+TEST(AParticleArray, keepsItsCellMapWhenSwappedOrReplaced)
+{
+    Box<int, 1> box{{0}, {9}};
+    ParticleArray<1> particles{grow(box, 1)}, others{grow(box, 1)}, copy{grow(box, 1)};
+    for (int iCell = 0; iCell < 10; ++iCell)
+        particles.push_back(Particle<1>{1., 1., {iCell}, {.5}, {0., 0., 0.}});
+    others.push_back(Particle<1>{1., 1., {3}, {.5}, {0., 0., 0.}});
+
+    swap(particles, others);
+    EXPECT_EQ(1u, particles.size());
+    EXPECT_EQ(10u, others.size());
+    EXPECT_TRUE(particles.is_mapped());
+    EXPECT_TRUE(others.is_mapped());
+    EXPECT_EQ(1u, particles.nbr_particles_in({3}));
+    EXPECT_EQ(0u, particles.nbr_particles_in({4}));
+
+    copy.push_back(Particle<1>{1., 1., {5}, {.5}, {0., 0., 0.}});
+    copy.replace_from(others);
+    EXPECT_EQ(others, copy);
+    EXPECT_TRUE(copy.is_mapped());
+    EXPECT_EQ(10u, copy.nbr_particles_in(box));
+
+    // copying again what fits in the copy does not reallocate it
+    auto const* data = copy.vector().data();
+    copy.replace_from(particles);
+    copy.replace_from(others);
+    EXPECT_EQ(data, copy.vector().data());
+    EXPECT_EQ(others, copy);
+    EXPECT_EQ(10u, copy.nbr_particles_in(box));
+}
+
+
+TEST(AParticleArray, keepsItsCellMapValidWhenBucketSorted)
+{
+    Box<int, 1> box{{0}, {9}};
+    ParticleArray<1> particles{box};
+    for (int iCell = 9; iCell >= 0; --iCell)
+        for (int iPart = 0; iPart < 3; ++iPart)
+            particles.push_back(Particle<1>{1. + iPart, 1., {iCell}, {.5}, {0., 0., 0.}});
+
+    ParticleArray<1>::BucketSortBuffer buffer;
+    auto const bucket   = [](auto const& iCell) { return static_cast<std::size_t>(iCell[0] / 5); };
+    auto const& offsets = particles.bucket_sort(2, bucket, buffer);
+
+    EXPECT_EQ((std::vector<std::size_t>{0, 15, 30}), offsets);
+    EXPECT_FALSE(particles.has_stale_map());
+    EXPECT_TRUE(particles.is_mapped());
+    for (std::size_t idx = 0; idx < particles.size(); ++idx)
+    {
+        EXPECT_EQ(bucket(particles[idx].iCell), idx / 15);
+        EXPECT_EQ(1. + idx % 3, particles[idx].weight); // stable
+    }
+
+    // sorting again reuses the storage of the buffer
+    auto const* data = buffer.sorted.data();
+    particles.bucket_sort(2, bucket, buffer);
+    EXPECT_EQ(data, particles.vector().data());
+    EXPECT_TRUE(particles.is_mapped());
+}
+
+
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,87 @@
+#include "core/data/particles/tracers.hpp"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstdint>
+#include <unordered_set>
+
+using namespace PHARE::core;
+
+
+
+namespace
+{
+constexpr std::size_t dim = 2;
+using Selection_t         = TracerSelection<dim>;
+
+std::array<double, dim> positionOf(std::array<int, dim> const& cell)
+{
+    return {cell[0] + .5, cell[1] + .5};
+}
+
+} // namespace
+
+
+
+TEST(TracerSelection, givesUniqueIdsPerCellAndParticle)
+{
+    Selection_t const all{1.};
+    std::unordered_set<std::uint64_t> ids;
+    for (int i = 0; i < 10; ++i)
+        for (int j = 0; j < 10; ++j)
+            for (std::uint32_t iPart = 0; iPart < 20; ++iPart)
+            {
+                auto const id = all.id({i, j}, iPart, positionOf({i, j}));
+                EXPECT_NE(id, Selection_t::untraced);
+                ids.insert(id);
+            }
+    EXPECT_EQ(ids.size(), 10u * 10u * 20u);
+}
+
+
+
+TEST(TracerSelection, selectsTheGivenFractionReproducibly)
+{
+    Selection_t const some{.1};
+    Selection_t const same{.1};
+    std::size_t selected = 0, total = 0;
+    for (int i = 0; i < 100; ++i)
+        for (std::uint32_t iPart = 0; iPart < 100; ++iPart, ++total)
+        {
+            auto const id = some.id({i, 3}, iPart, positionOf({i, 3}));
+            EXPECT_EQ(id, same.id({i, 3}, iPart, positionOf({i, 3})));
+            selected += id != Selection_t::untraced;
+        }
+    EXPECT_NEAR(static_cast<double>(selected) / total, .1, .01);
+}
+
+
+
+TEST(TracerSelection, onlySelectsParticlesInTheBox)
+{
+    Selection_t const boxed{1., Selection_t::Region{{{2., 2.}, {4., 4.}}}};
+    EXPECT_NE(boxed.id({2, 3}, 0, positionOf({2, 3})), Selection_t::untraced);
+    EXPECT_EQ(boxed.id({5, 3}, 0, positionOf({5, 3})), Selection_t::untraced);
+    EXPECT_EQ(boxed.id({1, 1}, 0, positionOf({1, 1})), Selection_t::untraced);
+}
+
+
+
+TEST(TracerSelection, tracesNothingByDefault)
+{
+    Selection_t const none;
+    EXPECT_FALSE(none.any());
+    EXPECT_FALSE(Selection_t{0.}.any());
+    EXPECT_EQ(none.id({1, 1}, 0, positionOf({1, 1})), Selection_t::untraced);
+    EXPECT_THROW((Selection_t{1.5}), std::runtime_error);
+    EXPECT_THROW((void)Selection_t{1.}.id({-1, 0}, 0, positionOf({0, 0})), std::runtime_error);
+}
+
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,134 @@
+#include "gtest/gtest.h"
+
+#include "phare_core.hpp"
+#include "core/numerics/distribution/velocity_histogram.hpp"
+
+#include "tests/core/data/electromag/test_electromag_fixtures.hpp"
+
+#include <array>
+#include <numeric>
+#include <vector>
+
+using namespace PHARE::core;
+
+
+
+namespace
+{
+constexpr std::size_t dim    = 2;
+constexpr std::size_t interp = 1;
+using GridLayout_t           = typename PHARE_Types<dim, interp>::GridLayout_t;
+using ParticleArray_t        = ParticleArray<dim>;
+using Histogram_t            = VelocityHistogram<dim>;
+using Component              = Histogram_t::Component;
+
+
+class AVelocityHistogram : public ::testing::Test
+{
+protected:
+    AVelocityHistogram()
+    {
+        // B along y everywhere
+        for (auto const& [id, type] : Components::componentMap())
+        {
+            auto& component = em.B.getComponent(type);
+            std::fill(component.begin(), component.end(), id == "y" ? 2. : 0.);
+        }
+    }
+
+    void add(std::array<int, dim> const& cell, std::array<double, 3> const& v, double weight = 1)
+    {
+        particles.push_back(Particle<dim>{weight, 1., cell, {.5, .5}, v});
+    }
+
+    // a level 1 patch of the domain [0, 10]x[0, 10], covering it all
+    GridLayout_t layout{{.5, .5}, {20, 20}, {0., 0.}, Box<int, dim>{{0, 0}, {19, 19}}, 1};
+    UsableElectromag<dim> em{layout};
+    ParticleArray_t particles{layout.AMRBox()};
+};
+
+
+
+TEST_F(AVelocityHistogram, binsCartesianVelocitiesOfParticlesInBoxes)
+{
+    Histogram_t histogram{{{Component::vx, 4, -2., 2.}, {Component::vz, 2, 0., 1.}},
+                          {{{{0., 0.}, {5., 10.}}}, {{{0., 0.}, {10., 10.}}}}};
+
+    add({1, 1}, {-1.5, 0., .2}, 2.); // first box, bins 0 0
+    add({11, 1}, {1.5, 0., .7});     // second box only, bins 3 1
+    add({2, 3}, {0.5, 0., .7});      // both boxes, bins 2 1
+    add({2, 3}, {2.5, 0., .7});      // out of the vx range
+    histogram.add(particles, *em, layout);
+
+    EXPECT_EQ(histogram.shape(), (std::vector<std::size_t>{2, 4, 2}));
+
+    auto const& counts = histogram.counts();
+    ASSERT_EQ(counts.size(), 16u);
+    EXPECT_DOUBLE_EQ(counts[0 * 8 + 0 * 2 + 0], 2.);
+    EXPECT_DOUBLE_EQ(counts[0 * 8 + 2 * 2 + 1], 1.);
+    EXPECT_DOUBLE_EQ(counts[1 * 8 + 0 * 2 + 0], 2.);
+    EXPECT_DOUBLE_EQ(counts[1 * 8 + 3 * 2 + 1], 1.);
+    EXPECT_DOUBLE_EQ(counts[1 * 8 + 2 * 2 + 1], 1.);
+    EXPECT_DOUBLE_EQ(std::accumulate(counts.begin(), counts.end(), 0.), 7.);
+}
+
+
+
+TEST_F(AVelocityHistogram, binsPerCoarseCellOfParticlesOfRefinedLevels)
+{
+    // coarse cells are twice the level 1 cells
+    Histogram_t histogram{
+        {{Component::vy, 1, -1., 1.}}, Box<int, dim>{{0, 0}, {9, 9}}, {1., 1.}};
+
+    add({0, 0}, {0., 0., 0.});
+    add({1, 1}, {0., 0., 0.});
+    add({5, 2}, {0., 0., 0.});
+    histogram.add(particles, *em, layout);
+
+    EXPECT_EQ(histogram.shape(), (std::vector<std::size_t>{10, 10, 1}));
+
+    auto const& counts = histogram.counts();
+    EXPECT_DOUBLE_EQ(counts[0], 2.);          // coarse cell (0, 0)
+    EXPECT_DOUBLE_EQ(counts[2 * 10 + 1], 1.); // coarse cell (2, 1), x varies slowest
+    EXPECT_DOUBLE_EQ(std::accumulate(counts.begin(), counts.end(), 0.), 3.);
+
+    histogram.zero();
+    EXPECT_DOUBLE_EQ(std::accumulate(counts.begin(), counts.end(), 0.), 0.);
+}
+
+
+
+TEST_F(AVelocityHistogram, binsVelocitiesInTheLocalMagneticBasis)
+{
+    Histogram_t histogram{{{Component::vpar, 2, -1., 1.}, {Component::vperp, 2, 0., 2.}},
+                          {{{{0., 0.}, {10., 10.}}}}};
+    EXPECT_TRUE(histogram.magnetic());
+
+    add({3, 3}, {0., .5, 1.5});  // vpar = vy = .5, vperp = 1.5
+    add({3, 3}, {.3, -.5, 0.4}); // vpar = -.5, vperp = .5
+    histogram.add(particles, *em, layout);
+
+    auto const& counts = histogram.counts();
+    EXPECT_DOUBLE_EQ(counts[1 * 2 + 1], 1.);
+    EXPECT_DOUBLE_EQ(counts[0 * 2 + 0], 1.);
+}
+
+
+
+TEST(VelocityHistogram, rejectsUnknownAxesAndEmptyBins)
+{
+    EXPECT_THROW((void)Histogram_t::component("vw"), std::runtime_error);
+    EXPECT_EQ(Histogram_t::component("vperp2"), Component::vperp2);
+    EXPECT_THROW((Histogram_t{{{Component::vx, 0, -1., 1.}}, {}}), std::runtime_error);
+    EXPECT_THROW((Histogram_t{{{Component::vx, 2, 1., 1.}}, {}}), std::runtime_error);
+}
+
+} // namespace
+
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -24,8 +24,10 @@
 #include "core/data/vecfield/vecfield.hpp"
 #include "core/hybrid/hybrid_quantities.hpp"
 #include "core/numerics/interpolator/interpolator.hpp"
+#include "core/numerics/moments/tiled_deposit.hpp"
 
 #include "tests/core/data/vecfield/test_vecfield_fixtures.hpp"
+#include "tests/core/data/electromag/test_electromag_fixtures.hpp"
 
 using namespace PHARE::core;
 
@@ -485,6 +487,144 @@ TYPED_TEST(A3DInterpolator, canComputeAllEMfieldsAtParticle)
 
 
 
+template<typename InterpolatorT>
+struct AnElectromagGatherBuffer : public ::testing::Test
+{
+    static constexpr auto dim          = InterpolatorT::dimension;
+    static constexpr auto interp_order = InterpolatorT::interp_order;
+    static constexpr std::uint32_t nc  = 12;
+
+    using GridLayout_t    = typename PHARE::core::PHARE_Types<dim, interp_order>::GridLayout_t;
+    using ParticleArray_t = typename PHARE::core::PHARE_Types<dim, interp_order>::ParticleArray_t;
+
+    AnElectromagGatherBuffer()
+    {
+        // each component differs and varies along all directions
+        double value = 0;
+        for (auto* vecfield : {&em.E, &em.B})
+            for (auto& field : *vecfield)
+                for (auto& v : field)
+                    v = std::sin(value += .37);
+
+        std::mt19937 gen(1337);
+        std::uniform_int_distribution<int> cell(0, nc - 1);
+        std::uniform_real_distribution<double> delta(0, 1);
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            auto& part = particles.emplace_back();
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            {
+                part.iCell[iDim] = cell(gen);
+                part.delta[iDim] = delta(gen);
+            }
+        }
+    }
+
+    GridLayout_t layout{ConstArray<double, dim>(.1), ConstArray<std::uint32_t, dim>(nc),
+                        Point<double, dim>{ConstArray<double, dim>(0.)}};
+    UsableElectromag<dim> em{layout};
+    ParticleArray_t particles{layout.AMRBox()};
+    InterpolatorT interp;
+};
+
+using InterpolatorsND
+    = ::testing::Types<Interpolator<1, 1>, Interpolator<1, 2>, Interpolator<1, 3>,
+                       Interpolator<2, 1>, Interpolator<2, 2>, Interpolator<2, 3>,
+                       Interpolator<3, 1>, Interpolator<3, 2>, Interpolator<3, 3>>;
+
+TYPED_TEST_SUITE(AnElectromagGatherBuffer, InterpolatorsND);
+
+TYPED_TEST(AnElectromagGatherBuffer, givesSameFieldsAtParticlesAsElectromag)
+{
+    ElectromagGatherBuffer<TypeParam::dimension> buffer;
+    buffer.pack(*this->em, this->layout);
+
+    for (auto& part : this->particles)
+    {
+        auto const [E, B]             = this->interp(part, *this->em, this->layout);
+        auto const [bufferE, bufferB] = this->interp(part, buffer, this->layout);
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            EXPECT_NEAR(E[i], bufferE[i], 1e-12);
+            EXPECT_NEAR(B[i], bufferB[i], 1e-12);
+        }
+    }
+}
+
+
+
+
+template<typename InterpolatorT>
+struct ATiledDeposit : public ::testing::Test
+{
+    static constexpr auto dim          = InterpolatorT::dimension;
+    static constexpr auto interp_order = InterpolatorT::interp_order;
+    static constexpr std::uint32_t nc  = 12;
+
+    using PHARE_TYPES     = PHARE::core::PHARE_Types<dim, interp_order>;
+    using GridLayout_t    = typename PHARE_TYPES::GridLayout_t;
+    using ParticleArray_t = typename PHARE_TYPES::ParticleArray_t;
+    using Grid_t          = typename PHARE_TYPES::Grid_t;
+
+    ATiledDeposit()
+    {
+        std::mt19937 gen(1337);
+        std::uniform_int_distribution<int> cell(0, nc - 1);
+        std::uniform_real_distribution<double> delta(0, 1), velocity(-1, 1);
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            // built before being added so that the array maps it in its cell
+            typename ParticleArray_t::Particle_t part;
+            part.weight = delta(gen);
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+            {
+                part.iCell[iDim] = cell(gen);
+                part.delta[iDim] = delta(gen);
+            }
+            for (auto& v : part.v)
+                v = velocity(gen);
+            particles.push_back(part);
+        }
+    }
+
+    GridLayout_t layout{ConstArray<double, dim>(.1), ConstArray<std::uint32_t, dim>(nc),
+                        Point<double, dim>{ConstArray<double, dim>(0.)}};
+    ParticleArray_t particles{layout.AMRBox()};
+    InterpolatorT interp;
+
+    Grid_t rho{"rho", HybridQuantity::Scalar::rho, layout.allocSize(HybridQuantity::Scalar::rho)};
+    Grid_t tiledRho{"tiledRho", HybridQuantity::Scalar::rho,
+                    layout.allocSize(HybridQuantity::Scalar::rho)};
+    UsableVecField<dim> flux{"flux", layout, HybridQuantity::Vector::V};
+    UsableVecField<dim> tiledFlux{"tiledFlux", layout, HybridQuantity::Vector::V};
+};
+
+TYPED_TEST_SUITE(ATiledDeposit, InterpolatorsND);
+
+TYPED_TEST(ATiledDeposit, givesSameMomentsAsParticleToMesh)
+{
+    constexpr auto dim = TypeParam::dimension;
+
+    // 5 does not divide the 12 cells of the patch so some tiles are truncated
+    TiledDeposit<dim, TypeParam::interp_order> tiledDeposit{5};
+
+    this->interp(makeIndexRange(this->particles), this->rho, this->flux, this->layout);
+    tiledDeposit(this->particles, this->tiledRho, this->tiledFlux, this->layout);
+
+    EXPECT_TRUE(this->particles.is_mapped());
+
+    auto check = [](auto const& expected, auto const& actual) {
+        for (decltype(expected.size()) i = 0; i < expected.size(); ++i)
+            EXPECT_NEAR(expected.data()[i], actual.data()[i], 1e-12);
+    };
+    check(this->rho, this->tiledRho);
+    for (std::size_t iComp = 0; iComp < 3; ++iComp)
+        check(this->flux[iComp], this->tiledFlux[iComp]);
+}
+
+
+
+
 // set a collection of particle (the number depending on interpOrder) so that
 // their cumulative density equals 1 at index 20. idem for velocity components...
 
@@ -226,12 +226,14 @@ struct IonsBuffers
     ParticleArray protonLevelGhost;
     ParticleArray protonLevelGhostOld;
     ParticleArray protonLevelGhostNew;
+    ParticleArray protonLeaving;
 
     ParticleArray alphaDomain;
     ParticleArray alphaPatchGhost;
     ParticleArray alphaLevelGhost;
     ParticleArray alphaLevelGhostOld;
     ParticleArray alphaLevelGhostNew;
+    ParticleArray alphaLeaving;
 
     ParticlesPack<ParticleArray> protonPack;
     ParticlesPack<ParticleArray> alphaPack;
@@ -256,15 +258,18 @@ struct IonsBuffers
         , protonLevelGhost{grow(layout.AMRBox(), ghostSafeMapLayer)}
         , protonLevelGhostOld{grow(layout.AMRBox(), ghostSafeMapLayer)}
         , protonLevelGhostNew{grow(layout.AMRBox(), ghostSafeMapLayer)}
+        , protonLeaving{grow(layout.AMRBox(), ghostSafeMapLayer)}
         , alphaDomain{grow(layout.AMRBox(), ghostSafeMapLayer)}
         , alphaPatchGhost{grow(layout.AMRBox(), ghostSafeMapLayer)}
         , alphaLevelGhost{grow(layout.AMRBox(), ghostSafeMapLayer)}
         , alphaLevelGhostOld{grow(layout.AMRBox(), ghostSafeMapLayer)}
         , alphaLevelGhostNew{grow(layout.AMRBox(), ghostSafeMapLayer)}
-        , protonPack{"protons",         &protonDomain,        &protonPatchGhost,
-                     &protonLevelGhost, &protonLevelGhostOld, &protonLevelGhostNew}
-        , alphaPack{"alpha",          &alphaDomain,        &alphaPatchGhost,
-                    &alphaLevelGhost, &alphaLevelGhostOld, &alphaLevelGhostNew}
+        , alphaLeaving{grow(layout.AMRBox(), ghostSafeMapLayer)}
+        , protonPack{"protons",           &protonDomain,        &protonPatchGhost,
+                     &protonLevelGhost,   &protonLevelGhostOld, &protonLevelGhostNew,
+                     &protonLeaving}
+        , alphaPack{"alpha",          &alphaDomain,        &alphaPatchGhost, &alphaLevelGhost,
+                    &alphaLevelGhostOld, &alphaLevelGhostNew, &alphaLeaving}
     {
     }
 
@@ -289,15 +294,18 @@ struct IonsBuffers
         , protonLevelGhost{source.protonLevelGhost}
         , protonLevelGhostOld{source.protonLevelGhostOld}
         , protonLevelGhostNew{source.protonLevelGhostNew}
+        , protonLeaving{source.protonLeaving}
         , alphaDomain{source.alphaDomain}
         , alphaPatchGhost{source.alphaPatchGhost}
         , alphaLevelGhost{source.alphaLevelGhost}
         , alphaLevelGhostOld{source.alphaLevelGhostOld}
         , alphaLevelGhostNew{source.alphaLevelGhostNew}
-        , protonPack{"protons",         &protonDomain,        &protonPatchGhost,
-                     &protonLevelGhost, &protonLevelGhostOld, &protonLevelGhostNew}
-        , alphaPack{"alpha",          &alphaDomain,        &alphaPatchGhost,
-                    &alphaLevelGhost, &alphaLevelGhostOld, &alphaLevelGhostNew}
+        , alphaLeaving{source.alphaLeaving}
+        , protonPack{"protons",           &protonDomain,        &protonPatchGhost,
+                     &protonLevelGhost,   &protonLevelGhostOld, &protonLevelGhostNew,
+                     &protonLeaving}
+        , alphaPack{"alpha",          &alphaDomain,        &alphaPatchGhost, &alphaLevelGhost,
+                    &alphaLevelGhostOld, &alphaLevelGhostNew, &alphaLeaving}
 
     {
         ionDensity.copyData(source.ionDensity);
@@ -890,6 +898,220 @@ TYPED_TEST(IonUpdaterTest, momentsAreChangedInMomentsOnlyMode)
 
 
 
+TYPED_TEST(IonUpdaterTest, deferredCellMapGivesSameMomentsAsIncrementalUpdates)
+{
+    typename IonUpdaterTest<TypeParam>::IonUpdater ionUpdater{
+        init_dict["simulation"]["algo"]["ion_updater"]};
+
+    PHARE::initializer::PHAREDict deferredDict;
+    deferredDict["pusher"]["name"]             = std::string{"modified_boris"};
+    deferredDict["pusher"]["deferred_cellmap"] = true;
+    typename IonUpdaterTest<TypeParam>::IonUpdater deferredUpdater{deferredDict};
+
+    IonsBuffers ionsBufferCpy{this->ionsBuffers, this->layout};
+    typename IonUpdaterTest<TypeParam>::Ions deferredIons{init_dict["ions"]};
+    ionsBufferCpy.setBuffers(deferredIons);
+
+    ionUpdater.updatePopulations(this->ions, this->EM, this->layout, this->dt, UpdaterMode::all);
+    deferredUpdater.updatePopulations(deferredIons, this->EM, this->layout, this->dt,
+                                      UpdaterMode::all);
+
+    auto ix0 = this->layout.physicalStartIndex(QtyCentering::primal, Direction::X);
+    auto ix1 = this->layout.physicalEndIndex(QtyCentering::primal, Direction::X);
+
+    auto& populations         = this->ions.getRunTimeResourcesViewList();
+    auto& deferredPopulations = deferredIons.getRunTimeResourcesViewList();
+    for (std::size_t iPop = 0; iPop < populations.size(); ++iPop)
+    {
+        auto& pop         = populations[iPop];
+        auto& deferredPop = deferredPopulations[iPop];
+
+        EXPECT_EQ(pop.domainParticles().size(), deferredPop.domainParticles().size());
+        EXPECT_TRUE(deferredPop.domainParticles().is_mapped());
+
+        for (auto ix = ix0; ix <= ix1; ++ix)
+        {
+            EXPECT_NEAR(pop.density()(ix), deferredPop.density()(ix), 1e-12);
+            for (auto const& component : {Component::X, Component::Y, Component::Z})
+                EXPECT_NEAR(pop.flux().getComponent(component)(ix),
+                            deferredPop.flux().getComponent(component)(ix), 1e-12);
+        }
+    }
+}
+
+
+
+TYPED_TEST(IonUpdaterTest, tiledDepositGivesSameMomentsAsPatchDeposit)
+{
+    for (auto const mode : {UpdaterMode::domain_only, UpdaterMode::all})
+    {
+        typename IonUpdaterTest<TypeParam>::IonUpdater ionUpdater{
+            init_dict["simulation"]["algo"]["ion_updater"]};
+
+        PHARE::initializer::PHAREDict tiledDict;
+        tiledDict["pusher"]["name"] = std::string{"modified_boris"};
+        tiledDict["tile_size"]      = 4;
+        typename IonUpdaterTest<TypeParam>::IonUpdater tiledUpdater{tiledDict};
+
+        IonsBuffers ionsBufferCpy{this->ionsBuffers, this->layout};
+        typename IonUpdaterTest<TypeParam>::Ions tiledIons{init_dict["ions"]};
+        ionsBufferCpy.setBuffers(tiledIons);
+
+        ionUpdater.updatePopulations(this->ions, this->EM, this->layout, this->dt, mode);
+        tiledUpdater.updatePopulations(tiledIons, this->EM, this->layout, this->dt, mode);
+
+        auto ix0 = this->layout.physicalStartIndex(QtyCentering::primal, Direction::X);
+        auto ix1 = this->layout.physicalEndIndex(QtyCentering::primal, Direction::X);
+
+        auto& populations      = this->ions.getRunTimeResourcesViewList();
+        auto& tiledPopulations = tiledIons.getRunTimeResourcesViewList();
+        for (std::size_t iPop = 0; iPop < populations.size(); ++iPop)
+        {
+            auto& pop      = populations[iPop];
+            auto& tiledPop = tiledPopulations[iPop];
+
+            EXPECT_EQ(pop.domainParticles().size(), tiledPop.domainParticles().size());
+            EXPECT_TRUE(tiledPop.domainParticles().is_mapped());
+
+            for (auto ix = ix0; ix <= ix1; ++ix)
+            {
+                EXPECT_NEAR(pop.density()(ix), tiledPop.density()(ix), 1e-12);
+                for (auto const& component : {Component::X, Component::Y, Component::Z})
+                    EXPECT_NEAR(pop.flux().getComponent(component)(ix),
+                                tiledPop.flux().getComponent(component)(ix), 1e-12);
+            }
+        }
+    }
+}
+
+
+
+TYPED_TEST(IonUpdaterTest, skippingPatchGhostPushKeepsLeavingDomainParticles)
+{
+    PHARE::initializer::PHAREDict skipDict;
+    skipDict["pusher"]["name"]        = std::string{"modified_boris"};
+    skipDict["skip_patch_ghost_push"] = true;
+    typename IonUpdaterTest<TypeParam>::IonUpdater ionUpdater{skipDict};
+
+    std::vector<std::size_t> nbrDomainParticles;
+    std::vector<typename IonUpdaterTest<TypeParam>::ParticleArray> patchGhosts;
+    for (auto& pop : this->ions)
+    {
+        nbrDomainParticles.push_back(pop.domainParticles().size());
+        patchGhosts.push_back(pop.patchGhostParticles());
+    }
+
+    // domain_only so that level ghosts entering the domain are not copied in
+    ionUpdater.updatePopulations(this->ions, this->EM, this->layout, this->dt,
+                                 UpdaterMode::domain_only);
+
+    auto domainBox = this->layout.AMRBox();
+    auto ghostBox  = grow(domainBox, this->layout.nbrParticleGhosts());
+
+    std::size_t iPop = 0;
+    for (auto& pop : this->ions)
+    {
+        // no particle moves further than the ghost box in one step
+        // so domain particles either stayed in the domain or are leaving
+        EXPECT_EQ(nbrDomainParticles[iPop],
+                  pop.domainParticles().size() + pop.leavingParticles().size());
+        EXPECT_TRUE(pop.patchGhostParticles() == patchGhosts[iPop]);
+
+        for (auto const& part : pop.leavingParticles())
+        {
+            EXPECT_TRUE(isIn(Point{part.iCell}, ghostBox));
+            EXPECT_FALSE(isIn(Point{part.iCell}, domainBox));
+        }
+        ++iPop;
+    }
+}
+
+
+
+TYPED_TEST(IonUpdaterTest, exchangingLeavingParticlesGivesSameMomentsAsPushingPatchGhosts)
+{
+    using Test       = IonUpdaterTest<TypeParam>;
+    constexpr auto d = Test::dim;
+
+    PHARE::initializer::PHAREDict skipDict;
+    skipDict["pusher"]["name"]        = std::string{"modified_boris"};
+    skipDict["skip_patch_ghost_push"] = true;
+
+    // the patch ghosts of the fixture are clones of the first cells of the right neighbor patch,
+    // the only cells from which particles can enter the domain in a step
+    typename Test::GridLayout neighborLayout{
+        {0.1}, {100u}, {{10.}}, Box<int, d>{Point{100}, Point{199}}};
+
+    for (auto const mode : {UpdaterMode::domain_only, UpdaterMode::all})
+    {
+        typename Test::IonUpdater ionUpdater{init_dict["simulation"]["algo"]["ion_updater"]};
+        typename Test::IonUpdater skipUpdater{skipDict};
+
+        IonsBuffers skipBuffers{this->ionsBuffers, this->layout};
+        typename Test::Ions skipIons{init_dict["ions"]};
+        skipBuffers.setBuffers(skipIons);
+
+        ElectromagBuffers<d, Test::interp_order> neighborEMBuffers{neighborLayout};
+        typename Test::Electromag neighborEM{init_dict["electromag"]};
+        neighborEMBuffers.setBuffers(neighborEM);
+        neighborEM.initialize(neighborLayout);
+
+        IonsBuffers<d, Test::interp_order> neighborBuffers{neighborLayout};
+        typename Test::Ions neighborIons{init_dict["ions"]};
+        neighborBuffers.setBuffers(neighborIons);
+
+        auto& populations         = this->ions.getRunTimeResourcesViewList();
+        auto& skipPopulations     = skipIons.getRunTimeResourcesViewList();
+        auto& neighborPopulations = neighborIons.getRunTimeResourcesViewList();
+        for (std::size_t iPop = 0; iPop < populations.size(); ++iPop)
+            for (auto const& part : populations[iPop].patchGhostParticles())
+                neighborPopulations[iPop].domainParticles().push_back(part);
+
+        ionUpdater.updatePopulations(this->ions, this->EM, this->layout, this->dt, mode);
+        skipUpdater.updatePopulations(skipIons, this->EM, this->layout, this->dt, mode);
+        skipUpdater.updatePopulations(neighborIons, neighborEM, neighborLayout, this->dt, mode);
+
+        // what the leaving particles schedule does, neighbor leaving particles in our domain
+        // are appended to our domain particles
+        auto const domainBox = this->layout.AMRBox();
+        for (std::size_t iPop = 0; iPop < populations.size(); ++iPop)
+        {
+            auto& domain             = skipPopulations[iPop].domainParticles();
+            auto const firstEntering = domain.size();
+            neighborPopulations[iPop].leavingParticles().export_particles(
+                domain, [&](auto const& cell) { return isIn(Point{cell}, domainBox); });
+            EXPECT_GT(domain.size(), firstEntering);
+
+            depositEnteringParticles(skipPopulations[iPop], firstEntering, this->layout);
+            EXPECT_EQ(skipPopulations[iPop].leavingParticles().size(), 0u);
+        }
+
+        auto ix0 = this->layout.physicalStartIndex(QtyCentering::primal, Direction::X);
+        auto ix1 = this->layout.physicalEndIndex(QtyCentering::primal, Direction::X);
+
+        for (std::size_t iPop = 0; iPop < populations.size(); ++iPop)
+        {
+            auto& pop     = populations[iPop];
+            auto& skipPop = skipPopulations[iPop];
+
+            if (mode == UpdaterMode::all)
+            {
+                EXPECT_EQ(pop.domainParticles().size(), skipPop.domainParticles().size());
+            }
+
+            for (auto ix = ix0; ix <= ix1; ++ix)
+            {
+                EXPECT_NEAR(pop.density()(ix), skipPop.density()(ix), 1e-12);
+                for (auto const& component : {Component::X, Component::Y, Component::Z})
+                    EXPECT_NEAR(pop.flux().getComponent(component)(ix),
+                                skipPop.flux().getComponent(component)(ix), 1e-12);
+            }
+        }
+    }
+}
+
+
+
 TYPED_TEST(IonUpdaterTest, thatNoNaNsExistOnPhysicalNodesMoments)
 {
     typename IonUpdaterTest<TypeParam>::IonUpdater ionUpdater{
@@ -335,6 +335,42 @@ TEST_F(APusherWithLeavingParticles, splitLeavingFromNonLeavingParticles)
 }
 
 
+TEST_F(APusherWithLeavingParticles, pushedStateMatchesInPlacePushAndLeavesInputUntouched)
+{
+    auto const pushBox   = grow(cells, 1);
+    auto const selectBox = Box<int, 1>{Point{2}, Point{7}};
+    auto const original  = particlesIn;
+
+    std::vector<PushedParticle<1>> selected;
+    auto layout = DummyLayout<1>{};
+    pusher->move(particlesIn, selected, em, mass, interpolator, layout, pushBox, selectBox);
+
+    EXPECT_EQ(original, particlesIn);
+
+    auto range    = makeIndexRange(particlesIn);
+    auto inSelect = [&](auto& particleRange) {
+        return particleRange.array().partition(
+            [&](auto const& cell) { return PHARE::core::isIn(Point{cell}, selectBox); });
+    };
+    auto inPush = [&](auto& particleRange) {
+        return particleRange.array().partition(
+            [&](auto const& cell) { return PHARE::core::isIn(Point{cell}, pushBox); });
+    };
+    auto inPlace = pusher->move(range, range, em, mass, interpolator, layout, inPush, inSelect);
+
+    ASSERT_EQ(inPlace.size(), selected.size());
+    for (auto const& pushed : selected)
+    {
+        auto const& particle = original[pushed.index];
+        auto const it = std::find_if(inPlace.begin(), inPlace.end(), [&](auto const& part) {
+            return part.weight == particle.weight and part.iCell == pushed.iCell
+                   and part.delta == pushed.delta and part.v == pushed.v;
+        });
+        EXPECT_NE(it, inPlace.end());
+    }
+}
+
+
 // removed boundary condition partitioner, fix that when BCs are implemented
 #if 0
 TEST_F(APusherWithLeavingParticles, pusherWithOrWithoutBCReturnsSameNbrOfStayingParticles)
@@ -0,0 +1,194 @@
+#include "gtest/gtest.h"
+
+#include "core/data/particles/particle_array.hpp"
+#include "core/numerics/resampler/particle_resampler.hpp"
+
+#include <array>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+using namespace PHARE::core;
+
+
+
+namespace
+{
+constexpr std::size_t dim = 2;
+using ParticleArray_t     = ParticleArray<dim>;
+using Resampler_t         = ParticleResampler<ParticleArray_t>;
+using Box_t               = Box<int, dim>;
+
+
+// weight, momentum and kinetic energy of each velocity component of a cell
+struct CellMoments
+{
+    double weight = 0;
+    std::array<double, 3> momentum{}, energy{};
+    std::size_t size = 0;
+};
+
+CellMoments momentsIn(ParticleArray_t const& particles, std::array<int, dim> const& cell)
+{
+    CellMoments moments;
+    for (auto const& particle : particles)
+    {
+        if (particle.iCell != cell)
+            continue;
+        ++moments.size;
+        moments.weight += particle.weight;
+        for (std::size_t iComp = 0; iComp < 3; ++iComp)
+        {
+            moments.momentum[iComp] += particle.weight * particle.v[iComp];
+            moments.energy[iComp] += particle.weight * particle.v[iComp] * particle.v[iComp];
+        }
+    }
+    return moments;
+}
+
+
+class AParticleResampler : public ::testing::Test
+{
+protected:
+    AParticleResampler()
+    {
+        std::mt19937 generator{1337};
+        std::uniform_real_distribution<double> deltas{0, .99};
+        std::normal_distribution<double> velocities{.3, 1.};
+        std::uniform_real_distribution<double> weights{.5, 1.5};
+
+        auto add = [&](std::array<int, dim> const& cell, std::size_t const count) {
+            for (std::size_t i = 0; i < count; ++i)
+                particles.push_back(Particle<dim>{
+                    weights(generator),
+                    1.,
+                    cell,
+                    {deltas(generator), deltas(generator)},
+                    {velocities(generator), velocities(generator), velocities(generator)}});
+        };
+
+        add(crowded, 200);
+        add(sparse, 3);
+        add(border, 200);
+    }
+
+    Box_t domain{{0, 0}, {9, 9}};
+    Box_t interior{{1, 1}, {8, 8}};
+
+    std::array<int, dim> crowded{4, 5};
+    std::array<int, dim> sparse{6, 2};
+    std::array<int, dim> border{0, 3};
+
+    ParticleArray_t particles{domain};
+};
+
+} // namespace
+
+
+
+TEST_F(AParticleResampler, mergesCrowdedCellsConservingWeightMomentumAndEnergy)
+{
+    PHARE::initializer::PHAREDict dict;
+    dict["max_per_cell"] = 40;
+    Resampler_t resampler{dict};
+
+    auto const before = momentsIn(particles, crowded);
+    auto const counts = resampler.resample(particles, domain, interior);
+    auto const after  = momentsIn(particles, crowded);
+
+    EXPECT_LE(after.size, 40u);
+    EXPECT_EQ(counts.removed, before.size - after.size);
+    EXPECT_EQ(counts.added, 0u);
+    EXPECT_EQ(particles.size(), 200 + 3 + 200 - counts.removed);
+
+    EXPECT_NEAR(after.weight, before.weight, 1e-10);
+    for (std::size_t iComp = 0; iComp < 3; ++iComp)
+    {
+        EXPECT_NEAR(after.momentum[iComp], before.momentum[iComp], 1e-10);
+        EXPECT_NEAR(after.energy[iComp], before.energy[iComp], 1e-10);
+    }
+
+    for (auto const& particle : particles)
+        for (std::size_t iDim = 0; iDim < dim; ++iDim)
+        {
+            EXPECT_GE(particle.delta[iDim], 0);
+            EXPECT_LT(particle.delta[iDim], 1);
+        }
+
+    EXPECT_TRUE(particles.is_mapped());
+}
+
+
+
+TEST_F(AParticleResampler, leavesCellsOutOfTheResampledBoxUntouched)
+{
+    PHARE::initializer::PHAREDict dict;
+    dict["max_per_cell"] = 40;
+    dict["min_per_cell"] = 10;
+    Resampler_t resampler{dict};
+
+    auto const before = momentsIn(particles, border);
+    resampler.resample(particles, domain, interior);
+    auto const after = momentsIn(particles, border);
+
+    EXPECT_EQ(after.size, before.size);
+    EXPECT_EQ(after.weight, before.weight);
+}
+
+
+
+#if PHARE_WITH_TRACERS
+TEST_F(AParticleResampler, neverMergesTracers)
+{
+    PHARE::initializer::PHAREDict dict;
+    dict["max_per_cell"] = 40;
+    Resampler_t resampler{dict};
+
+    std::vector<Particle<dim>> tracers;
+    std::uint64_t id = 0;
+    for (auto& particle : particles)
+        if (particle.iCell == crowded and id < 5)
+        {
+            particle.id = ++id;
+            tracers.push_back(particle);
+        }
+
+    resampler.resample(particles, domain, interior);
+
+    for (auto const& tracer : tracers)
+        EXPECT_EQ(std::count(std::begin(particles), std::end(particles), tracer), 1);
+}
+#endif
+
+
+
+TEST_F(AParticleResampler, splitsSparseCellsConservingWeightMomentumAndEnergy)
+{
+    PHARE::initializer::PHAREDict dict;
+    dict["min_per_cell"] = 10;
+    Resampler_t resampler{dict};
+
+    auto const before = momentsIn(particles, sparse);
+    auto const counts = resampler.resample(particles, domain, interior);
+    auto const after  = momentsIn(particles, sparse);
+
+    EXPECT_EQ(after.size, 10u);
+    EXPECT_EQ(counts.added, 7u);
+    EXPECT_EQ(counts.removed, 0u);
+
+    EXPECT_NEAR(after.weight, before.weight, 1e-12);
+    for (std::size_t iComp = 0; iComp < 3; ++iComp)
+    {
+        EXPECT_NEAR(after.momentum[iComp], before.momentum[iComp], 1e-12);
+        EXPECT_NEAR(after.energy[iComp], before.energy[iComp], 1e-12);
+    }
+}
+
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
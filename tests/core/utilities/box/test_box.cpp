@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "core/utilities/box/box.hpp"
+#include "core/utilities/box/tile_set.hpp"
 #include "core/utilities/point/point.hpp"
 
 #include "gmock/gmock.h"
@@ -259,6 +260,27 @@ TEST(BoxIterator, iterates)
 
 
 
+TEST(TileSet, coversTheBoxWithTruncatedUpperTiles)
+{
+    Box<int, 2> box{{-2, 3}, {9, 7}};
+    TileSet<2> tiles{box, 4};
+
+    EXPECT_EQ(6u, tiles.size()); // 3 x 2 tiles
+    EXPECT_EQ((Box<int, 2>{{-2, 3}, {1, 6}}), tiles[0]);
+    EXPECT_EQ((Box<int, 2>{{-2, 7}, {1, 7}}), tiles[1]);
+    EXPECT_EQ((Box<int, 2>{{6, 7}, {9, 7}}), tiles[5]);
+
+    std::size_t nbrCells = 0;
+    for (std::size_t iTile = 0; iTile < tiles.size(); ++iTile)
+        for (auto const& cell : tiles[iTile])
+        {
+            EXPECT_EQ(iTile, tiles.tileIndex(cell));
+            ++nbrCells;
+        }
+    EXPECT_EQ(box.size(), nbrCells);
+}
+
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -421,6 +421,25 @@ TEST_F(CellMappedParticleBox, trackParticle)
 
 
 
+TEST_F(CellMappedParticleBox, rebuildMapsMovedParticles)
+{
+    for (std::size_t i = 0; i < particles.size(); i += 3)
+        particles[i].iCell[0] += (particles[i].iCell[0] < patchBox.upper[0] ? 1 : -1);
+
+    cm.rebuild(particles);
+
+    EXPECT_EQ(cm.size(), particles.size());
+    EXPECT_TRUE(cm.check_unique());
+    for (std::size_t i = 0; i < particles.size(); ++i)
+    {
+        auto& blist = cm(particles[i].iCell);
+        EXPECT_NE(std::find(blist.begin(), blist.end(), i), blist.end());
+    }
+}
+
+
+
+
 TEST_F(CellMappedParticleBox, partitionsParticlesInPatchBox)
 {
     EXPECT_EQ(cm.size(), particles.size());
@@ -0,0 +1,173 @@
+#include "gtest/gtest.h"
+
+#include "core/utilities/mpi_utils.hpp"
+#include "core/utilities/logger/scope_profiler.hpp"
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <filesystem>
+
+using namespace PHARE::core::profiler;
+
+
+
+namespace
+{
+void inner()
+{
+    PHARE_PROFILER_SCOPE(2, "inner");
+}
+
+void outer(std::size_t const nbrInner)
+{
+    PHARE_PROFILER_SCOPE(1, "outer");
+    for (std::size_t i = 0; i < nbrInner; ++i)
+        inner();
+}
+
+std::vector<std::string> reportLines(std::string const& file)
+{
+    std::vector<std::string> lines;
+    std::ifstream in{file};
+    for (std::string line; std::getline(in, line);)
+        lines.push_back(line);
+    return lines;
+}
+
+std::string const reportFile = "scope_profiler_report/profile.txt";
+
+} // namespace
+
+
+
+class AScopeProfiler : public ::testing::Test
+{
+protected:
+    AScopeProfiler()
+    {
+        if (PHARE::core::mpi::rank() == 0)
+            std::filesystem::remove_all("scope_profiler_report");
+        PHARE::core::mpi::barrier();
+        Profiler::INSTANCE().enable();
+    }
+
+    ~AScopeProfiler() { Profiler::INSTANCE().disable(); }
+};
+
+
+
+TEST_F(AScopeProfiler, reportsNestedScopesWithTheirCallCountsOverRanks)
+{
+    // more events than a thread buffer holds, so that it is drained while recording
+    auto const nbrInner = ThreadProfile::capacity;
+    outer(nbrInner);
+    outer(nbrInner);
+
+    Profiler::INSTANCE().report("test", reportFile);
+
+    if (PHARE::core::mpi::rank() != 0)
+        return;
+
+    auto const lines    = reportLines(reportFile);
+    auto const nbrRanks = std::to_string(PHARE::core::mpi::size());
+    ASSERT_EQ(lines.size(), 4u);
+    EXPECT_EQ(lines[0].rfind("# test, " + nbrRanks + " ranks", 0), 0u);
+    EXPECT_EQ(lines[1].rfind("outer (1)", 0), 0u);
+    EXPECT_EQ(lines[2].rfind("  inner (2)", 0), 0u);
+
+    auto const calls = [](std::string const& line) {
+        return std::stoul(line.substr(line.rfind(' ') + 1));
+    };
+    auto const ranks = std::stoul(nbrRanks);
+    EXPECT_EQ(calls(lines[1]), 2 * ranks);
+    EXPECT_EQ(calls(lines[2]), 2 * nbrInner * ranks);
+}
+
+
+
+TEST_F(AScopeProfiler, resetsItsTimesAfterAReport)
+{
+    outer(2);
+    Profiler::INSTANCE().report("first", reportFile);
+    Profiler::INSTANCE().report("second", reportFile);
+
+    if (PHARE::core::mpi::rank() != 0)
+        return;
+
+    auto const lines = reportLines(reportFile);
+    ASSERT_EQ(lines.size(), 6u);
+    EXPECT_EQ(lines[4].rfind("# second", 0), 0u);
+}
+
+
+
+TEST_F(AScopeProfiler, tracesScopesOnOneTrackPerRankAndLevel)
+{
+    auto const rank = PHARE::core::mpi::rank();
+    Profiler::INSTANCE().trace("scope_profiler_trace");
+    {
+        LevelScope levelScope{1};
+        outer(2);
+    }
+    Profiler::INSTANCE().closeTrace();
+
+    auto const lines = reportLines("scope_profiler_trace/rank." + std::to_string(rank) + ".json");
+    ASSERT_GT(lines.size(), 2u);
+    EXPECT_EQ(lines.front(), "[");
+    EXPECT_EQ(lines.back(), "]");
+
+    auto const count = [&](std::string const& pattern) {
+        return std::count_if(lines.begin(), lines.end(), [&](auto const& line) {
+            return line.find(pattern) != std::string::npos;
+        });
+    };
+    auto const pid = R"("pid":)" + std::to_string(rank);
+
+    EXPECT_EQ(count(R"("name":"rank )" + std::to_string(rank)), 1);
+    EXPECT_EQ(count(R"("name":"level 1")"), 1);
+    EXPECT_EQ(count(R"({"name":"outer","ph":"B")"), 1);
+    EXPECT_EQ(count(R"({"name":"outer","ph":"E")"), 1);
+    EXPECT_EQ(count(R"({"name":"inner","ph":"B")"), 2);
+    EXPECT_EQ(count(R"({"name":"inner","ph":"E")"), 2);
+    EXPECT_EQ(count(pid + R"(,"tid":2})"), 6);
+
+    // traced scopes are still reported
+    Profiler::INSTANCE().report("traced", reportFile);
+    if (rank == 0)
+    {
+        auto const report = reportLines(reportFile);
+        ASSERT_EQ(report.size(), 4u);
+        EXPECT_EQ(report[1].rfind("outer (1)", 0), 0u);
+    }
+}
+
+
+
+TEST(ScopeProfiler, doesNotRecordWhenDisabled)
+{
+    Profiler::INSTANCE().disable();
+    outer(1);
+
+    Profiler::INSTANCE().enable();
+    Profiler::INSTANCE().report("disabled", reportFile + ".disabled");
+    Profiler::INSTANCE().disable();
+
+    if (PHARE::core::mpi::rank() == 0)
+    {
+        EXPECT_EQ(reportLines(reportFile + ".disabled").size(), 2u);
+    }
+}
+
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    auto const result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
+}
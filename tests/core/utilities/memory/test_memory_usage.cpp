@@ -0,0 +1,168 @@
+#include "gtest/gtest.h"
+
+#include "core/utilities/mpi_utils.hpp"
+#include "core/utilities/memory_usage.hpp"
+#include "core/data/particles/particle_array.hpp"
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+
+using namespace PHARE::core;
+
+
+
+namespace
+{
+ParticleArray<1> particlesInCells(std::size_t const nbrParticles, std::size_t const capacity)
+{
+    ParticleArray<1> particles{Box<int, 1>{{0}, {9}}};
+    particles.reserve(capacity);
+    for (std::size_t i = 0; i < nbrParticles; ++i)
+    {
+        Particle<1> particle;
+        particle.iCell = {static_cast<int>(i % 10)};
+        particles.emplace_back(std::move(particle));
+    }
+    return particles;
+}
+
+} // namespace
+
+
+
+TEST(MemoryUsage, ofParticleArrayCountsSizeAsUsedAndCapacityAsReserved)
+{
+    auto const particles = particlesInCells(20, 100);
+    auto const usage     = particles.memory_usage();
+
+    EXPECT_EQ(usage.used, 20 * sizeof(Particle<1>));
+    EXPECT_EQ(usage.reserved, particles.capacity() * sizeof(Particle<1>));
+    EXPECT_GE(usage.reserved, 100 * sizeof(Particle<1>));
+}
+
+
+TEST(MemoryUsage, ofCellMapCountsItsIndexesAndPerCellLists)
+{
+    auto const particles = particlesInCells(20, 20);
+    auto const usage     = particles.cellmap_memory_usage();
+
+    auto const lists = 10 * sizeof(Indexer);
+    EXPECT_EQ(usage.used, lists + 20 * sizeof(std::size_t));
+    EXPECT_GE(usage.reserved, usage.used);
+}
+
+
+TEST(LevelMemory, addsParticlesToTheirKindAndCellMapsToCellMaps)
+{
+    auto const domain = particlesInCells(20, 20);
+    auto const ghosts = particlesInCells(5, 5);
+
+    LevelMemory memory;
+    memory.addParticles(MemoryKind::domain_particles, domain);
+    memory.addParticles(MemoryKind::patch_ghost_particles, ghosts);
+
+    EXPECT_EQ(memory[MemoryKind::domain_particles].used, 20 * sizeof(Particle<1>));
+    EXPECT_EQ(memory[MemoryKind::patch_ghost_particles].used, 5 * sizeof(Particle<1>));
+    EXPECT_EQ(memory[MemoryKind::cellmaps].used,
+              domain.cellmap_memory_usage().used + ghosts.cellmap_memory_usage().used);
+    EXPECT_EQ(memory[MemoryKind::fields].used, 0u);
+
+    EXPECT_EQ(memory.total().used, memory[MemoryKind::domain_particles].used
+                                       + memory[MemoryKind::patch_ghost_particles].used
+                                       + memory[MemoryKind::cellmaps].used);
+}
+
+
+TEST(MemoryReport, keepsTheMaxOfEachEntry)
+{
+    MemoryReport peak, report;
+    peak.level(0)[MemoryKind::fields]                  = {10, 20};
+    report.level(0)[MemoryKind::fields]                = {15, 15};
+    report.level(1)[MemoryKind::level_ghost_particles] = {5, 8};
+
+    peak.keep_max(report);
+
+    ASSERT_EQ(peak.levels().size(), 2u);
+    EXPECT_EQ(peak.level(0)[MemoryKind::fields].used, 15u);
+    EXPECT_EQ(peak.level(0)[MemoryKind::fields].reserved, 20u);
+    EXPECT_EQ(peak.level(1)[MemoryKind::level_ghost_particles].reserved, 8u);
+}
+
+
+TEST(MemoryReport, reducesMinMaxAndSumOverRanksWithAbsentLevelsAsZero)
+{
+    auto const rank     = static_cast<std::size_t>(mpi::rank());
+    auto const nbrRanks = static_cast<std::size_t>(mpi::size());
+
+    MemoryReport report;
+    report.level(0)[MemoryKind::domain_particles] = {rank + 1, 2 * (rank + 1)};
+    if (rank == 0)
+        report.level(1)[MemoryKind::solver_scratch] = {7, 7};
+
+    auto const stats = report.reduce();
+
+    EXPECT_EQ(stats.nbrRanks, static_cast<int>(nbrRanks));
+    ASSERT_EQ(stats.sum.levels().size(), 2u);
+
+    auto const& min = stats.min.levels()[0][MemoryKind::domain_particles];
+    auto const& max = stats.max.levels()[0][MemoryKind::domain_particles];
+    auto const& sum = stats.sum.levels()[0][MemoryKind::domain_particles];
+    EXPECT_EQ(min.used, 1u);
+    EXPECT_EQ(max.used, nbrRanks);
+    EXPECT_EQ(sum.used, nbrRanks * (nbrRanks + 1) / 2);
+    EXPECT_EQ(sum.reserved, nbrRanks * (nbrRanks + 1));
+
+    auto const& scratchMin = stats.min.levels()[1][MemoryKind::solver_scratch];
+    auto const& scratchSum = stats.sum.levels()[1][MemoryKind::solver_scratch];
+    EXPECT_EQ(scratchMin.used, nbrRanks > 1 ? 0u : 7u);
+    EXPECT_EQ(scratchSum.used, 7u);
+
+    EXPECT_EQ(stats.total[2].used, sum.used + 7);
+    EXPECT_EQ(stats.total[1].used, std::max<std::size_t>(8, nbrRanks)); // rank 0 has 1 + 7
+    EXPECT_GT(stats.peakRSS[0], 0u);
+    EXPECT_LE(stats.peakRSS[1], stats.peakRSS[2]);
+}
+
+
+TEST(MemoryReport, isWrittenByRankZeroPerLevelAndKind)
+{
+    std::string const file = "memory_report/report.txt";
+    if (mpi::rank() == 0)
+        std::filesystem::remove_all("memory_report");
+    mpi::barrier();
+
+    MemoryReport report;
+    report.level(0)[MemoryKind::fields] = {1024 * 1024, 2 * 1024 * 1024};
+    auto const stats                    = report.reduce();
+
+    write(stats, stats, "test", file);
+
+    if (mpi::rank() == 0)
+    {
+        std::ifstream in{file};
+        std::vector<std::string> lines;
+        for (std::string line; std::getline(in, line);)
+            lines.push_back(line);
+
+        // title, level, one line per kind, all levels, peak RSS, empty line
+        ASSERT_EQ(lines.size(), 2 + nbrMemoryKinds + 3);
+        EXPECT_EQ(lines[0].rfind("# test, ", 0), 0u);
+        EXPECT_EQ(lines[1], "level 0");
+        EXPECT_NE(lines[2 + static_cast<std::size_t>(MemoryKind::fields)].find("fields"),
+                  std::string::npos);
+        EXPECT_EQ(lines[2 + nbrMemoryKinds].rfind("all levels", 0), 0u);
+    }
+}
+
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    auto const result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
+}
@@ -21,6 +21,21 @@ TYPED_TEST(Simulator1dTest, electromag)
     electromag_test(TypeParam{job_file}, out_dir);
 }
 
+TYPED_TEST(Simulator1dTest, performance)
+{
+    performance_test(TypeParam{job_file}, out_dir);
+}
+
+TYPED_TEST(Simulator1dTest, time_average)
+{
+    time_average_test(TypeParam{job_file}, out_dir);
+}
+
+TYPED_TEST(Simulator1dTest, distribution)
+{
+    distribution_test(TypeParam{job_file}, out_dir);
+}
+
 TYPED_TEST(Simulator1dTest, allFromPython)
 {
     allFromPython_test(TypeParam{job_file}, out_dir);
@@ -21,6 +21,21 @@ TYPED_TEST(Simulator2dTest, electromag)
     electromag_test(TypeParam{job_file}, out_dir);
 }
 
+TYPED_TEST(Simulator2dTest, performance)
+{
+    performance_test(TypeParam{job_file}, out_dir);
+}
+
+TYPED_TEST(Simulator2dTest, time_average)
+{
+    time_average_test(TypeParam{job_file}, out_dir);
+}
+
+TYPED_TEST(Simulator2dTest, distribution)
+{
+    distribution_test(TypeParam{job_file}, out_dir);
+}
+
 TYPED_TEST(Simulator2dTest, allFromPython)
 {
     allFromPython_test(TypeParam{job_file}, out_dir);
@@ -8,7 +8,11 @@
 #include "diagnostic/detail/types/electromag.hpp"
 #include "diagnostic/detail/types/particle.hpp"
 #include "diagnostic/detail/types/fluid.hpp"
+#include "diagnostic/detail/types/performance.hpp"
+#include "diagnostic/detail/types/time_average.hpp"
+#include "diagnostic/detail/types/distribution.hpp"
 
+#include <numeric>
 #include <functional>
 
 
@@ -77,6 +81,20 @@ struct Hi5Diagnostic
     auto electromag(std::string&& type) { return dict("electromag", type); }
     auto particles(std::string&& type) { return dict("particle", type); }
     auto fluid(std::string&& type) { return dict("fluid", type); }
+    auto performance(std::string&& type) { return dict("performance", type); }
+    auto time_average(std::string&& type) { return dict("time_average", type); }
+
+    // per coarse cell, with ranges wide enough to hold all particles
+    auto distribution(std::string&& type)
+    {
+        auto params      = dict("distribution", type);
+        params["axes"]   = std::string{"vx,vperp"};
+        params["bins"]   = std::vector<int>{4, 3};
+        params["ranges"] = std::vector<double>{-1e10, 1e10, 0, 1e10};
+        params["boxes"]  = std::vector<double>{};
+        params["level"]  = std::size_t{0};
+        return params;
+    }
 
     // timestamp is constant precision of 10 places
     std::string getPatchPath(int level, std::string patch, std::string timestamp = "0.0000000000")
@@ -220,6 +238,125 @@ void validateParticleDump(Simulator& sim, Hi5Diagnostic& hi5)
 }
 
 
+template<typename Simulator, typename Hi5Diagnostic>
+void validatePerformanceDump(Simulator& sim, Hi5Diagnostic& hi5)
+{
+    using GridLayout         = typename Simulator::PHARETypes::GridLayout_t;
+    constexpr auto dimension = Simulator::dimension;
+
+    auto& hybridModel = *sim.getHybridModel();
+
+    auto loadFile     = hi5.writer.makeFile(hi5.writer.fileString("/patch_load"), hi5.flags_);
+    auto workloadFile = hi5.writer.makeFile(hi5.writer.fileString("/workload"), hi5.flags_);
+
+    auto visit = [&](GridLayout& grid, std::string patchID, std::size_t iLevel) {
+        auto path = hi5.getPatchPath(iLevel, patchID);
+
+        std::size_t particles = 0;
+        for (auto& pop : hybridModel.state.ions)
+        {
+            auto const domain = pop.domainParticles().size();
+            auto const ghosts
+                = pop.patchGhostParticles().size() + pop.levelGhostParticles().size();
+            EXPECT_EQ(domain, loadFile->template read_attribute<std::size_t>(
+                                  path, pop.name() + "_particle_count"));
+            EXPECT_EQ(ghosts, loadFile->template read_attribute<std::size_t>(
+                                  path, pop.name() + "_ghost_particle_count"));
+            particles += domain;
+        }
+        EXPECT_EQ(particles, loadFile->template read_attribute<std::size_t>(path, "particle_count"));
+        EXPECT_GE(loadFile->template read_attribute<double>(path, "compute_time"), 0.);
+
+        // domain particles are all in the patch cells
+        auto const workload
+            = workloadFile->template read_data_set_flat<double, dimension>(path + "/workload");
+        EXPECT_EQ(workload.size(), grid.AMRBox().size());
+        EXPECT_EQ(std::accumulate(workload.begin(), workload.end(), 0.), particles);
+    };
+
+    PHARE::amr::visitHierarchy<GridLayout>(*sim.hierarchy, *hybridModel.resourcesManager, visit, 0,
+                                           sim.hierarchy->getNumberOfLevels(), hybridModel);
+}
+
+
+template<typename Simulator, typename Hi5Diagnostic>
+void validateTimeAverageDump(Simulator& sim, Hi5Diagnostic& hi5)
+{
+    using GridLayout = typename Simulator::PHARETypes::GridLayout_t;
+
+    auto& hybridModel = *sim.getHybridModel();
+    auto& ions        = hybridModel.state.ions;
+
+    // a single sample was taken at the dump time, averages are the current values
+    auto checkFile = [&](std::string const& quantity, auto&& check) {
+        auto hifile = hi5.writer.makeFile(hi5.writer.fileString("/time_average/" + quantity),
+                                          hi5.flags_);
+        EXPECT_EQ(1u, hifile->template read_attribute<std::size_t>("/t/0.0000000000",
+                                                                   "nbr_samples"));
+        check(*hifile);
+    };
+
+    auto visit = [&](GridLayout& layout, std::string patchID, std::size_t iLevel) {
+        auto path = hi5.getPatchPath(iLevel, patchID) + "/";
+        checkFile("EM_B", [&](auto& file) {
+            checkVecField(file, layout, hybridModel.state.electromag.B, path + "EM_B");
+        });
+        checkFile("EM_E", [&](auto& file) {
+            checkVecField(file, layout, hybridModel.state.electromag.E, path + "EM_E");
+        });
+        checkFile("density", [&](auto& file) {
+            checkField(file, layout, ions.density(), path + "density", FieldDomainFilter{});
+        });
+        checkFile("bulkVelocity", [&](auto& file) {
+            checkVecField(file, layout, ions.velocity(), path + "bulkVelocity",
+                          FieldDomainFilter{});
+        });
+
+        // the next average starts over
+        for (auto* sum : hybridModel.timeAverages.sums("EM_B"))
+            EXPECT_TRUE(std::all_of(sum->begin(), sum->end(), [](auto v) { return v == 0; }));
+    };
+
+    PHARE::amr::visitHierarchy<GridLayout>(*sim.hierarchy, *hybridModel.resourcesManager, visit, 0,
+                                           sim.hierarchy->getNumberOfLevels(), hybridModel);
+    for (auto const& quantity : hybridModel.timeAverages.quantities())
+        EXPECT_EQ(0u, hybridModel.timeAverages.nbrSamples(quantity));
+}
+
+
+template<typename Simulator, typename Hi5Diagnostic>
+void validateDistributionDump(Simulator& sim, Hi5Diagnostic& hi5)
+{
+    using GridLayout = typename Simulator::PHARETypes::GridLayout_t;
+
+    auto& hybridModel = *sim.getHybridModel();
+
+    for (auto& pop : hybridModel.state.ions)
+    {
+        double weights = 0;
+        auto visit     = [&](GridLayout&, std::string, std::size_t) {
+            for (auto const& particle : pop.domainParticles())
+                weights += particle.weight;
+        };
+        PHARE::amr::visitHierarchy<GridLayout>(*sim.hierarchy, *hybridModel.resourcesManager,
+                                               visit, 0, 0, hybridModel);
+        weights = core::mpi::sum(std::vector<double>{weights})[0];
+
+        auto const quantity = "/ions/pop/" + pop.name() + "/distribution/all";
+        auto hifile = hi5.writer.makeFile(hi5.writer.fileString(quantity), hi5.flags_);
+        auto const counts
+            = hifile->template read_data_set_flat<double>("/t/0.0000000000/histogram");
+
+        std::size_t nbrCells = 1;
+        for (auto const upper : hi5.modelView.domainBox())
+            nbrCells *= upper + 1;
+        EXPECT_EQ(counts.size(), nbrCells * 4 * 3);
+        EXPECT_NEAR(std::accumulate(counts.begin(), counts.end(), 0.), weights, 1e-8 * weights);
+        EXPECT_EQ("vx,vperp", hifile->template read_attribute<std::string>("/", "axes"));
+    }
+}
+
+
 template<typename Simulator, typename Hi5Diagnostic>
 void validateAttributes(Simulator& sim, Hi5Diagnostic& hi5)
 {
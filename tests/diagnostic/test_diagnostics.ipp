@@ -77,6 +77,74 @@ void particles_test(Simulator&& sim, std::string out_dir)
 }
 
 
+template<typename Simulator>
+void performance_test(Simulator&& sim, std::string out_dir)
+{
+    using HybridModel = typename Simulator::HybridModel;
+    using Hierarchy   = typename Simulator::Hierarchy;
+
+    auto& hybridModel = *sim.getHybridModel();
+    auto& hierarchy   = *sim.hierarchy;
+
+    { // scoped to destruct after dump
+        Hi5Diagnostic<Hierarchy, HybridModel> hi5{hierarchy, hybridModel, out_dir, NEW_HI5_FILE};
+        hi5.dMan.addDiagDict(hi5.performance("/patch_load"))
+            .addDiagDict(hi5.performance("/workload"));
+        hi5.dump();
+    }
+
+    Hi5Diagnostic<Hierarchy, HybridModel> hi5{hierarchy, hybridModel, out_dir,
+                                              HighFive::File::ReadOnly};
+    validatePerformanceDump(sim, hi5);
+}
+
+
+template<typename Simulator>
+void time_average_test(Simulator&& sim, std::string out_dir)
+{
+    using HybridModel = typename Simulator::HybridModel;
+    using Hierarchy   = typename Simulator::Hierarchy;
+
+    auto& hybridModel = *sim.getHybridModel();
+    auto& hierarchy   = *sim.hierarchy;
+
+    { // scoped to destruct after dump
+        Hi5Diagnostic<Hierarchy, HybridModel> hi5{hierarchy, hybridModel, out_dir, NEW_HI5_FILE};
+        hi5.dMan.addDiagDict(hi5.time_average("/time_average/EM_B"))
+            .addDiagDict(hi5.time_average("/time_average/EM_E"))
+            .addDiagDict(hi5.time_average("/time_average/density"))
+            .addDiagDict(hi5.time_average("/time_average/bulkVelocity"));
+        hi5.dump();
+    }
+
+    Hi5Diagnostic<Hierarchy, HybridModel> hi5{hierarchy, hybridModel, out_dir,
+                                              HighFive::File::ReadOnly};
+    validateTimeAverageDump(sim, hi5);
+}
+
+
+template<typename Simulator>
+void distribution_test(Simulator&& sim, std::string out_dir)
+{
+    using HybridModel = typename Simulator::HybridModel;
+    using Hierarchy   = typename Simulator::Hierarchy;
+
+    auto& hybridModel = *sim.getHybridModel();
+    auto& hierarchy   = *sim.hierarchy;
+
+    { // scoped to destruct after dump
+        Hi5Diagnostic<Hierarchy, HybridModel> hi5{hierarchy, hybridModel, out_dir, NEW_HI5_FILE};
+        for (auto& pop : hybridModel.state.ions)
+            hi5.dMan.addDiagDict(hi5.distribution("/ions/pop/" + pop.name() + "/distribution/all"));
+        hi5.dump();
+    }
+
+    Hi5Diagnostic<Hierarchy, HybridModel> hi5{hierarchy, hybridModel, out_dir,
+                                              HighFive::File::ReadOnly};
+    validateDistributionDump(sim, hi5);
+}
+
+
 template<typename Simulator>
 void allFromPython_test(Simulator&& sim, std::string out_dir)
 {
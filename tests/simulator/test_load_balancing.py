@@ -254,6 +254,25 @@ class LoadBalancingTest(SimulatorTest):
             tend_sdev = np.std(list(time_info(diag_dir, timestamps[-1]).values()))
             self.assertGreater(tend_sdev, t0_sdev * 0.1)  # empirical
 
+    def test_initial_partition_balances_the_loaded_particles(self):
+        if mpi_size == 1:  # doesn't make sense
+            return
+
+        not_dir = self.run_sim(
+            self.unique_diag_dir_for_test_case(diag_outputs + "/not", ndim, interp)
+        )
+        is_dir = self.run_sim(
+            self.unique_diag_dir_for_test_case(diag_outputs, ndim, interp),
+            dict(
+                active=True, mode="nppc", on_init=False, every=0, initial_partition=True
+            ),
+        )
+
+        if cpp.mpi_rank() == 0:
+            not_sdev = np.std(list(time_info(not_dir).values()))
+            is_sdev = np.std(list(time_info(is_dir).values()))
+            self.assertLess(is_sdev, not_sdev)
+
     @unittest.skip("should change with moments")
     def test_compare_is_and_is_not_balanced(self):
         if mpi_size == 1:  # doesn't make sense
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+#
+# formatted with black
+
+# a static plasma (no velocity, no electron pressure, uniform B) does not move, and a
+# static density bump keeps the refined boxes the same from one regrid to the next,
+# so that regridded levels only have unchanged patches which take the data of the
+# old level ones. Their particles must be exactly the ones they had before the regrid.
+
+import unittest
+import numpy as np
+
+import pyphare.pharein as ph
+from pyphare.cpp import cpp_lib
+from pyphare.pharesee.particles import Particles
+from pyphare.simulator.simulator import Simulator, startMPI
+
+from tests.simulator import SimulatorTest
+
+cpp = cpp_lib()
+startMPI()
+
+time_step_nbr = 3
+time_step = 0.001
+
+
+def config(interp):
+    sim = ph.Simulation(
+        time_step_nbr=time_step_nbr,
+        time_step=time_step,
+        cells=60,
+        dl=0.2,
+        interp_order=interp,
+        refinement="tagging",
+        max_nbr_levels=2,
+        tagging_criteria="density",
+        tagging_threshold=0.1,
+    )
+
+    def density(x):
+        L = sim.simulation_domain()[0]
+        return 1.0 + np.exp(-(((x - 0.5 * L) / 0.5) ** 2))
+
+    def zero(x):
+        return 0.0
+
+    def one(x):
+        return 1.0
+
+    ph.MaxwellianFluidModel(
+        bx=one,
+        by=zero,
+        bz=zero,
+        protons={
+            "charge": 1,
+            "density": density,
+            "vbulkx": zero,
+            "vbulky": zero,
+            "vbulkz": zero,
+            "vthx": zero,
+            "vthy": zero,
+            "vthz": zero,
+            "nbr_part_per_cell": 20,
+        },
+    )
+    ph.ElectronModel(closure="isothermal", Te=0.0)
+    return sim
+
+
+def particles_per_box(simulator, ilvl, quantity, pop="protons"):
+    level = simulator.data_wrangler().getPatchLevel(ilvl)
+    patches = level.getParticles(pop)[pop].get(quantity, [])
+
+    def particles(data):
+        return Particles(
+            icells=np.asarray(data.iCell),
+            deltas=np.asarray(data.delta),
+            v=np.asarray(data.v).reshape(-1, 3),
+            weights=np.asarray(data.weight),
+            charges=np.asarray(data.charge),
+        )
+
+    return {
+        (tuple(patch.lower), tuple(patch.upper)): particles(patch.data)
+        for patch in patches
+    }
+
+
+class RegridTest(SimulatorTest):
+    simulator = None
+
+    def tearDown(self):
+        ph.global_vars.sim = None
+        if self.simulator is not None:
+            self.simulator.reset()
+        self.simulator = None
+
+    def test_unchanged_patches_keep_their_particles(self):
+        for interp in [1, 2, 3]:
+            ph.global_vars.sim = None
+            self.simulator = Simulator(config(interp)).initialize()
+            self.assertEqual(2, self.simulator.data_wrangler().getNumberOfLevels())
+
+            quantities = ["domain", "patchGhost", "levelGhost"]
+            initial = {
+                qty: particles_per_box(self.simulator, 1, qty) for qty in quantities
+            }
+            self.assertGreater(len(initial["domain"]), 0)
+
+            for _ in range(time_step_nbr):
+                self.simulator.advance()
+
+                for qty in quantities:
+                    current = particles_per_box(self.simulator, 1, qty)
+                    self.assertEqual(initial[qty].keys(), current.keys())
+                    for box, particles in current.items():
+                        self.assertEqual(initial[qty][box], particles)
+
+            self.simulator.reset()
+            self.simulator = None
+
+
+if __name__ == "__main__":
+    unittest.main()
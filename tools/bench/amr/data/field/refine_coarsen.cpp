@@ -0,0 +1,116 @@
+#include "tools/bench/core/bench.hpp"
+
+#include "amr/data/field/refine/field_refiner.hpp"
+#include "amr/data/field/coarsening/default_field_coarsener.hpp"
+#include "amr/utilities/box/amr_box.hpp"
+
+#include "core/data/grid/grid.hpp"
+#include "core/data/ndarray/ndarray_vector.hpp"
+
+#include "phare/phare.hpp" // samrai lifecycle
+
+// ratio 2 refinement and coarsening of a field of the same centering in all directions,
+// on boxes like those of tests/amr/data/field/refine and coarsening
+namespace PHARE::amr::bench
+{
+template<std::size_t dim>
+using Grid_t = core::Grid<core::NdArrayVector<dim>, core::HybridQuantity::Scalar>;
+
+template<std::size_t dim>
+auto box(int lower, int upper)
+{
+    return SAMRAI::hier::Box{Box<int, dim>{core::ConstArray<int, dim>(lower),
+                                           core::ConstArray<int, dim>(upper)}};
+}
+
+template<std::size_t dim>
+auto grid(std::string const& name, std::uint32_t const size)
+{
+    return Grid_t<dim>{name, core::HybridQuantity::Scalar::rho,
+                       core::ConstArray<std::uint32_t, dim>(size)};
+}
+
+template<std::size_t dim, typename Fn>
+void for_each_index(int const lower, int const upper, Fn&& fn)
+{
+    for (auto const& index : Box<int, dim>{core::ConstArray<int, dim>(lower),
+                                           core::ConstArray<int, dim>(upper)})
+        fn(core::Point<int, dim>{index});
+}
+
+template<std::size_t dim>
+constexpr int cells()
+{
+    return dim == 3 ? 32 : (dim == 2 ? 256 : 4096);
+}
+
+
+template<std::size_t dim, core::QtyCentering centering>
+void refine(benchmark::State& state)
+{
+    constexpr int fineCells = cells<dim>();
+
+    // coarse data covers the fine box with one more coarse node on each side
+    auto const fineBox   = box<dim>(0, fineCells - 1);
+    auto const coarseBox = box<dim>(-1, fineCells / 2 + 1);
+    auto coarse          = grid<dim>("coarse", fineCells / 2 + 3);
+    auto fine            = grid<dim>("fine", fineCells);
+    std::fill(coarse.begin(), coarse.end(), 1.);
+
+    DefaultFieldRefiner<dim> refiner{core::ConstArray<core::QtyCentering, dim>(centering),
+                                     fineBox, coarseBox,
+                                     SAMRAI::hier::IntVector{SAMRAI::tbox::Dimension{dim}, 2}};
+
+    while (state.KeepRunning())
+        for_each_index<dim>(0, fineCells - 1,
+                            [&](auto const& fineIndex) { refiner(coarse, fine, fineIndex); });
+}
+
+
+template<std::size_t dim, core::QtyCentering centering>
+void coarsen(benchmark::State& state)
+{
+    constexpr int coarseCells = cells<dim>() / 2;
+
+    // fine data covers the coarse box with one more fine node on each side
+    auto const coarseBox = box<dim>(0, coarseCells - 1);
+    auto const fineBox   = box<dim>(-1, 2 * coarseCells);
+    auto fine            = grid<dim>("fine", 2 * coarseCells + 2);
+    auto coarse          = grid<dim>("coarse", coarseCells);
+    std::fill(fine.begin(), fine.end(), 1.);
+
+    DefaultFieldCoarsener<dim> coarsener{core::ConstArray<core::QtyCentering, dim>(centering),
+                                         fineBox, coarseBox,
+                                         SAMRAI::hier::IntVector{SAMRAI::tbox::Dimension{dim}, 2}};
+
+    while (state.KeepRunning())
+        for_each_index<dim>(0, coarseCells - 1, [&](auto const& coarseIndex) {
+            coarsener(fine, coarse, coarseIndex);
+        });
+}
+
+using core::QtyCentering;
+
+BENCHMARK_TEMPLATE(refine, 1, QtyCentering::primal)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(refine, 1, QtyCentering::dual)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(refine, 2, QtyCentering::primal)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(refine, 2, QtyCentering::dual)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(refine, 3, QtyCentering::primal)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(refine, 3, QtyCentering::dual)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(coarsen, 1, QtyCentering::primal)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(coarsen, 1, QtyCentering::dual)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(coarsen, 2, QtyCentering::primal)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(coarsen, 2, QtyCentering::dual)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(coarsen, 3, QtyCentering::primal)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(coarsen, 3, QtyCentering::dual)->Unit(benchmark::kMicrosecond);
+
+} // namespace PHARE::amr::bench
+
+int main(int argc, char** argv)
+{
+    PHARE::SamraiLifeCycle samsam(argc, argv);
+
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
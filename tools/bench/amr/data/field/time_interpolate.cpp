@@ -0,0 +1,78 @@
+#include "tools/bench/core/bench.hpp"
+
+#include "amr/data/field/time_interpolate/field_linear_time_interpolate.hpp"
+#include "amr/utilities/box/amr_box.hpp"
+
+#include "core/data/grid/grid.hpp"
+#include "core/data/ndarray/ndarray_vector.hpp"
+
+#include "phare/phare.hpp" // samrai lifecycle
+
+// linear time interpolation of a field on a whole patch between its old and new values,
+// as for the level ghosts of a fine level between two coarse time steps
+namespace PHARE::amr::bench
+{
+template<std::size_t dim, std::size_t interp>
+void time_interpolate(benchmark::State& state)
+{
+    using GridLayout_t = core::GridLayout<core::GridLayoutImplYee<dim, interp>>;
+    using Grid_t       = core::Grid<core::NdArrayVector<dim>, core::HybridQuantity::Scalar>;
+    using FieldData_t  = FieldData<GridLayout_t, Grid_t>;
+
+    auto const cells = static_cast<std::uint32_t>(state.range(0));
+    auto const qty   = core::HybridQuantity::Scalar::Bx;
+
+    SAMRAI::tbox::Dimension const dimension{dim};
+    SAMRAI::hier::Box const domain{SAMRAI::hier::Index{dimension, 0},
+                                   SAMRAI::hier::Index{dimension, static_cast<int>(cells) - 1},
+                                   SAMRAI::hier::BlockId{0}};
+    SAMRAI::hier::IntVector const ghost{dimension, 5};
+    GridLayout_t const layout{core::ConstArray<double, dim>(1. / cells),
+                              core::ConstArray<std::uint32_t, dim>(cells),
+                              core::Point<double, dim>{core::ConstArray<double, dim>(0)},
+                              Box<int, dim>{domain}};
+
+    FieldData_t srcOld{domain, ghost, "Bx", layout, qty};
+    FieldData_t srcNew{domain, ghost, "Bx", layout, qty};
+    FieldData_t dest{domain, ghost, "Bx", layout, qty};
+    std::fill(srcNew.field.begin(), srcNew.field.end(), 1.);
+    srcOld.setTime(0.);
+    srcNew.setTime(1.);
+    dest.setTime(.5);
+
+    FieldLinearTimeInterpolate<GridLayout_t, Grid_t> timeOp;
+    SAMRAI::hier::Transformation const zeroTransformation{
+        SAMRAI::hier::Transformation::NO_ROTATE, SAMRAI::hier::IntVector::getZero(dimension),
+        SAMRAI::hier::BlockId(0), SAMRAI::hier::BlockId(0)};
+    FieldOverlap const overlap{SAMRAI::hier::BoxContainer{}, zeroTransformation};
+
+    while (state.KeepRunning())
+    {
+        timeOp.timeInterpolate(dest, domain, overlap, srcOld, srcNew);
+        benchmark::DoNotOptimize(dest.field.data());
+    }
+}
+
+using core::bench::cells_args;
+
+BENCHMARK_TEMPLATE(time_interpolate, 1, 1)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(time_interpolate, 1, 2)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(time_interpolate, 1, 3)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(time_interpolate, 2, 1)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(time_interpolate, 2, 2)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(time_interpolate, 2, 3)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(time_interpolate, 3, 1)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(time_interpolate, 3, 2)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(time_interpolate, 3, 3)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+
+} // namespace PHARE::amr::bench
+
+int main(int argc, char** argv)
+{
+    PHARE::SamraiLifeCycle samsam(argc, argv);
+
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
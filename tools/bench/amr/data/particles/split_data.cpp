@@ -0,0 +1,73 @@
+#include "tools/bench/core/bench.hpp"
+
+#include "amr/data/particles/refine/split.hpp"
+
+#include <vector>
+
+template<std::size_t dim, std::size_t interp, std::size_t nbRefinedPart>
+void split(benchmark::State& state)
+{
+    constexpr std::uint32_t cells   = 30;
+    constexpr std::uint32_t n_parts = 1e6;
+
+    using Splitter_t
+        = PHARE::amr::Splitter<PHARE::core::DimConst<dim>, PHARE::core::InterpConst<interp>,
+                               PHARE::core::RefinedParticlesConst<nbRefinedPart>>;
+    using Particle_t = PHARE::core::Particle<dim>;
+
+    Splitter_t splitter;
+    auto particles = PHARE::core::bench::make_particles<dim>(n_parts);
+    PHARE::core::bench::disperse(particles, 0, cells - 1, 1337);
+
+    std::vector<Particle_t> refinedParticles;
+
+    while (state.KeepRunning())
+    {
+        splitter.splitBatch(particles, refinedParticles);
+        benchmark::DoNotOptimize(refinedParticles.data());
+    }
+}
+
+BENCHMARK_TEMPLATE(split, 1, 1, 2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 1, 1, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 1, 2, 2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 1, 2, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 1, 2, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 1, 3, 2)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 1, 3, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 1, 3, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 1, 3, 5)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(split, 2, 1, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 1, 5)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 1, 8)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 1, 9)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 2, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 2, 5)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 2, 8)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 2, 9)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 2, 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 3, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 3, 5)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 3, 8)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 3, 9)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 2, 3, 25)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(split, 3, 1, 6)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 3, 1, 8)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 3, 1, 12)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 3, 1, 27)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 3, 2, 6)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 3, 2, 8)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 3, 2, 12)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 3, 2, 27)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 3, 3, 6)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 3, 3, 8)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 3, 3, 12)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(split, 3, 3, 27)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
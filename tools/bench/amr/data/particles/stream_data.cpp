@@ -0,0 +1,109 @@
+#include "tools/bench/core/bench.hpp"
+
+#include "amr/data/particles/particles_data.hpp"
+
+#include "amr/utilities/box/amr_box.hpp"
+
+#include "phare/phare.hpp" // samrai lifecycle
+
+#include <SAMRAI/pdat/CellGeometry.h>
+#include <SAMRAI/tbox/MessageStream.h>
+
+// packStream of the particles of a patch in the ghost layer of its neighbour along x,
+// and unpackStream of them in the neighbour, as for the patch ghost particles exchange
+namespace PHARE::amr::bench
+{
+template<std::size_t dim>
+struct StreamData
+{
+    using ParticlesData_t = ParticlesData<core::ParticleArray<dim>>;
+
+    static auto box(int const lowerX, int const cells)
+    {
+        auto lower = core::ConstArray<int, dim>(0);
+        auto upper = core::ConstArray<int, dim>(cells - 1);
+        lower[0] += lowerX;
+        upper[0] += lowerX;
+        return Box<int, dim>{lower, upper};
+    }
+
+    StreamData(int const cells, std::size_t const ppc)
+        : destDomain{box(0, cells)}
+        , sourceDomain{box(cells, cells)}
+        , destData{destDomain, ghost, "particles"}
+        , sourceData{sourceDomain, ghost, "particles"}
+    {
+        sourceData.domainParticles.vector()
+            = core::bench::make_particles<dim>(ppc, Box<int, dim>{sourceDomain}, 1337).vector();
+    }
+
+    SAMRAI::tbox::Dimension dimension{dim};
+    SAMRAI::hier::IntVector ghost{SAMRAI::hier::IntVector::getOne(dimension)};
+
+    SAMRAI::hier::Box destDomain, sourceDomain;
+    ParticlesData_t destData, sourceData;
+
+    SAMRAI::pdat::CellGeometry destGeom{destDomain, ghost};
+    SAMRAI::pdat::CellGeometry sourceGeom{sourceDomain, ghost};
+
+    SAMRAI::hier::Transformation transformation{SAMRAI::hier::IntVector::getZero(dimension)};
+
+    std::shared_ptr<SAMRAI::hier::BoxOverlap> overlap{
+        destGeom.calculateOverlap(sourceGeom, sourceData.getGhostBox(), destData.getGhostBox(),
+                                  /*overwriteInterior=*/true, transformation)};
+};
+
+
+template<std::size_t dim>
+void pack_stream(benchmark::State& state)
+{
+    StreamData<dim> data{static_cast<int>(state.range(0)),
+                         static_cast<std::size_t>(state.range(1))};
+
+    while (state.KeepRunning())
+    {
+        SAMRAI::tbox::MessageStream stream;
+        data.sourceData.packStream(stream, *data.overlap);
+        benchmark::DoNotOptimize(stream.getBufferStart());
+    }
+}
+
+template<std::size_t dim>
+void unpack_stream(benchmark::State& state)
+{
+    StreamData<dim> data{static_cast<int>(state.range(0)),
+                         static_cast<std::size_t>(state.range(1))};
+
+    SAMRAI::tbox::MessageStream packed;
+    data.sourceData.packStream(packed, *data.overlap);
+
+    while (state.KeepRunning())
+    {
+        data.destData.patchGhostParticles.clear();
+        SAMRAI::tbox::MessageStream stream{packed.getCurrentSize(),
+                                           SAMRAI::tbox::MessageStream::Read,
+                                           packed.getBufferStart()};
+        data.destData.unpackStream(stream, *data.overlap);
+    }
+    state.SetItemsProcessed(state.iterations() * data.destData.patchGhostParticles.size());
+}
+
+using core::bench::cells_ppc_args;
+
+BENCHMARK_TEMPLATE(pack_stream, 1)->Apply(cells_ppc_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(pack_stream, 2)->Apply(cells_ppc_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(pack_stream, 3)->Apply(cells_ppc_args<3>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(unpack_stream, 1)->Apply(cells_ppc_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(unpack_stream, 2)->Apply(cells_ppc_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(unpack_stream, 3)->Apply(cells_ppc_args<3>)->Unit(benchmark::kMicrosecond);
+
+} // namespace PHARE::amr::bench
+
+int main(int argc, char** argv)
+{
+    PHARE::SamraiLifeCycle samsam(argc, argv);
+
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -103,6 +103,41 @@ auto make_particles(std::size_t ppc, Box disperse_in, std::optional<int> seed =
 
 
 
+// patch sizes, in cells per direction, and particles per cell of the kernel benchmarks
+// so that a patch of each dimension holds roughly the same number of cells
+template<std::size_t dim>
+std::vector<std::int64_t> patch_cells()
+{
+    if constexpr (dim == 1)
+        return {100, 1000};
+    else if constexpr (dim == 2)
+        return {25, 100};
+    else
+        return {10, 25};
+}
+
+inline std::vector<std::int64_t> const particles_per_cell{10, 100};
+
+
+// state.range(0) is the number of cells per direction
+template<std::size_t dim>
+void cells_args(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("cells");
+    for (auto const cells : patch_cells<dim>())
+        b->Arg(cells);
+}
+
+// state.range(0) is the number of cells per direction, state.range(1) the particles per cell
+template<std::size_t dim>
+void cells_ppc_args(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"cells", "ppc"});
+    b->ArgsProduct({patch_cells<dim>(), particles_per_cell});
+}
+
+
+
 } // namespace PHARE::core::bench
 
 
@@ -0,0 +1,107 @@
+#include "tools/bench/core/bench.hpp"
+#include "core/data/electrons/electrons.hpp"
+#include "tests/core/data/gridlayout/test_gridlayout.hpp"
+#include "tests/core/data/ion_population/test_ion_population_fixtures.hpp"
+
+using namespace PHARE;
+
+// ions moments from the populations moments, then electrons moments from the ions and J,
+// as done by the solver after the particles are pushed and deposited
+template<std::size_t dim, std::size_t interp>
+struct Moments
+{
+    using PHARE_Types   = core::PHARE_Types<dim, interp>;
+    using GridLayout_t  = TestGridLayout<typename PHARE_Types::GridLayout_t>;
+    using ParticleArray = typename PHARE_Types::ParticleArray_t;
+    using Ions          = core::UsableIons_t<ParticleArray, interp>;
+    using IonsView      = std::decay_t<decltype(std::declval<Ions&>().view())>;
+    using Electrons     = core::Electrons<IonsView>;
+
+    static auto electrons_dict()
+    {
+        initializer::PHAREDict dict;
+        dict["pressure_closure"]["name"] = std::string{"isothermal"};
+        dict["pressure_closure"]["Te"]   = 0.12;
+        return dict;
+    }
+
+    Moments(std::uint32_t const cells)
+        : layout{cells}
+        , ions{layout, "protons"}
+        , J{"J", layout, core::HybridQuantity::Vector::J}
+        , Ve{"StandardHybridElectronFluxComputer_Ve", layout, core::HybridQuantity::Vector::V}
+        , Pe{"Pe", core::HybridQuantity::Scalar::P,
+             layout.allocSize(core::HybridQuantity::Scalar::P)}
+        , electrons{electrons_dict(), *ions, J}
+    {
+        auto&& model   = std::get<0>(electrons.getCompileTimeResourcesViewList());
+        auto&& flux    = std::get<0>(model.getCompileTimeResourcesViewList());
+        auto&& closure = std::get<1>(model.getCompileTimeResourcesViewList());
+        Ve.set_on(std::get<0>(flux.getCompileTimeResourcesViewList()));
+        std::get<1>(closure.getCompileTimeResourcesViewList()).setBuffer(&Pe);
+
+        auto& pop = ions.populations[0];
+        std::fill(pop.rho.begin(), pop.rho.end(), 1.);
+        for (auto& component : pop.F)
+            std::fill(component.begin(), component.end(), 1e-2);
+    }
+
+    GridLayout_t layout;
+    Ions ions;
+    core::UsableVecField<dim> J, Ve;
+    typename PHARE_Types::Grid_t Pe;
+    Electrons electrons;
+};
+
+
+template<std::size_t dim, std::size_t interp>
+void ion_moments(benchmark::State& state)
+{
+    Moments<dim, interp> moments{static_cast<std::uint32_t>(state.range(0))};
+
+    while (state.KeepRunning())
+    {
+        moments.ions.computeDensity();
+        moments.ions.computeBulkVelocity();
+        benchmark::DoNotOptimize(moments.ions.Vi[0].data());
+    }
+}
+
+template<std::size_t dim, std::size_t interp>
+void electron_moments(benchmark::State& state)
+{
+    Moments<dim, interp> moments{static_cast<std::uint32_t>(state.range(0))};
+    moments.ions.computeDensity();
+    moments.ions.computeBulkVelocity();
+
+    while (state.KeepRunning())
+    {
+        moments.electrons.update(moments.layout);
+        benchmark::DoNotOptimize(moments.Pe.data());
+    }
+}
+
+using core::bench::cells_args;
+
+// ions moments do not depend on the interpolation order
+BENCHMARK_TEMPLATE(ion_moments, 1, 1)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ion_moments, 2, 1)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ion_moments, 3, 1)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(electron_moments, 1, 1)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(electron_moments, 1, 2)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(electron_moments, 1, 3)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(electron_moments, 2, 1)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(electron_moments, 2, 2)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(electron_moments, 2, 3)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(electron_moments, 3, 1)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(electron_moments, 3, 2)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(electron_moments, 3, 3)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,180 @@
+#include "tools/bench/core/mini_app/mini_app.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+/*
+  ./phare_mini_app --dim 2 --interp 1 --cells 64 --ppc 100 --steps 10 [--json out.json]
+
+  runs the PPC cycle on one periodic patch and reports the particles pushed per second and the
+  time spent in each stage. Other options: --dt, --dl, --seed, --tile_size,
+  --interleaved_gather 0|1, --deferred_cellmap 0|1, --pusher
+*/
+
+namespace PHARE::core::mini_app
+{
+struct Arguments
+{
+    std::size_t dim    = 1;
+    std::size_t interp = 1;
+    std::string json;
+    Options options;
+};
+
+Arguments parse(int argc, char** argv)
+{
+    std::unordered_map<std::string, std::string> values;
+    for (int i = 1; i < argc; i += 2)
+    {
+        std::string const key = argv[i];
+        if (key.rfind("--", 0) != 0 or i + 1 == argc)
+            throw std::runtime_error("expected --key value, got " + key);
+        values[key.substr(2)] = argv[i + 1];
+    }
+
+    Arguments args;
+    auto set = [&](std::string const& key, auto& value) {
+        if (auto it = values.find(key); it != values.end())
+        {
+            std::istringstream stream{it->second};
+            if (!(stream >> value))
+                throw std::runtime_error("invalid value for --" + key + ": " + it->second);
+            values.erase(it);
+        }
+    };
+    set("dim", args.dim);
+    set("interp", args.interp);
+    set("json", args.json);
+    set("cells", args.options.cells);
+    set("ppc", args.options.ppc);
+    set("steps", args.options.steps);
+    set("dt", args.options.dt);
+    set("dl", args.options.dl);
+    set("seed", args.options.seed);
+    set("tile_size", args.options.tileSize);
+    set("interleaved_gather", args.options.interleavedGather);
+    set("deferred_cellmap", args.options.deferredCellmap);
+    set("pusher", args.options.pusher_name);
+
+    if (!values.empty())
+        throw std::runtime_error("unknown option --" + values.begin()->first);
+    return args;
+}
+
+
+template<std::size_t dim, std::size_t interp>
+void run(Arguments const& args)
+{
+    MiniApp<dim, interp> app{args.options};
+
+    auto const& layout = app.layout();
+    auto const cells   = layout.nbrCells();
+    auto const steps   = args.options.steps;
+
+    std::size_t pushed = 0;
+    for (std::size_t step = 0; step < steps; ++step)
+    {
+        pushed += 2 * app.nbrParticles(); // both ion pushes of the cycle
+        app.advance();
+    }
+
+    auto const& timer     = app.timer();
+    auto const total      = timer.total();
+    auto const particles  = app.nbrParticles();
+    auto const rate       = particles * steps / total;
+    double const pushTime = [&]() {
+        for (auto const& [stage, time] : timer.times())
+            if (stage == "push_deposit")
+                return time;
+        return 0.;
+    }();
+
+    std::cout << "dim " << dim << " interp " << interp << ", cells";
+    for (auto const cell : cells)
+        std::cout << " " << cell;
+    std::cout << ", " << particles << " particles, " << steps << " steps\n\n";
+
+    std::cout << std::left << std::setw(20) << "stage" << std::right << std::setw(12) << "time (s)"
+              << std::setw(10) << "%" << "\n";
+    for (auto const& [stage, time] : timer.times())
+        std::cout << std::left << std::setw(20) << stage << std::right << std::setw(12)
+                  << std::setprecision(4) << std::fixed << time << std::setw(10)
+                  << std::setprecision(1) << 100 * time / total << "\n";
+    std::cout << std::left << std::setw(20) << "total" << std::right << std::setw(12)
+              << std::setprecision(4) << total << "\n\n";
+
+    std::cout << std::scientific << std::setprecision(3) << "particles/sec " << rate
+              << " (particles x steps / total time)\n"
+              << "pushes/sec    " << pushed / pushTime << " (in push_deposit)\n";
+
+    if (args.json.empty())
+        return;
+
+    std::ofstream json{args.json};
+    json << std::setprecision(9) << "{\n"
+         << "  \"dim\": " << dim << ",\n"
+         << "  \"interp\": " << interp << ",\n"
+         << "  \"cells\": [";
+    for (std::size_t i = 0; i < dim; ++i)
+        json << (i ? ", " : "") << cells[i];
+    json << "],\n"
+         << "  \"ppc\": " << args.options.ppc << ",\n"
+         << "  \"particles\": " << particles << ",\n"
+         << "  \"steps\": " << steps << ",\n"
+         << "  \"tile_size\": " << args.options.tileSize << ",\n"
+         << "  \"interleaved_gather\": " << std::boolalpha << args.options.interleavedGather
+         << ",\n"
+         << "  \"deferred_cellmap\": " << args.options.deferredCellmap << ",\n"
+         << "  \"total\": " << total << ",\n"
+         << "  \"particles_per_sec\": " << rate << ",\n"
+         << "  \"pushes_per_sec\": " << pushed / pushTime << ",\n"
+         << "  \"stages\": {";
+    std::size_t i = 0;
+    for (auto const& [stage, time] : timer.times())
+        json << (i++ ? ", " : "") << "\"" << stage << "\": " << time;
+    json << "}\n}\n";
+}
+
+
+template<std::size_t dim>
+void run(Arguments const& args)
+{
+    if (args.interp == 1)
+        run<dim, 1>(args);
+    else if (args.interp == 2)
+        run<dim, 2>(args);
+    else if (args.interp == 3)
+        run<dim, 3>(args);
+    else
+        throw std::runtime_error("interp must be 1, 2 or 3");
+}
+
+} // namespace PHARE::core::mini_app
+
+
+int main(int argc, char** argv)
+{
+    using namespace PHARE::core::mini_app;
+
+    try
+    {
+        auto const args = parse(argc, argv);
+        if (args.dim == 1)
+            run<1>(args);
+        else if (args.dim == 2)
+            run<2>(args);
+        else if (args.dim == 3)
+            run<3>(args);
+        else
+            throw std::runtime_error("dim must be 1, 2 or 3");
+    }
+    catch (std::exception const& e)
+    {
+        std::cerr << "phare_mini_app: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,560 @@
+#ifndef PHARE_BENCH_CORE_MINI_APP_HPP
+#define PHARE_BENCH_CORE_MINI_APP_HPP
+
+#include "phare_core.hpp"
+
+#include "core/data/ions/particle_initializers/particle_initializer_factory.hpp"
+#include "core/models/hybrid_state.hpp"
+#include "core/numerics/ohm/ohm.hpp"
+#include "core/numerics/ampere/ampere.hpp"
+#include "core/numerics/faraday/faraday.hpp"
+#include "core/numerics/ion_updater/ion_updater.hpp"
+#include "core/utilities/span.hpp"
+#include "core/utilities/range/range.hpp"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+
+/*
+  The PPC cycle of SolverPPC on a single periodic patch, without SAMRAI: the HybridState
+  resources are allocated here, and what the messengers do between patches is replaced by
+  periodic wraparound of the patch ghosts.
+*/
+
+namespace PHARE::core::mini_app
+{
+struct Options
+{
+    std::uint32_t cells     = 0; // per direction, 0 for a default of the dimension
+    std::uint32_t ppc       = 100;
+    std::size_t steps       = 10;
+    double dl               = 0.2;
+    double dt               = 1e-3;
+    std::size_t seed        = 1337;
+    int tileSize            = 0;
+    bool interleavedGather  = false;
+    bool deferredCellmap    = false;
+    std::string pusher_name = "modified_boris";
+};
+
+
+/** calls fn(ghost, image, n) for each run of n contiguous ghost nodes of the field, image being
+ * the nodes one period of the patch away, inside it. Directions are done in turn over the whole
+ * extent of the others, so that corners reach their image through the edges.
+ */
+template<typename GridLayout, typename Field, typename Fn>
+void for_each_periodic_image(Field& field, GridLayout const& layout, Fn&& fn)
+{
+    auto constexpr dim = GridLayout::dimension;
+    auto const shape   = field.shape();
+    auto* const data   = field.data();
+
+    for (std::size_t dir = 0; dir < dim; ++dir)
+    {
+        auto const start
+            = static_cast<int>(layout.physicalStartIndex(field, static_cast<Direction>(dir)));
+        auto const period = static_cast<int>(layout.nbrCells()[dir]);
+        auto const nodes  = static_cast<int>(shape[dir]);
+
+        std::size_t outer = 1, inner = 1;
+        for (std::size_t i = 0; i < dir; ++i)
+            outer *= shape[i];
+        for (std::size_t i = dir + 1; i < dim; ++i)
+            inner *= shape[i];
+
+        for (int node = 0; node < nodes; ++node)
+        {
+            if (node >= start and node < start + period)
+                continue;
+            auto image = node;
+            while (image < start)
+                image += period;
+            while (image >= start + period)
+                image -= period;
+
+            for (std::size_t line = 0; line < outer; ++line)
+            {
+                auto* const lineData = data + line * nodes * inner;
+                fn(lineData + node * inner, lineData + image * inner, inner);
+            }
+        }
+    }
+}
+
+// ghost nodes, and the last primal node of the patch, take the value of their image
+template<typename GridLayout, typename Field>
+void fill_periodic(Field& field, GridLayout const& layout)
+{
+    for_each_periodic_image(field, layout, [](auto* ghost, auto const* image, std::size_t n) {
+        std::copy(image, image + n, ghost);
+    });
+}
+
+// what was deposited on ghost nodes is added to their image, which then gives it back to them
+template<typename GridLayout, typename Field>
+void fold_periodic(Field& field, GridLayout const& layout)
+{
+    for_each_periodic_image(field, layout, [](auto const* ghost, auto* image, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i)
+            image[i] += ghost[i];
+    });
+    fill_periodic(field, layout);
+}
+
+template<typename GridLayout, typename VecField>
+void fill_periodic_vecfield(VecField& vecfield, GridLayout const& layout)
+{
+    for (auto& component : vecfield)
+        fill_periodic(component, layout);
+}
+
+
+
+/** allocates the buffers of the fields and particle packs found walking a resources user, as
+ * the ResourcesManager does on a SAMRAI patch. Resources are identified by their name, so that
+ * the copies of a view, like the ions held by the electrons, get the same buffers.
+ */
+template<typename GridLayout, typename Grid, typename ParticleArray>
+class PatchBuffers
+{
+    using Pack = ParticlesPack<ParticleArray>;
+
+    template<typename View, typename = void>
+    struct is_field : std::false_type
+    {
+    };
+    template<typename View>
+    struct is_field<View, std::void_t<decltype(std::declval<View>().physicalQuantity())>>
+        : std::true_type
+    {
+    };
+
+    template<typename View, typename = void>
+    struct is_particles : std::false_type
+    {
+    };
+    template<typename View>
+    struct is_particles<View, std::void_t<decltype(std::declval<View>()._domainParticles)>>
+        : std::true_type
+    {
+    };
+
+    template<typename View, typename = void>
+    struct has_compile_time_list : std::false_type
+    {
+    };
+    template<typename View>
+    struct has_compile_time_list<
+        View, std::void_t<decltype(std::declval<View>().getCompileTimeResourcesViewList())>>
+        : std::true_type
+    {
+    };
+
+    template<typename View, typename = void>
+    struct has_run_time_list : std::false_type
+    {
+    };
+    template<typename View>
+    struct has_run_time_list<
+        View, std::void_t<decltype(std::declval<View>().getRunTimeResourcesViewList())>>
+        : std::true_type
+    {
+    };
+
+public:
+    explicit PatchBuffers(GridLayout const& layout)
+        : layout_{layout}
+        , particleBox_{grow(layout.AMRBox(), GridLayout::nbrParticleGhosts() + 1)}
+    {
+    }
+
+    template<typename View>
+    void allocate(View& view)
+    {
+        if constexpr (has_compile_time_list<View>::value)
+            std::apply([&](auto&... sub) { (allocate(sub), ...); },
+                       view.getCompileTimeResourcesViewList());
+
+        if constexpr (has_run_time_list<View>::value)
+            for (auto& sub : view.getRunTimeResourcesViewList())
+                allocate(sub);
+
+        if constexpr (is_field<View>::value)
+        {
+            auto [it, inserted] = grids_.try_emplace(view.name(), nullptr);
+            if (inserted)
+            {
+                auto const qty = view.physicalQuantity();
+                it->second     = std::make_unique<Grid>(view.name(), qty, layout_.allocSize(qty));
+            }
+            view.setBuffer(&*it->second); // Grid::operator& gives its Field
+        }
+        else if constexpr (is_particles<View>::value)
+        {
+            auto [it, inserted] = packs_.try_emplace(view.name(), nullptr);
+            if (inserted)
+            {
+                auto array = [&]() { return &particles_.emplace_back(particleBox_); };
+                it->second = std::make_unique<Pack>(
+                    Pack{view.name(), array(), array(), array(), array(), array(), array()});
+            }
+            view.setBuffer(it->second.get());
+        }
+    }
+
+private:
+    GridLayout const& layout_;
+    Box<int, GridLayout::dimension> particleBox_;
+
+    // by name, with stable addresses for the views to keep pointing to
+    std::unordered_map<std::string, std::unique_ptr<Grid>> grids_;
+    std::unordered_map<std::string, std::unique_ptr<Pack>> packs_;
+    std::deque<ParticleArray> particles_;
+};
+
+
+
+// wall time of each stage of the cycle, in seconds
+class StageTimer
+{
+public:
+    template<typename Fn>
+    void operator()(std::string const& stage, Fn&& fn)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        fn();
+        std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+
+        for (auto& [name, time] : times_)
+            if (name == stage)
+            {
+                time += elapsed.count();
+                return;
+            }
+        times_.emplace_back(stage, elapsed.count());
+    }
+
+    NO_DISCARD auto const& times() const { return times_; }
+
+    NO_DISCARD double total() const
+    {
+        double total = 0;
+        for (auto const& [_, time] : times_)
+            total += time;
+        return total;
+    }
+
+private:
+    std::vector<std::pair<std::string, double>> times_; // in order of first call
+};
+
+
+
+template<std::size_t dim, std::size_t interp>
+class MiniApp
+{
+    using Types           = PHARE_Types<dim, interp>;
+    using GridLayout_t    = typename Types::GridLayout_t;
+    using Grid_t          = typename Types::Grid_t;
+    using Electromag_t    = typename Types::Electromag_t;
+    using Ions_t          = typename Types::Ions_t;
+    using Electrons_t     = typename Types::Electrons_t;
+    using ParticleArray_t = typename Types::ParticleArray_t;
+    using HybridState_t   = HybridState<Electromag_t, Ions_t, Electrons_t>;
+    using Interpolator_t  = Interpolator<dim, interp>;
+    using IonUpdater_t    = IonUpdater<Ions_t, Electromag_t, GridLayout_t>;
+
+public:
+    static std::uint32_t default_cells()
+    {
+        if constexpr (dim == 1)
+            return 1000;
+        else if constexpr (dim == 2)
+            return 64;
+        else
+            return 16;
+    }
+
+    explicit MiniApp(Options const& options)
+        : options_{options}
+        , layout_{ConstArray<double, dim>(options.dl),
+                  ConstArray<std::uint32_t, dim>(options.cells ? options.cells : default_cells()),
+                  Point<double, dim>{ConstArray<double, dim>(0)}}
+        , dict_{make_dict(options, layout_)}
+        , state_{dict_}
+        , electromagPred_{"EMPred"}
+        , electromagAvg_{"EMAvg"}
+        , buffers_{layout_}
+        , faraday_{}
+        , ampere_{}
+        , ohm_{dict_["ohm"]}
+        , ionUpdater_{dict_["ion_updater"]}
+    {
+        buffers_.allocate(state_);
+        buffers_.allocate(electromagPred_);
+        buffers_.allocate(electromagAvg_);
+
+        faraday_.setLayout(&layout_);
+        ampere_.setLayout(&layout_);
+        ohm_.setLayout(&layout_);
+
+        for (auto& pop : state_.ions)
+        {
+            ParticleInitializerFactory<ParticleArray_t, GridLayout_t>::create(
+                pop.particleInitializerInfo())
+                ->loadParticles(pop.domainParticles(), layout_);
+            savedDomain_.emplace_back(pop.domainParticles().box());
+        }
+        state_.electromag.initialize(layout_);
+        fill_periodic_vecfield(state_.electromag.B, layout_);
+
+        // moments and E from the loaded particles and B, as after a first corrector
+        ionUpdater_.updatePopulations(state_.ions, state_.electromag, layout_, 0.,
+                                      UpdaterMode::domain_only);
+        wrapLeaving_();
+        ionMoments_();
+        ampere_(state_.electromag.B, state_.J);
+        fill_periodic_vecfield(state_.J, layout_);
+        electrons_();
+        ohm_(state_.ions.density(), state_.electrons.velocity(), state_.electrons.pressure(),
+             state_.electromag.B, state_.J, state_.electromag.E);
+        fill_periodic_vecfield(state_.electromag.E, layout_);
+    }
+
+
+    void advance()
+    {
+        auto const dt = options_.dt;
+
+        predictor_(state_.electromag.E, electromagPred_.E);
+        average_();
+
+        timer_("save_state", [&]() {
+            std::size_t iPop = 0;
+            for (auto& pop : state_.ions)
+                savedDomain_[iPop++] = pop.domainParticles();
+        });
+        moveIons_(UpdaterMode::domain_only, dt);
+
+        predictor_(electromagAvg_.E, electromagPred_.E);
+        average_();
+
+        timer_("restore_state", [&]() {
+            std::size_t iPop = 0;
+            for (auto& pop : state_.ions)
+                pop.domainParticles() = savedDomain_[iPop++];
+        });
+        moveIons_(UpdaterMode::all, dt);
+
+        // corrector
+        timer_("faraday", [&]() {
+            faraday_(state_.electromag.B, electromagAvg_.E, state_.electromag.B, dt);
+            fill_periodic_vecfield(state_.electromag.B, layout_);
+        });
+        timer_("ampere", [&]() {
+            ampere_(state_.electromag.B, state_.J);
+            fill_periodic_vecfield(state_.J, layout_);
+        });
+        timer_("electrons", [&]() { electrons_(); });
+        timer_("ohm", [&]() {
+            ohm_(state_.ions.density(), state_.electrons.velocity(), state_.electrons.pressure(),
+                 state_.electromag.B, state_.J, state_.electromag.E);
+            fill_periodic_vecfield(state_.electromag.E, layout_);
+        });
+    }
+
+
+    NO_DISCARD std::size_t nbrParticles() const
+    {
+        std::size_t nbr = 0;
+        for (auto const& pop : state_.ions)
+            nbr += pop.domainParticles().size();
+        return nbr;
+    }
+
+    NO_DISCARD auto const& layout() const { return layout_; }
+    NO_DISCARD auto const& timer() const { return timer_; }
+    NO_DISCARD auto& state() { return state_; }
+
+
+private:
+    static auto uniform(double const value)
+    {
+        return [value](std::vector<double> const& x, auto const&...) {
+            return std::make_shared<VectorSpan<double>>(x.size(), value);
+        };
+    }
+
+    // a transverse wave of wavelength the patch length along x, on a uniform Bx
+    static auto wave(double const amplitude, double const length, double const phase)
+    {
+        return [=](std::vector<double> const& x, auto const&...) {
+            std::vector<double> values(x.size());
+            for (std::size_t i = 0; i < x.size(); ++i)
+                values[i] = amplitude * std::cos(2 * M_PI * x[i] / length + phase);
+            return std::make_shared<VectorSpan<double>>(std::move(values));
+        };
+    }
+
+    static initializer::PHAREDict make_dict(Options const& options, GridLayout_t const& layout)
+    {
+        using Function     = initializer::InitFunction<dim>;
+        auto const lengthX = layout.meshSize()[0] * layout.nbrCells()[0];
+
+        initializer::PHAREDict dict;
+        dict["electromag"]["name"]             = std::string{"EM"};
+        dict["electromag"]["electric"]["name"] = std::string{"E"};
+        dict["electromag"]["magnetic"]["name"] = std::string{"B"};
+
+        auto& Binit          = dict["electromag"]["magnetic"]["initializer"];
+        Binit["x_component"] = static_cast<Function>(uniform(1.));
+        Binit["y_component"] = static_cast<Function>(wave(.1, lengthX, 0.));
+        Binit["z_component"] = static_cast<Function>(wave(.1, lengthX, M_PI / 2));
+
+        dict["ions"]["nbrPopulations"] = std::size_t{1};
+        dict["ions"]["pop0"]["name"]   = std::string{"protons"};
+        dict["ions"]["pop0"]["mass"]   = 1.;
+
+        auto& maxwellian                 = dict["ions"]["pop0"]["particle_initializer"];
+        maxwellian["name"]               = std::string{"maxwellian"};
+        maxwellian["density"]            = static_cast<Function>(uniform(1.));
+        maxwellian["bulk_velocity_x"]    = static_cast<Function>(uniform(0.));
+        maxwellian["bulk_velocity_y"]    = static_cast<Function>(uniform(0.));
+        maxwellian["bulk_velocity_z"]    = static_cast<Function>(uniform(0.));
+        maxwellian["thermal_velocity_x"] = static_cast<Function>(uniform(.3));
+        maxwellian["thermal_velocity_y"] = static_cast<Function>(uniform(.3));
+        maxwellian["thermal_velocity_z"] = static_cast<Function>(uniform(.3));
+        maxwellian["nbr_part_per_cell"]  = static_cast<int>(options.ppc);
+        maxwellian["charge"]             = 1.;
+        maxwellian["basis"]              = std::string{"cartesian"};
+        maxwellian["init"]["seed"]       = std::optional<std::size_t>{options.seed};
+
+        dict["electrons"]["pressure_closure"]["name"] = std::string{"isothermal"};
+        dict["electrons"]["pressure_closure"]["Te"]   = 0.1;
+
+        dict["ohm"]["resistivity"]       = 1e-3;
+        dict["ohm"]["hyper_resistivity"] = 1e-3;
+
+        auto& updater                              = dict["ion_updater"];
+        updater["pusher"]["name"]                  = options.pusher_name;
+        updater["pusher"]["deferred_cellmap"]      = options.deferredCellmap;
+        updater["pusher"]["interleaved_em_gather"] = options.interleavedGather;
+        updater["skip_patch_ghost_push"]           = true;
+        updater["tile_size"]                       = options.tileSize;
+
+        return dict;
+    }
+
+
+    // Faraday, Ampere and Ohm of the predictors, from B at time n and the given E
+    template<typename VecField>
+    void predictor_(VecField const& E, VecField& Epred)
+    {
+        auto const dt = options_.dt;
+        timer_("faraday", [&]() {
+            faraday_(state_.electromag.B, E, electromagPred_.B, dt);
+            fill_periodic_vecfield(electromagPred_.B, layout_);
+        });
+        timer_("ampere", [&]() {
+            ampere_(electromagPred_.B, state_.J);
+            fill_periodic_vecfield(state_.J, layout_);
+        });
+        timer_("electrons", [&]() { electrons_(); });
+        timer_("ohm", [&]() {
+            ohm_(state_.ions.density(), state_.electrons.velocity(), state_.electrons.pressure(),
+                 electromagPred_.B, state_.J, Epred);
+            fill_periodic_vecfield(Epred, layout_);
+        });
+    }
+
+    void average_()
+    {
+        timer_("average", [&]() {
+            core::average(state_.electromag.B, electromagPred_.B, electromagAvg_.B);
+            core::average(state_.electromag.E, electromagPred_.E, electromagAvg_.E);
+        });
+    }
+
+    void moveIons_(UpdaterMode const mode, double const dt)
+    {
+        timer_("push_deposit", [&]() {
+            ionUpdater_.updatePopulations(state_.ions, electromagAvg_, layout_, dt, mode);
+        });
+        timer_("periodic_particles", [&]() { wrapLeaving_(); });
+        timer_("ion_moments", [&]() { ionMoments_(); });
+    }
+
+    void electrons_()
+    {
+        state_.electrons.update(layout_);
+        fill_periodic_vecfield(state_.electrons.velocity(), layout_);
+        fill_periodic(state_.electrons.pressure(), layout_);
+    }
+
+
+    // particles that left the patch enter it on the other side, where they are deposited,
+    // as the messenger would give them to the neighbour patch
+    void wrapLeaving_()
+    {
+        auto const& domainBox = layout_.AMRBox();
+        for (auto& pop : state_.ions)
+        {
+            auto& leaving = pop.leavingParticles();
+            for (auto& particle : leaving)
+                for (std::size_t dir = 0; dir < dim; ++dir)
+                {
+                    auto const period = static_cast<int>(layout_.nbrCells()[dir]);
+                    if (particle.iCell[dir] < domainBox.lower[dir])
+                        particle.iCell[dir] += period;
+                    else if (particle.iCell[dir] > domainBox.upper[dir])
+                        particle.iCell[dir] -= period;
+                }
+            interpolator_(makeIndexRange(leaving), pop.density(), pop.flux(), layout_);
+
+            auto& domain = pop.domainParticles();
+            for (auto const& particle : leaving)
+                domain.push_back(particle);
+            leaving.clear();
+        }
+    }
+
+    void ionMoments_()
+    {
+        for (auto& pop : state_.ions)
+        {
+            fold_periodic(pop.density(), layout_);
+            for (auto& component : pop.flux())
+                fold_periodic(component, layout_);
+        }
+        ionUpdater_.updateIons(state_.ions);
+    }
+
+
+    Options const options_;
+    GridLayout_t layout_;
+    initializer::PHAREDict dict_;
+    HybridState_t state_;
+    Electromag_t electromagPred_, electromagAvg_;
+    PatchBuffers<GridLayout_t, Grid_t, ParticleArray_t> buffers_;
+
+    Faraday<GridLayout_t> faraday_;
+    Ampere<GridLayout_t> ampere_;
+    Ohm<GridLayout_t> ohm_;
+    IonUpdater_t ionUpdater_;
+    Interpolator_t interpolator_;
+
+    std::vector<ParticleArray_t> savedDomain_;
+    StageTimer timer_;
+};
+
+} // namespace PHARE::core::mini_app
+
+#endif /* PHARE_BENCH_CORE_MINI_APP_HPP */
@@ -0,0 +1,43 @@
+#include "tools/bench/core/bench.hpp"
+#include "core/numerics/ampere/ampere.hpp"
+#include "tests/core/data/gridlayout/test_gridlayout.hpp"
+
+template<std::size_t dim, std::size_t interp>
+void ampere(benchmark::State& state)
+{
+    using PHARE_Types  = PHARE::core::PHARE_Types<dim, interp>;
+    using GridLayout_t = typename PHARE_Types::GridLayout_t;
+
+    TestGridLayout<GridLayout_t> layout{static_cast<std::uint32_t>(state.range(0))};
+    PHARE::core::UsableElectromag<dim> em{layout};
+    PHARE::core::UsableVecField<dim> J{"J", layout, PHARE::core::HybridQuantity::Vector::J};
+
+    PHARE::core::Ampere<GridLayout_t> ampere;
+    ampere.setLayout(&layout);
+
+    while (state.KeepRunning())
+    {
+        ampere(em.B, J);
+        benchmark::DoNotOptimize(J[0].data());
+    }
+}
+
+using PHARE::core::bench::cells_args;
+
+BENCHMARK_TEMPLATE(ampere, 1, 1)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ampere, 1, 2)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ampere, 1, 3)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(ampere, 2, 1)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ampere, 2, 2)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ampere, 2, 3)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(ampere, 3, 1)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ampere, 3, 2)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ampere, 3, 3)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,43 @@
+#include "tools/bench/core/bench.hpp"
+#include "core/numerics/faraday/faraday.hpp"
+#include "tests/core/data/gridlayout/test_gridlayout.hpp"
+
+template<std::size_t dim, std::size_t interp>
+void faraday(benchmark::State& state)
+{
+    using PHARE_Types  = PHARE::core::PHARE_Types<dim, interp>;
+    using GridLayout_t = typename PHARE_Types::GridLayout_t;
+
+    TestGridLayout<GridLayout_t> layout{static_cast<std::uint32_t>(state.range(0))};
+    PHARE::core::UsableElectromag<dim> em{layout};
+    PHARE::core::UsableVecField<dim> Bnew{"Bnew", layout, PHARE::core::HybridQuantity::Vector::B};
+
+    PHARE::core::Faraday<GridLayout_t> faraday;
+    faraday.setLayout(&layout);
+
+    while (state.KeepRunning())
+    {
+        faraday(em.B, em.E, Bnew, 1e-3);
+        benchmark::DoNotOptimize(Bnew[0].data());
+    }
+}
+
+using PHARE::core::bench::cells_args;
+
+BENCHMARK_TEMPLATE(faraday, 1, 1)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(faraday, 1, 2)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(faraday, 1, 3)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(faraday, 2, 1)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(faraday, 2, 2)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(faraday, 2, 3)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(faraday, 3, 1)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(faraday, 3, 2)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(faraday, 3, 3)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,85 @@
+#include "tools/bench/core/bench.hpp"
+#include "core/numerics/interpolator/interpolator.hpp"
+#include "core/numerics/interpolator/electromag_gather_buffer.hpp"
+#include "tests/core/data/gridlayout/test_gridlayout.hpp"
+
+// mesh to particle interpolation of E and B on the domain particles of a patch, reading
+// the six fields one by one or the interleaved ElectromagGatherBuffer
+namespace PHARE::core::bench
+{
+template<std::size_t dim, std::size_t interp>
+struct Gather
+{
+    using PHARE_Types   = core::PHARE_Types<dim, interp>;
+    using GridLayout_t  = TestGridLayout<typename PHARE_Types::GridLayout_t>;
+    using ParticleArray = typename PHARE_Types::ParticleArray_t;
+
+    Gather(std::uint32_t const cells, std::size_t const ppc)
+        : layout{cells}
+    {
+        particles.vector() = make_particles<dim>(ppc, layout.AMRBox(), 1337).vector();
+        std::sort(particles);
+
+        std::mt19937_64 gen{1337};
+        std::uniform_real_distribution<double> delta(0, 1);
+        for (auto& particle : particles)
+            for (std::size_t iDim = 0; iDim < dim; ++iDim)
+                particle.delta[iDim] = delta(gen);
+        particles.stale_map();
+    }
+
+    GridLayout_t layout;
+    ParticleArray particles{layout.AMRBox()};
+    UsableElectromag<dim> em{layout};
+    Interpolator<dim, interp> interpolator;
+};
+
+
+template<std::size_t dim, std::size_t interp>
+void field_gather(benchmark::State& state)
+{
+    Gather<dim, interp> gather{static_cast<std::uint32_t>(state.range(0)),
+                               static_cast<std::size_t>(state.range(1))};
+
+    while (state.KeepRunning())
+        for (auto& particle : gather.particles)
+            benchmark::DoNotOptimize(gather.interpolator(particle, gather.em, gather.layout));
+
+    state.SetItemsProcessed(state.iterations() * gather.particles.size());
+}
+
+template<std::size_t dim, std::size_t interp>
+void buffer_gather(benchmark::State& state)
+{
+    Gather<dim, interp> gather{static_cast<std::uint32_t>(state.range(0)),
+                               static_cast<std::size_t>(state.range(1))};
+    ElectromagGatherBuffer<dim> buffer;
+    buffer.pack(gather.em, gather.layout);
+
+    while (state.KeepRunning())
+        for (auto& particle : gather.particles)
+            benchmark::DoNotOptimize(gather.interpolator(particle, buffer, gather.layout));
+
+    state.SetItemsProcessed(state.iterations() * gather.particles.size());
+}
+
+} // namespace PHARE::core::bench
+
+using namespace PHARE::core::bench;
+
+BENCHMARK_TEMPLATE(field_gather, 1, 1)->Apply(cells_ppc_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(buffer_gather, 1, 1)->Apply(cells_ppc_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(field_gather, 2, 1)->Apply(cells_ppc_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(buffer_gather, 2, 1)->Apply(cells_ppc_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(field_gather, 2, 3)->Apply(cells_ppc_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(buffer_gather, 2, 3)->Apply(cells_ppc_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(field_gather, 3, 1)->Apply(cells_ppc_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(buffer_gather, 3, 1)->Apply(cells_ppc_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(field_gather, 3, 2)->Apply(cells_ppc_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(buffer_gather, 3, 2)->Apply(cells_ppc_args<3>)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,104 @@
+#include "tools/bench/core/bench.hpp"
+#include "core/numerics/moments/tiled_deposit.hpp"
+#include "core/numerics/interpolator/interpolator.hpp"
+#include "tests/core/data/gridlayout/test_gridlayout.hpp"
+
+// density and flux deposit of the domain particles of a patch, particle by particle or tile
+// by tile. Between deposits, one particle in 16 moves to the next cell as in a push, so that
+// the tiled deposit sorts particles that are not all in their tile any more.
+namespace PHARE::core::bench
+{
+template<std::size_t dim, std::size_t interp>
+struct Deposit
+{
+    using PHARE_Types   = core::PHARE_Types<dim, interp>;
+    using GridLayout_t  = TestGridLayout<typename PHARE_Types::GridLayout_t>;
+    using ParticleArray = typename PHARE_Types::ParticleArray_t;
+    using Grid_t        = typename PHARE_Types::Grid_t;
+
+    Deposit(std::uint32_t const cells, std::size_t const ppc)
+        : layout{cells}
+        , cells_{cells}
+    {
+        for (auto const& particle : make_particles<dim>(ppc, layout.AMRBox(), 1337))
+            particles.push_back(particle);
+    }
+
+    void move()
+    {
+        for (std::size_t idx = 0; idx < particles.size(); idx += 16)
+        {
+            auto iCell = particles[idx].iCell;
+            iCell[0]   = (iCell[0] + 1) % static_cast<int>(cells_);
+            particles.change_icell(iCell, idx);
+        }
+    }
+
+    GridLayout_t layout;
+    std::uint32_t cells_;
+    ParticleArray particles{layout.AMRBox()};
+    Grid_t rho{"rho", HybridQuantity::Scalar::rho, layout.allocSize(HybridQuantity::Scalar::rho)};
+    UsableVecField<dim> flux{"F", layout, HybridQuantity::Vector::V};
+};
+
+
+template<std::size_t dim, std::size_t interp>
+void particle_deposit(benchmark::State& state)
+{
+    Deposit<dim, interp> deposit{static_cast<std::uint32_t>(state.range(0)),
+                                 static_cast<std::size_t>(state.range(1))};
+    Interpolator<dim, interp> interpolator;
+
+    while (state.KeepRunning())
+    {
+        state.PauseTiming();
+        deposit.move();
+        state.ResumeTiming();
+
+        interpolator(deposit.particles, deposit.rho, deposit.flux, deposit.layout);
+    }
+    state.SetItemsProcessed(state.iterations() * deposit.particles.size());
+}
+
+template<std::size_t dim, std::size_t interp>
+void tiled_deposit(benchmark::State& state)
+{
+    Deposit<dim, interp> deposit{static_cast<std::uint32_t>(state.range(0)),
+                                 static_cast<std::size_t>(state.range(1))};
+    TiledDeposit<dim, interp> tiled{static_cast<std::uint32_t>(state.range(2))};
+
+    while (state.KeepRunning())
+    {
+        state.PauseTiming();
+        deposit.move();
+        state.ResumeTiming();
+
+        tiled(deposit.particles, deposit.rho, deposit.flux, deposit.layout);
+    }
+    state.SetItemsProcessed(state.iterations() * deposit.particles.size());
+}
+
+
+template<std::size_t dim>
+void tiled_args(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"cells", "ppc", "tile"});
+    b->ArgsProduct({patch_cells<dim>(), particles_per_cell, {4, 8}});
+}
+
+} // namespace PHARE::core::bench
+
+using namespace PHARE::core::bench;
+
+BENCHMARK_TEMPLATE(particle_deposit, 1, 1)->Apply(cells_ppc_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(tiled_deposit, 1, 1)->Apply(tiled_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(particle_deposit, 2, 1)->Apply(cells_ppc_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(tiled_deposit, 2, 1)->Apply(tiled_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(particle_deposit, 3, 1)->Apply(cells_ppc_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(tiled_deposit, 3, 1)->Apply(tiled_args<3>)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,53 @@
+#include "tools/bench/core/bench.hpp"
+#include "core/numerics/ohm/ohm.hpp"
+#include "tests/core/data/gridlayout/test_gridlayout.hpp"
+
+template<std::size_t dim, std::size_t interp>
+void ohm(benchmark::State& state)
+{
+    using PHARE_Types  = PHARE::core::PHARE_Types<dim, interp>;
+    using GridLayout_t = typename PHARE_Types::GridLayout_t;
+    using Grid_t       = typename PHARE_Types::Grid_t;
+    using PHARE::core::HybridQuantity;
+
+    TestGridLayout<GridLayout_t> layout{static_cast<std::uint32_t>(state.range(0))};
+    PHARE::core::UsableElectromag<dim> em{layout};
+    PHARE::core::UsableVecField<dim> Ve{"Ve", layout, HybridQuantity::Vector::V};
+    PHARE::core::UsableVecField<dim> J{"J", layout, HybridQuantity::Vector::J};
+    PHARE::core::UsableVecField<dim> Enew{"Enew", layout, HybridQuantity::Vector::E};
+    Grid_t n{"n", HybridQuantity::Scalar::rho, layout.allocSize(HybridQuantity::Scalar::rho)};
+    Grid_t Pe{"Pe", HybridQuantity::Scalar::P, layout.allocSize(HybridQuantity::Scalar::P)};
+    std::fill(n.begin(), n.end(), 1.); // the ideal term divides by the density
+
+    PHARE::initializer::PHAREDict dict;
+    dict["resistivity"]       = 1e-3;
+    dict["hyper_resistivity"] = 1e-2;
+    PHARE::core::Ohm<GridLayout_t> ohm{dict};
+    ohm.setLayout(&layout);
+
+    while (state.KeepRunning())
+    {
+        ohm(n, Ve, Pe, em.B, J, Enew);
+        benchmark::DoNotOptimize(Enew[0].data());
+    }
+}
+
+using PHARE::core::bench::cells_args;
+
+BENCHMARK_TEMPLATE(ohm, 1, 1)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ohm, 1, 2)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ohm, 1, 3)->Apply(cells_args<1>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(ohm, 2, 1)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ohm, 2, 2)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ohm, 2, 3)->Apply(cells_args<2>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(ohm, 3, 1)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ohm, 3, 2)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ohm, 3, 3)->Apply(cells_args<3>)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
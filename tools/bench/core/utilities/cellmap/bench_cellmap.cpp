@@ -0,0 +1,110 @@
+#include "tools/bench/core/bench.hpp"
+
+using namespace PHARE;
+
+// particles in all cells of a patch but the ones on its border, so that they can move by one
+// cell and stay in the patch box their cell map covers
+template<std::size_t dim>
+auto mapped_particles(benchmark::State const& state)
+{
+    auto const cells = static_cast<int>(state.range(0));
+    auto const ppc   = static_cast<std::size_t>(state.range(1));
+
+    core::Box<int, dim> const box{core::ConstArray<int, dim>(0),
+                                  core::ConstArray<int, dim>(cells - 1)};
+    core::Box<int, dim> const inner{core::ConstArray<int, dim>(1),
+                                    core::ConstArray<int, dim>(cells - 2)};
+    core::ParticleArray<dim> particles{box};
+    particles.vector() = core::bench::make_particles<dim>(ppc, inner, 1337).vector();
+    particles.map_particles();
+    return particles;
+}
+
+template<std::size_t dim>
+core::Box<int, dim> half_box(benchmark::State const& state)
+{
+    return {core::ConstArray<int, dim>(0),
+            core::ConstArray<int, dim>(static_cast<int>(state.range(0)) / 2 - 1)};
+}
+
+
+template<std::size_t dim>
+void cellmap_add(benchmark::State& state)
+{
+    auto particles = mapped_particles<dim>(state);
+
+    while (state.KeepRunning())
+    {
+        particles.empty_map();
+        particles.map_particles();
+    }
+    state.SetItemsProcessed(state.iterations() * particles.size());
+}
+
+template<std::size_t dim>
+void cellmap_update(benchmark::State& state)
+{
+    auto particles = mapped_particles<dim>(state);
+    int move       = 1;
+
+    while (state.KeepRunning())
+    {
+        for (std::size_t i = 0; i < particles.size(); ++i)
+        {
+            auto cell = particles[i].iCell;
+            cell[0] += move;
+            particles.change_icell(cell, i);
+        }
+        move = -move; // back and forth, to stay off the patch border
+    }
+    state.SetItemsProcessed(state.iterations() * particles.size());
+}
+
+template<std::size_t dim>
+void cellmap_export(benchmark::State& state)
+{
+    auto particles  = mapped_particles<dim>(state);
+    auto const half = half_box<dim>(state);
+    core::ParticleArray<dim> exported{half};
+
+    while (state.KeepRunning())
+    {
+        exported.clear();
+        particles.export_particles(half, exported);
+        benchmark::DoNotOptimize(exported.vector().data());
+    }
+}
+
+template<std::size_t dim>
+void cellmap_count(benchmark::State& state)
+{
+    auto particles  = mapped_particles<dim>(state);
+    auto const half = half_box<dim>(state);
+
+    while (state.KeepRunning())
+        benchmark::DoNotOptimize(particles.nbr_particles_in(half));
+}
+
+using core::bench::cells_ppc_args;
+
+BENCHMARK_TEMPLATE(cellmap_add, 1)->Apply(cells_ppc_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(cellmap_add, 2)->Apply(cells_ppc_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(cellmap_add, 3)->Apply(cells_ppc_args<3>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(cellmap_update, 1)->Apply(cells_ppc_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(cellmap_update, 2)->Apply(cells_ppc_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(cellmap_update, 3)->Apply(cells_ppc_args<3>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(cellmap_export, 1)->Apply(cells_ppc_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(cellmap_export, 2)->Apply(cells_ppc_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(cellmap_export, 3)->Apply(cells_ppc_args<3>)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(cellmap_count, 1)->Apply(cells_ppc_args<1>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(cellmap_count, 2)->Apply(cells_ppc_args<2>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(cellmap_count, 3)->Apply(cells_ppc_args<3>)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,130 @@
+#
+# running the C++ benchmarks of a build configured with -Dbench=ON, and comparing them
+# with a baseline to catch kernel regressions
+#
+#   python3 tools/bench/run_benchmarks.py -b build --save-baseline   # on the reference commit
+#   python3 tools/bench/run_benchmarks.py -b build                   # exits 1 on regression
+#
+# each benchmark executable is run in its build directory, its google benchmark JSON output
+# is merged with the others in one file, benchmarks are compared on their median real time
+#
+
+import os
+import re
+import sys
+import json
+import shutil
+import argparse
+import subprocess
+from pathlib import Path
+
+
+def executables(build_dir, pattern, exclude):
+    """benchmark targets, named after the phare_bench_* projects of tools/bench"""
+    found = []
+    for path in sorted(Path(build_dir, "tools", "bench").rglob("phare_bench_*")):
+        if not path.is_file() or not os.access(path, os.X_OK):
+            continue
+        if not re.search(pattern, path.name):
+            continue
+        if exclude and re.search(exclude, path.name):
+            continue
+        found += [path]
+    return found
+
+
+def run(executable, args):
+    """google benchmark results of one executable, its context and median of each benchmark"""
+    output = executable.parent / f"{executable.name}.json"
+    command = [
+        str(executable.resolve()),
+        f"--benchmark_out={output.name}",
+        "--benchmark_out_format=json",
+        f"--benchmark_repetitions={args.repetitions}",
+        "--benchmark_report_aggregates_only=true",
+    ]
+    if args.filter:
+        command += [f"--benchmark_filter={args.filter}"]
+    print(" ".join(command), flush=True)
+    subprocess.run(command, cwd=executable.parent, check=True, stdout=subprocess.DEVNULL)
+    with open(output) as f:
+        return json.load(f)
+
+
+def medians(results):
+    """{benchmark name: real time in nanoseconds} of the median aggregates"""
+    to_ns = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}
+    times = {}
+    for executable, result in results.items():
+        for benchmark in result["benchmarks"]:
+            if benchmark.get("aggregate_name", "median") != "median":
+                continue
+            name = f"{executable}/{benchmark['run_name']}"
+            times[name] = benchmark["real_time"] * to_ns[benchmark["time_unit"]]
+    return times
+
+
+def compare(current, baseline, threshold):
+    """prints the ratio of each benchmark to its baseline, returns the regressed ones"""
+    regressions = []
+    print(f"\n{'benchmark':<80} {'baseline':>12} {'current':>12} {'ratio':>7}")
+    for name, time in sorted(current.items()):
+        if name not in baseline:
+            print(f"{name:<80} {'-':>12} {time:>12.0f} {'new':>7}")
+            continue
+        ratio = time / baseline[name]
+        flag = ""
+        if ratio > 1 + threshold:
+            regressions += [name]
+            flag = "  REGRESSION"
+        print(f"{name:<80} {baseline[name]:>12.0f} {time:>12.0f} {ratio:>7.2f}{flag}")
+    for name in sorted(set(baseline) - set(current)):
+        print(f"{name:<80} {baseline[name]:>12.0f} {'-':>12} {'gone':>7}")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="run and compare PHARE C++ benchmarks")
+    parser.add_argument("-b", "--build", default="build", help="build directory")
+    parser.add_argument("-o", "--output", default=".phare/bench/results.json")
+    parser.add_argument("--baseline", default=".phare/bench/baseline.json")
+    parser.add_argument(
+        "--save-baseline", action="store_true", help="store the results as the baseline"
+    )
+    parser.add_argument(
+        "-t", "--threshold", type=float, default=0.1, help="slowdown ratio allowed"
+    )
+    parser.add_argument("-r", "--repetitions", type=int, default=5)
+    parser.add_argument("-e", "--executables", default=".", help="regex of targets to run")
+    parser.add_argument("-x", "--exclude", default="push_raw_use")
+    parser.add_argument("-f", "--filter", default="", help="--benchmark_filter regex")
+    args = parser.parse_args()
+
+    found = executables(args.build, args.executables, args.exclude)
+    if not found:
+        sys.exit(f"no benchmark found in {args.build}, was it configured with -Dbench=ON?")
+
+    results = {executable.name: run(executable, args) for executable in found}
+    Path(args.output).parent.mkdir(parents=True, exist_ok=True)
+    with open(args.output, "w") as f:
+        json.dump(results, f, indent=1)
+
+    if args.save_baseline:
+        Path(args.baseline).parent.mkdir(parents=True, exist_ok=True)
+        shutil.copyfile(args.output, args.baseline)
+        print(f"baseline saved to {args.baseline}")
+        return
+
+    if not Path(args.baseline).exists():
+        print(f"no baseline at {args.baseline}, results written to {args.output}")
+        return
+
+    with open(args.baseline) as f:
+        baseline = medians(json.load(f))
+    regressions = compare(medians(results), baseline, args.threshold)
+    if regressions:
+        sys.exit(f"\n{len(regressions)} benchmark(s) slower than {1 + args.threshold:.2f}x")
+
+
+if __name__ == "__main__":
+    main()
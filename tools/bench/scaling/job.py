@@ -0,0 +1,255 @@
+#
+# one run of the scaling harness, see run_scaling.py, launched under mpirun in its own
+# directory so that .phare/timings/profile.txt is its own
+#
+#   mpirun -n 4 python3 -u job.py --case harris --cells 200 --ppc 100 --out run.json
+#
+# rank 0 writes the wall times and particle counts of the run to --out, the phases are
+# read from the scope profiler report by the harness
+#
+
+import sys
+import json
+import time
+import argparse
+import numpy as np
+
+from pyphare.cpp import cpp_lib  # must be first
+import pyphare.pharein as ph
+from pyphare.simulator.simulator import Simulator, startMPI
+
+
+dl = 0.2
+time_step = 0.001
+
+
+def S(x, x0, l):
+    return 0.5 * (1.0 + np.tanh((x - x0) / l))
+
+
+def simulation(ndim, cells, args, **kwargs):
+    diag_timestamps = []
+    if args.diag_every > 0:
+        diag_timestamps = time_step * np.arange(0, args.steps + 1, args.diag_every)
+
+    sim = ph.Simulation(
+        interp_order=args.interp,
+        time_step_nbr=args.steps,
+        time_step=time_step,
+        cells=[cells] * ndim,
+        dl=[dl] * ndim,
+        smallest_patch_size=args.patch_size,
+        largest_patch_size=args.patch_size,
+        resistivity=0.001,
+        hyper_resistivity=0.001,
+        diag_options={
+            "format": "phareh5",
+            "options": {"dir": "diags", "mode": "overwrite"},
+        },
+        **kwargs,
+    )
+    return sim, diag_timestamps
+
+
+def uniform(args):
+    """uniform plasma at rest in a uniform field, any dimension"""
+    sim, timestamps = simulation(args.ndim, args.cells, args)
+
+    def one(*xyz):
+        return 1.0
+
+    def zero(*xyz):
+        return 0.0
+
+    def vth(*xyz):
+        return 0.3
+
+    ph.MaxwellianFluidModel(
+        bx=one,
+        by=zero,
+        bz=zero,
+        protons={
+            "charge": 1,
+            "density": one,
+            "nbr_part_per_cell": args.ppc,
+            "init": {"seed": args.seed},
+            **{"vbulkx": zero, "vbulky": zero, "vbulkz": zero},
+            **{"vthx": vth, "vthy": vth, "vthz": vth},
+        },
+    )
+    ph.ElectronModel(closure="isothermal", Te=0.12)
+    return sim, timestamps
+
+
+def harris(args):
+    """the double Harris sheet of tools/bench/real/bench_harris.py, 2D"""
+    sim, timestamps = simulation(2, args.cells, args)
+    Lx, Ly = sim.simulation_domain()
+
+    def density(x, y):
+        return (
+            0.2
+            + 1.0 / np.cosh((y - Ly * 0.3) / 0.5) ** 2
+            + 1.0 / np.cosh((y - Ly * 0.7) / 0.5) ** 2
+        )
+
+    def perturbation(x, y):
+        w1, w2 = 0.2, 1.0
+        x0 = x - 0.5 * Lx
+        y1 = y - 0.3 * Ly
+        y2 = y - 0.7 * Ly
+        w3 = np.exp(-(x0 * x0 + y1 * y1) / (w2 * w2))
+        w4 = np.exp(-(x0 * x0 + y2 * y2) / (w2 * w2))
+        return x0, y1, y2, w3, w4, 2.0 * w1 / w2
+
+    def bx(x, y):
+        x0, y1, y2, w3, w4, w5 = perturbation(x, y)
+        return (
+            -1
+            + 2 * (S(y, Ly * 0.3, 0.5) - S(y, Ly * 0.7, 0.5))
+            + (-w5 * y1 * w3)
+            + (+w5 * y2 * w4)
+        )
+
+    def by(x, y):
+        x0, y1, y2, w3, w4, w5 = perturbation(x, y)
+        return (w5 * x0 * w3) + (-w5 * x0 * w4)
+
+    def bz(x, y):
+        return 0.0
+
+    def vxyz(x, y):
+        return 0.0
+
+    def vthxyz(x, y):
+        b2 = bx(x, y) ** 2 + by(x, y) ** 2
+        return np.sqrt(1.0 / density(x, y) * (1 - b2 * 0.5))
+
+    ph.MaxwellianFluidModel(
+        bx=bx,
+        by=by,
+        bz=bz,
+        protons={
+            "charge": 1,
+            "density": density,
+            "nbr_part_per_cell": args.ppc,
+            "init": {"seed": args.seed},
+            **{"vbulkx": vxyz, "vbulky": vxyz, "vbulkz": vxyz},
+            **{"vthx": vthxyz, "vthy": vthxyz, "vthz": vthxyz},
+        },
+    )
+    ph.ElectronModel(closure="isothermal", Te=0.0)
+    return sim, timestamps
+
+
+def shock(args):
+    """the compression of tests/functional/shock along x, refined where B varies"""
+    sim, timestamps = simulation(
+        args.ndim,
+        args.cells,
+        args,
+        refinement="tagging",
+        max_nbr_levels=2,
+        nesting_buffer=1,
+    )
+    L = sim.simulation_domain()[0]
+
+    def profile(x, v1, v2):
+        return v1 + (v2 - v1) * (S(x, L * 0.2, 1) - S(x, L * 0.8, 1))
+
+    def density(x, *yz):
+        return profile(x, 1.0, 1.0)
+
+    def by(x, *yz):
+        return profile(x, 0.125, 4.0)
+
+    def zero(x, *yz):
+        return 0.0
+
+    def vth(x, *yz):
+        return 0.1
+
+    ph.MaxwellianFluidModel(
+        bx=zero,
+        by=by,
+        bz=zero,
+        protons={
+            "charge": 1,
+            "density": density,
+            "nbr_part_per_cell": args.ppc,
+            "init": {"seed": args.seed},
+            **{"vbulkx": zero, "vbulky": zero, "vbulkz": zero},
+            **{"vthx": vth, "vthy": vth, "vthz": vth},
+        },
+    )
+    ph.ElectronModel(closure="isothermal", Te=0.12)
+    return sim, timestamps
+
+
+cases = {"uniform": uniform, "harris": harris, "shock": shock}
+
+
+def nbr_particles(simulator):
+    """domain particles of all levels and ranks (collective)"""
+    return sum(simulator.cpp_sim.nbr_particles())
+
+
+def parse_args(argv):
+    parser = argparse.ArgumentParser(description="one run of the scaling harness")
+    parser.add_argument("--case", choices=cases.keys(), default="uniform")
+    parser.add_argument("--ndim", type=int, default=2)
+    parser.add_argument("--interp", type=int, default=1)
+    parser.add_argument("--cells", type=int, default=100, help="per direction")
+    parser.add_argument("--ppc", type=int, default=100)
+    parser.add_argument("--steps", type=int, default=20)
+    parser.add_argument("--patch_size", type=int, default=25)
+    parser.add_argument("--diag_every", type=int, default=10, help="0 for none")
+    parser.add_argument("--seed", type=int, default=133333333337)
+    parser.add_argument("--out", default="run.json")
+    return parser.parse_args(argv)
+
+
+def main(argv):
+    args = parse_args(argv)
+    if args.case == "harris":
+        args.ndim = 2
+
+    startMPI()
+    sim, timestamps = cases[args.case](args)
+    if len(timestamps):
+        for quantity in ["E", "B"]:
+            ph.ElectromagDiagnostics(quantity=quantity, write_timestamps=timestamps)
+
+    simulator = Simulator(sim, print_one_line=False, log_to_file=False)
+
+    tick = time.perf_counter()
+    simulator.initialize()
+    init_time = time.perf_counter() - tick
+    particles_start = nbr_particles(simulator)
+
+    step_times = []
+    while simulator.currentTime() < simulator.cpp_sim.endTime():
+        tick = time.perf_counter()
+        simulator.advance()
+        step_times += [time.perf_counter() - tick]
+
+    particles_end = nbr_particles(simulator)
+    simulator.reset()  # reports the profiled scopes
+
+    if cpp_lib().mpi_rank() == 0:
+        run = {
+            **vars(args),
+            "ranks": cpp_lib().mpi_size(),
+            "init_time": init_time,
+            "advance_time": sum(step_times),
+            "step_times": step_times,
+            "particles": (particles_start + particles_end) / 2,
+            "particles_start": particles_start,
+            "particles_end": particles_end,
+        }
+        with open(args.out, "w") as f:
+            json.dump(run, f, indent=1)
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
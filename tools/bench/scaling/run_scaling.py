@@ -0,0 +1,314 @@
+#
+# strong and weak scaling of whole simulations, with the time of each phase of the runs
+#
+#   python3 tools/bench/scaling/run_scaling.py --cases uniform harris shock \
+#       --ranks 1 2 4 8 --cells 100 200 --mode strong weak
+#
+# each run is job.py under mpirun, in its own directory of --output, with
+# PHARE_SCOPE_TIMING=1 so that the scope profiler reports the time of the solver,
+# messenger, regrid and diagnostics scopes. Results of all runs are written to
+# scaling.json and scaling.csv, and plotted.
+#
+# strong: the cells per direction are fixed, efficiency is T(r0) r0 / (T(r) r)
+# weak:   the cells per rank are fixed, scaled from the smallest rank count r0 as
+#         cells (r / r0) ^ (1 / ndim) per direction, efficiency is T(r0) / T(r)
+#
+# scopes of log level 3 separate the deposit from the push, and the ghost fills, builds
+# with a lower PHARE_LOG_LEVEL count them in the phase of the scope that encloses them.
+#
+
+import os
+import re
+import sys
+import csv
+import json
+import argparse
+import subprocess
+from pathlib import Path
+
+
+THIS_DIR = Path(__file__).resolve().parent
+ROOT = THIS_DIR.parent.parent.parent
+
+# phase of the scopes of the profiler report by leaf name, the first matching phase
+# wins. A scope not matched is in the phase of its parent, what a phase scope does not
+# spend in another phase is its own.
+phases = {
+    "deposit": r"^(ParticleToMesh::operator\(\)|TiledDeposit::operator\(\))$",
+    "push": r"^(IonUpdater::|SolverPPC::moveIons_)",
+    "field_solve": r"^SolverPPC::(predictor1_|predictor2_|corrector_)\.|^SolverPPC::average_",
+    "ghost_fills": r"^(HybridHybridMessengerStrategy::|RefinerPool::fill)",
+    "regrid": r"^(Multiphys::initializeLevelData|Multiphys::applyGradientDetector"
+    r"|Integrator::_should_rebalance_now)",
+    "diagnostics": r"^(DiagnosticsManager::dump|H5Writer::dump)",
+}
+phase_names = list(phases) + ["other"]
+
+
+class Scope:
+    def __init__(self, name, mean, peak, parent=None):
+        self.name, self.mean, self.peak = name, mean, peak
+        self.parent, self.children = parent, []
+
+    def under_advance(self):
+        scope = self
+        while scope is not None:
+            if scope.name == "Simulator::advance":
+                return True
+            scope = scope.parent
+        return False
+
+
+def read_profile(path):
+    """call tree of the last non empty report of the scope profiler"""
+    line_re = re.compile(r"^( *)(.*) \((\d+)\)  (\S+) / (\S+) / (\S+)  (\d+)$")
+    reports, scopes = [], []
+    if not Path(path).exists():
+        return None
+    with open(path) as f:
+        for line in f:
+            if line.startswith("#"):
+                scopes = []
+                reports += [scopes]
+                continue
+            match = line_re.match(line.rstrip("\n"))
+            if match:
+                indent, name, _, _, mean, peak, _ = match.groups()
+                scopes += [(len(indent) // 2, name, float(mean), float(peak))]
+    reports = [scopes for scopes in reports if scopes]
+    if not reports:
+        return None
+
+    root = Scope("", 0, 0)
+    stack = [root]
+    for depth, name, mean, peak in reports[-1]:
+        del stack[depth + 1 :]
+        scope = Scope(name, mean, peak, stack[-1])
+        stack[-1].children += [scope]
+        stack += [scope]
+    return root
+
+
+def phase_times(root):
+    """{phase: mean seconds over ranks} spent in each phase during the time steps"""
+    times = {phase: 0.0 for phase in phase_names}
+    regexes = {phase: re.compile(regex) for phase, regex in phases.items()}
+
+    def phase_of(scope, inherited):
+        for phase, regex in regexes.items():
+            if regex.search(scope.name):
+                # levels initialized outside of time steps are not regrids
+                if phase == "regrid" and not scope.under_advance():
+                    return None
+                return phase
+        return inherited
+
+    def walk(scope, inherited):
+        phase = phase_of(scope, inherited)
+        own = scope.mean - sum(child.mean for child in scope.children)
+        if phase is not None or scope.under_advance():
+            times[phase or "other"] += max(own, 0.0)
+        for child in scope.children:
+            walk(child, phase)
+
+    for scope in root.children:
+        walk(scope, None)
+    return times
+
+
+def cells_of(mode, ndim, cells, ranks, ranks0):
+    if mode == "strong":
+        return cells
+    return int(round(cells * (ranks / ranks0) ** (1.0 / ndim)))
+
+
+def run(args, case, mode, ndim, base_cells, ranks, ranks0):
+    """results of job.py with the phases of its profile, None if it failed"""
+    cells = cells_of(mode, ndim, base_cells, ranks, ranks0)
+    name = f"{case}_{ndim}d_{mode}_{base_cells}_r{ranks}"
+    directory = Path(args.output) / name
+    profile = directory / ".phare" / "timings" / "profile.txt"
+    directory.mkdir(parents=True, exist_ok=True)
+    if profile.exists():
+        profile.unlink()  # reports are appended
+
+    command = args.mpirun.split() + [str(ranks), sys.executable, "-u"]
+    command += [str(THIS_DIR / "job.py"), "--case", case, "--ndim", str(ndim)]
+    command += ["--cells", str(cells), "--ppc", str(args.ppc)]
+    command += ["--steps", str(args.steps)]
+    command += ["--interp", str(args.interp), "--patch_size", str(args.patch_size)]
+    command += ["--diag_every", str(args.diag_every), "--out", "run.json"]
+
+    env = dict(os.environ, PHARE_SCOPE_TIMING="1", PHARE_LOG="NONE")
+    env["PYTHONPATH"] = os.pathsep.join(
+        [str(ROOT), str(ROOT / "pyphare"), str(Path(args.build).resolve())]
+        + [p for p in [os.environ.get("PYTHONPATH")] if p]
+    )
+
+    print(" ".join(command), flush=True)
+    with open(directory / "job.log", "w") as log:
+        status = subprocess.run(
+            command, cwd=directory, env=env, stdout=log, stderr=subprocess.STDOUT
+        )
+    if status.returncode != 0:
+        print(f"  failed, see {directory / 'job.log'}")
+        return None
+
+    with open(directory / "run.json") as f:
+        result = json.load(f)
+    result.pop("step_times")
+    result.update(mode=mode, base_cells=base_cells, name=name)
+
+    tree = read_profile(profile)
+    if tree is None:
+        print("  no profile, was PHARE built with phlop?")
+    times = phase_times(tree) if tree else {}
+    for phase in phase_names:
+        result[f"{phase}_time"] = times.get(phase, float("nan"))
+
+    cores = ranks * args.threads
+    result["particles_per_sec_per_core"] = (
+        result["particles"] * result["steps"] / result["advance_time"] / cores
+    )
+    return result
+
+
+def add_efficiencies(results):
+    """parallel efficiency of each run relative to the fewest ranks of its series"""
+    series = {}
+    for result in results:
+        key = (result["case"], result["ndim"], result["mode"], result["base_cells"])
+        series.setdefault(key, []).append(result)
+    for runs in series.values():
+        reference = min(runs, key=lambda result: result["ranks"])
+        for result in runs:
+            ratio = reference["advance_time"] / result["advance_time"]
+            if result["mode"] == "strong":
+                ratio *= reference["ranks"] / result["ranks"]
+            result["efficiency"] = ratio
+    return series
+
+
+def write(results, output):
+    with open(output / "scaling.json", "w") as f:
+        json.dump(results, f, indent=1)
+
+    columns = ["name", "case", "ndim", "mode", "base_cells", "cells", "ppc", "steps"]
+    columns += ["ranks", "particles", "init_time", "advance_time"]
+    columns += ["particles_per_sec_per_core", "efficiency"]
+    columns += [f"{phase}_time" for phase in phase_names]
+    with open(output / "scaling.csv", "w", newline="") as f:
+        writer = csv.DictWriter(f, fieldnames=columns, extrasaction="ignore")
+        writer.writeheader()
+        writer.writerows(results)
+
+
+def plot(series, output):
+    import matplotlib
+
+    matplotlib.use("Agg")
+    import matplotlib.pyplot as plt
+
+    for mode in ["strong", "weak"]:
+        curves = {key: runs for key, runs in series.items() if key[2] == mode}
+        if not curves:
+            continue
+
+        fig, (efficiency, rate) = plt.subplots(1, 2, figsize=(12, 5))
+        for (case, ndim, _, cells), runs in sorted(curves.items()):
+            runs = sorted(runs, key=lambda result: result["ranks"])
+            ranks = [result["ranks"] for result in runs]
+            label = f"{case} {ndim}d {cells} cells"
+            efficiency.plot(ranks, [r["efficiency"] for r in runs], "o-", label=label)
+            rate.plot(ranks, [r["particles_per_sec_per_core"] for r in runs], "o-")
+        efficiency.set(xscale="log", xlabel="ranks", ylabel="parallel efficiency")
+        rate.set(xscale="log", xlabel="ranks", ylabel="particles / s / core")
+        efficiency.axhline(1, color="grey", lw=0.5)
+        efficiency.legend(fontsize="small")
+        fig.suptitle(f"{mode} scaling")
+        fig.tight_layout()
+        fig.savefig(output / f"{mode}_scaling.png")
+        plt.close(fig)
+
+        # time per step of each phase, stacked, one bar per run
+        runs = [
+            r
+            for key in sorted(curves)
+            for r in sorted(curves[key], key=lambda r: r["ranks"])
+        ]
+        fig, ax = plt.subplots(figsize=(max(6, len(runs) * 0.6), 5))
+        bottom = [0.0] * len(runs)
+        for phase in phase_names:
+            heights = [r[f"{phase}_time"] / r["steps"] for r in runs]
+            ax.bar(range(len(runs)), heights, bottom=bottom, label=phase)
+            bottom = [b + h for b, h in zip(bottom, heights)]
+        ax.set_xticks(range(len(runs)))
+        ax.set_xticklabels([r["name"] for r in runs], rotation=90, fontsize="small")
+        ax.set_ylabel("mean seconds per step over ranks")
+        ax.legend(fontsize="small")
+        fig.suptitle(f"{mode} scaling, phases")
+        fig.tight_layout()
+        fig.savefig(output / f"{mode}_phases.png")
+        plt.close(fig)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="PHARE strong and weak scaling")
+    parser.add_argument("--cases", nargs="+", default=["uniform", "harris", "shock"])
+    parser.add_argument("--ndim", type=int, default=2, help="harris is always 2d")
+    parser.add_argument("--ranks", type=int, nargs="+", default=[1, 2, 4])
+    parser.add_argument(
+        "--cells", type=int, nargs="+", default=[100], help="per direction"
+    )
+    parser.add_argument(
+        "--mode", nargs="+", choices=["strong", "weak"], default=["strong"]
+    )
+    parser.add_argument("--ppc", type=int, default=100)
+    parser.add_argument("--steps", type=int, default=20)
+    parser.add_argument("--interp", type=int, default=1)
+    parser.add_argument("--patch_size", type=int, default=25)
+    parser.add_argument(
+        "--diag_every", type=int, default=10, help="0 for no diagnostics"
+    )
+    parser.add_argument("--threads", type=int, default=1, help="cores per rank")
+    parser.add_argument(
+        "--mpirun", default="mpirun -n", help="launcher, before the rank count"
+    )
+    parser.add_argument("-b", "--build", default="build", help="for its pybindlibs")
+    parser.add_argument("-o", "--output", default=".phare/scaling")
+    parser.add_argument("--no-plot", action="store_true")
+    args = parser.parse_args()
+
+    results = []
+    ranks0 = min(args.ranks)
+    for case in args.cases:
+        ndim = 2 if case == "harris" else args.ndim
+        for mode in args.mode:
+            for cells in args.cells:
+                for ranks in sorted(args.ranks):
+                    result = run(args, case, mode, ndim, cells, ranks, ranks0)
+                    if result:
+                        results += [result]
+
+    if not results:
+        sys.exit("no run succeeded")
+
+    output = Path(args.output)
+    series = add_efficiencies(results)
+    write(results, output)
+    if not args.no_plot:
+        plot(series, output)
+
+    print(f"\n{'run':<40} {'ranks':>5} {'s/step':>9} {'part/s/core':>12} {'eff':>6}")
+    for r in results:
+        step = r["advance_time"] / r["steps"]
+        rate = r["particles_per_sec_per_core"]
+        efficiency = r["efficiency"]
+        print(
+            f"{r['name']:<40} {r['ranks']:>5} {step:>9.4f} {rate:>12.3e} {efficiency:>6.2f}"
+        )
+    print(f"\nresults in {output / 'scaling.json'} and {output / 'scaling.csv'}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,98 @@
+#
+# merging the per rank Chrome trace event files written with PHARE_SCOPE_TRACE=1
+#
+#   python3 tools/python3/merge_traces.py .phare/traces -o trace.json --summary
+#
+# the output opens in chrome://tracing or https://ui.perfetto.dev, one process per rank and
+# one track per AMR level
+#
+
+import re
+import sys
+import glob
+import json
+import argparse
+from collections import defaultdict
+
+
+def load(path):
+    """events of one rank file, tolerating a run killed before the file was closed"""
+    with open(path) as f:
+        text = f.read().strip()
+    if not text.endswith("]"):
+        text = text.rstrip(",") + "]"
+    return json.loads(text)
+
+
+def rank_files(directory):
+    def rank_of(path):
+        return int(re.search(r"rank\.(\d+)\.json$", path).group(1))
+
+    return sorted(glob.glob(f"{directory}/rank.*.json"), key=rank_of)
+
+
+def merge(directory, output):
+    events = []
+    for path in rank_files(directory):
+        events += load(path)
+    with open(output, "w") as f:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ms"}, f)
+    return events
+
+
+def durations(events):
+    """seconds spent per scope name per rank, nested calls of the same scope counted once"""
+    per_scope = defaultdict(lambda: defaultdict(float))
+    open_scopes = defaultdict(list)
+    for event in events:
+        if event["ph"] not in "BE":
+            continue
+        track = (event["pid"], event["tid"])
+        if event["ph"] == "B":
+            open_scopes[track].append(event)
+            continue
+        if not open_scopes[track]:
+            continue
+        begin = open_scopes[track].pop()
+        if any(e["name"] == begin["name"] for e in open_scopes[track]):
+            continue
+        per_scope[begin["name"]][event["pid"]] += (event["ts"] - begin["ts"]) * 1e-6
+    return per_scope
+
+
+def summary(events, nbr_ranks, top=20):
+    """scopes with the most time lost waiting for the slowest rank"""
+    rows = []
+    for name, per_rank in durations(events).items():
+        times = [per_rank.get(rank, 0) for rank in range(nbr_ranks)]
+        mean = sum(times) / nbr_ranks
+        slowest = max(range(nbr_ranks), key=lambda rank: times[rank])
+        rows += [(times[slowest] - mean, name, mean, times[slowest], slowest)]
+
+    print(f"{'scope':<60} {'mean (s)':>10} {'max (s)':>10} {'rank':>6} {'max/mean':>9}")
+    for lost, name, mean, slowest, rank in sorted(rows, reverse=True)[:top]:
+        ratio = slowest / mean if mean > 0 else 1
+        print(f"{name:<60} {mean:>10.4f} {slowest:>10.4f} {rank:>6} {ratio:>9.2f}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="merge PHARE per rank trace files")
+    parser.add_argument("directory", nargs="?", default=".phare/traces")
+    parser.add_argument("-o", "--output", default="trace.json")
+    parser.add_argument(
+        "--summary", action="store_true", help="print the most imbalanced scopes"
+    )
+    args = parser.parse_args()
+
+    files = rank_files(args.directory)
+    if not files:
+        sys.exit(f"no rank.*.json file in {args.directory}")
+
+    events = merge(args.directory, args.output)
+    print(f"merged {len(files)} ranks, {len(events)} events into {args.output}")
+    if args.summary:
+        summary(events, len(files))
+
+
+if __name__ == "__main__":
+    main()